@@ -5,13 +5,23 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include "task.h"
+#include "board_config.h"
 #include "led.h"
 #include "usb_cdc.h"
+#include "rpc.h"
 #include "controls.h"
+#include "crc.h"
 #include "gpio.h"
 #include "lcd_driver.h"
 #include "images/wlarc.h"
 #include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "flash_log.h"
+#include "settings.h"
+#include "spiffs_port.h"
+#include "spiffs_checkd.h"
+#include "spiffs_gcd.h"
 
 #ifdef CODEPLUGS
 #include "lua.h"
@@ -29,10 +39,16 @@ static SemaphoreHandle_t red_monitor;
 static int  red_state;
 lcd_context_t lcd;
 
+#define LOG_BOOT	1	/* Firmware CRC */
+#define LOG_EXPORT_TIMEOUT	pdMS_TO_TICKS(500)	/* Host stopped reading */
+static struct flash_log flog;
+static bool flog_ok;
+
 int
 main (void)
 {
 	red_monitor = xSemaphoreCreateMutex();
+	sFLASH_BusInit();
 	xTaskCreate(output_main, "out", 2*1024, NULL, 1, NULL);
 	xTaskCreate(red_main, "red", 256, NULL, 0, NULL);
 #ifdef CODEPLUGS
@@ -61,11 +77,57 @@ get_red_state()
 	return i;
 }
 
+/* Sends the log records appended since the last export */
+static void
+log_export(void)
+{
+	static struct flash_log_cursor c;
+	static bool started;
+	static uint8_t rec[FLASH_LOG_MAX];
+	char line[32];
+	uint16_t type;
+	int len, n;
+
+	if (!flog_ok)
+		return;
+	if (!started) {
+		flash_log_rewind(&flog, &c);
+		started = true;
+	}
+	while ((len = flash_log_read(&flog, &c, &type, rec, sizeof(rec))) > 0) {
+		n = snprintf(line, sizeof(line), "log %lu %u %d\n",
+		    (unsigned long)c.seq - 1, type, len);
+		if (usb_cdc_write_timeout(line, n, LOG_EXPORT_TIMEOUT) != n ||
+		    usb_cdc_write_timeout(rec, len, LOG_EXPORT_TIMEOUT) != len)
+			break;
+	}
+}
+
+static int32_t
+logo_sink(void *arg, const uint8_t *buf, uint32_t len)
+{
+	(void)arg;
+	LCD_WriteRGB(buf, len);
+	return 0;
+}
+
+/* Draws logo.rgb, 160x128 RGB565 high byte first, if the file system has it */
+static bool
+logo_draw(void)
+{
+	static uint8_t buf[1024];
+	int32_t n;
+
+	if (LCD_BeginRGB(0, 0, 160, 128) <= 0)
+		return false;
+	n = spiffs_port_stream("logo.rgb", buf, sizeof(buf), logo_sink, NULL);
+	LCD_EndRGB();
+	return n > 0;
+}
+
 static void
 led_set(int red, int green)
 {
-	static uint8_t secreg = 0x1d;
-	uint8_t sr;
 	static int last_state = -1;
 	static char enc[] = "encoder: 00, ";
 	char kp[14];
@@ -115,25 +177,64 @@ led_set(int red, int green)
 	lcd.x = 0;
 	LCD_Printf(&lcd, "Batt2: %d   \n\n", val);
 	LCD_Printf(&lcd, "SPI ID: %08x\n", sFLASH_ReadID());
-	uint8_t sdat[10];
-	sFLASH_ReadBuffer(sdat, 0x100000, 6);
-	LCD_Printf(&lcd, "SPI DAT: %6.6s\n", sdat);
+	LCD_Printf(&lcd, "SPI PT: %s\n",
+	    flash_part_from_table() ? "flash" : "default");
+	struct sflash_cache_stats cst;
+	sFLASH_CacheStats(&cst);
+	lcd.x = 0;
+	lcd.y = 112;
+	LCD_Printf(&lcd, "FC %lu/%lu/%lu   ", cst.hits, cst.misses,
+	    cst.prefetches);
 	key = get_key();
 	if (key) {
 		if (key == '~')
 			pin_toggle(pin_lcd_bl);
-		if (key == 'M')
+		if (key == 'M' && !logo_draw())
 			LCD_DrawRGBTransparent(wlarc_logo, 0, 0, 160, 128, 65535);
 		if (key == KEY_UP || key == KEY_DOWN) {
+			uint8_t secreg = settings_get_u8(SETTING_SECREG, 0x1d);
+
 			if (key == KEY_UP)
 				secreg++;
 			else
 				secreg--;
+			settings_set_u8(SETTING_SECREG, secreg);
 			lcd.x = 0;
 			lcd.y = 96;
-			sFLASH_ReadSecurityBuffer(&sr, 0x3000 | secreg, 1);
-			LCD_Printf(&lcd, "SecReg 0x%02X=0x%02x", secreg, sr);
+			LCD_Printf(&lcd, "SecReg 0x%02X=0x%02x", secreg,
+			    *board_secreg(0x3000 | secreg, 1));
+		}
+		if (key == '#' || key == '*') {
+			uint32_t pages = settings_get_u32(SETTING_CACHE_PAGES,
+			    SPIFFS_PORT_CACHE_PAGES);
+			char rep[128];
+
+			/* '*' steps through cache sizes, '#' reports */
+			if (key == '*') {
+				pages = pages * 2 > SPIFFS_PORT_CACHE_MAX ?
+				    1 : pages * 2;
+				spiffs_port_cache_pages(pages);
+				settings_set_u32(SETTING_CACHE_PAGES, pages);
+			}
+			spiffs_port_cache_report(rep, sizeof(rep), key == '*');
+			usb_cdc_write(rep, strlen(rep));
+			spiffs_gcd_report(rep, sizeof(rep));
+			usb_cdc_write(rep, strlen(rep));
+			spiffs_checkd_report(rep, sizeof(rep));
+			usb_cdc_write(rep, strlen(rep));
+			spiffs_port_wear_report(rep, sizeof(rep));
+			usb_cdc_write(rep, strlen(rep));
+			usb_cdc_report(rep, sizeof(rep));
+			usb_cdc_write(rep, strlen(rep));
+			rpc_report(rep, sizeof(rep));
+			usb_cdc_write(rep, strlen(rep));
+			if (flog_ok) {
+				flash_log_report(&flog, rep, sizeof(rep));
+				usb_cdc_write(rep, strlen(rep));
+			}
 		}
+		if (key == '0')
+			log_export();
 		lcd.x = 0;
 		sprintf(kp, "%d (%c)\n", key, isprint(key)?key:'.');
 		usb_cdc_write(kp, 11);
@@ -151,9 +252,24 @@ led_set(int red, int green)
 }
 
 static void output_main(void* machtnichts __attribute__((unused))) {
-	uint8_t sr;
+	uint32_t crc;
+	bool ok;
 
 	led_setup();
+	crc_init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	board_config_init();
+	settings_init();
+	spiffs_port_mount();
+	spiffs_port_cache_pages(settings_get_u32(SETTING_CACHE_PAGES,
+	    SPIFFS_PORT_CACHE_PAGES));
+	spiffs_gcd_start();
+	spiffs_checkd_start();
+	if (flash_log_open(&flog, FLASH_PART_LOG) == 0) {
+		flash_log_start(&flog);
+		flog_ok = true;
+	}
         LCD_Init();
         LCD_InitContext(&lcd);
         lcd.fg_color = LCD_COLOR_BLACK;
@@ -163,6 +279,7 @@ static void output_main(void* machtnichts __attribute__((unused))) {
 	    GPIO_Speed_2MHz, GPIO_OType_PP, GPIO_PuPd_NOPULL);
 	pin_set(pin_lcd_bl);
 	usb_cdc_init();
+	rpc_start();
 	Power_As_Input();
 	// gfx bullshit
 	vTaskDelay(250);
@@ -189,8 +306,13 @@ static void output_main(void* machtnichts __attribute__((unused))) {
         lcd.fg_color = LCD_COLOR_BLACK;
         lcd.x = 0;
         lcd.y = 96;
-        sFLASH_ReadSecurityBuffer(&sr, 0x301d, 1);
-        LCD_Printf(&lcd, "SecReg 0x1D=0x%02x", sr);
+        LCD_Printf(&lcd, "SecReg 0x1D=0x%02x", *board_secreg(0x301d, 1));
+        lcd.x = 0;
+        lcd.y = 104;
+        ok = crc_image(&crc) == 0;
+        LCD_Printf(&lcd, "FW %08lx %s", crc, ok ? "ok" : "bad");
+	if (flog_ok)
+		flash_log_append(&flog, LOG_BOOT, &crc, sizeof(crc));
 	for(;;) {
 		led_set(get_red_state(), PTT_Read());
 		vTaskDelay(50);
@@ -0,0 +1,231 @@
+/*
+ * Benchmarks the SPI flash driver, the sector cache and the partition
+ * code against the W25Q emulator.  Times are virtual and deterministic,
+ * so runs can be compared across machines.
+ *
+ * usage: flashbench [-m] [-s seed]
+ *	-m	use datasheet maximum instead of typical timings
+ *	-s	seed for the random access patterns
+ */
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+
+static struct w25q *dev;
+static struct w25q_stats mark_stats;
+static uint64_t mark_now;
+static uint8_t buf[0x10000];
+
+static void
+mark(void)
+{
+	mark_stats = dev->stats;
+	mark_now = dev->now;
+}
+
+static void
+report(const char *name, uint64_t bytes)
+{
+	uint64_t ns = dev->now - mark_now;
+
+	printf("%-28s %10.3f ms %9.1f KiB/s %7llu cmds %7llu polls %5llu erases\n",
+	    name, ns / 1e6, ns ? bytes * 1e9 / 1024 / ns : 0.0,
+	    (unsigned long long)(dev->stats.selects - mark_stats.selects),
+	    (unsigned long long)(dev->stats.status_polls -
+	    mark_stats.status_polls),
+	    (unsigned long long)(dev->stats.erases - mark_stats.erases));
+}
+
+static void
+fill_pattern(uint32_t addr, uint32_t len)
+{
+	uint32_t i, n;
+
+	for (; len > 0; len -= n, addr += n) {
+		n = len > sizeof(buf) ? sizeof(buf) : len;
+		for (i = 0; i < n; i++)
+			buf[i] = (addr + i) * 7 + ((addr + i) >> 8);
+		memcpy(dev->mem + addr, buf, n);
+	}
+}
+
+static void
+bench_reads(uint32_t base)
+{
+	const uint32_t len = 0x40000;
+	uint32_t off, addr;
+	int i;
+
+	mark();
+	for (off = 0; off < len; off += 0x1000)
+		sFLASH_ReadBuffer(buf, base + off, 0x1000);
+	report("read seq 4k direct", len);
+
+	sFLASH_CacheFlush();
+	mark();
+	for (off = 0; off < len; off += 256)
+		sFLASH_CachedRead(buf, base + off, 256);
+	report("read seq 256 cached", len);
+
+	mark();
+	for (i = 0; i < 4096; i++) {
+		addr = base + (rand() % len & ~63);
+		sFLASH_ReadBuffer(buf, addr, 64);
+	}
+	report("read rand 64 direct", 4096 * 64);
+
+	/* Locality like SPIFFS lookups: a few hot sectors, some cold */
+	sFLASH_CacheFlush();
+	mark();
+	for (i = 0; i < 4096; i++) {
+		if (rand() % 4)
+			addr = base + (rand() % 4) * 0x1000 + (rand() % 64) * 64;
+		else
+			addr = base + (rand() % len & ~63);
+		sFLASH_CachedRead(buf, addr, 64);
+	}
+	report("read rand 64 cached", 4096 * 64);
+}
+
+static void
+bench_writes(uint32_t base)
+{
+	const uint32_t len = 0x10000;
+	uint32_t off;
+
+	mark();
+	sFLASH_Erase64KBlock(base);
+	report("erase 64k", len);
+
+	mark();
+	for (off = 0; off < len; off += 0x8000)
+		sFLASH_Erase32KBlock(base + off);
+	report("erase 2x32k", len);
+
+	mark();
+	for (off = 0; off < len; off += 0x1000)
+		sFLASH_EraseSector(base + off);
+	report("erase 16x4k", len);
+
+	memset(buf, 0x5a, sizeof(buf));
+	mark();
+	for (off = 0; off < len; off += 0x8000)
+		sFLASH_WriteBuffer(buf, base + off, 0x8000);
+	report("program 64k pages", len);
+
+	sFLASH_Erase64KBlock(base);
+	mark();
+	for (off = 0; off < len; off += 16)
+		sFLASH_WriteBuffer(buf, base + off, 16);
+	report("program 64k in 16b writes", len);
+
+	/* Like SPIFFS, with bookkeeping between the page programs */
+	sFLASH_Erase64KBlock(base);
+	mark();
+	for (off = 0; off < len; off += 256) {
+		w25q_advance(dev, 200000);
+		sFLASH_WriteBuffer(buf, base + off, 256);
+	}
+	report("program 64k, 200us cpu/page", len);
+}
+
+static void
+bench_parts(void)
+{
+	bool ok;
+
+	mark();
+	flash_part_format();
+	report("part format", 0x1000);
+
+	mark();
+	ok = flash_part_init();
+	report(ok ? "part init (table)" : "part init (DEFAULTS)", 0);
+}
+
+static jmp_buf cut_jmp;
+
+static void
+cut(struct w25q *w, void *arg)
+{
+	/* The MCU browns out too, abandon the driver call */
+	longjmp(cut_jmp, 1);
+}
+
+/* Cuts power during a 64k erase and counts what survived. */
+static void
+bench_power_cut(uint32_t base)
+{
+	uint32_t i, erased = 0;
+
+	fill_pattern(base, 0x10000);
+	/* Nothing left running from the write benches */
+	sFLASH_WaitForWriteEnd();
+	/* WREN, the erase command and address, RDSR, then the first poll */
+	w25q_schedule_cut(dev, 1 + 4 + 1 + 1, cut, NULL);
+	if (setjmp(cut_jmp) == 0)
+		sFLASH_Erase64KBlock(base);
+	w25q_power_on(dev);
+	sFLASH_CacheFlush();
+	for (i = 0; i < 0x10000; i++)
+		if (dev->mem[base + i] == 0xff)
+			erased++;
+	printf("%-28s %u of 65536 bytes erased\n", "power cut in 64k erase",
+	    erased);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct w25q_timing *timing = &w25q_timing_typ;
+	unsigned int seed = 1;
+	uint32_t base;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "ms:")) != -1) {
+		switch (ch) {
+		case 'm':
+			timing = &w25q_timing_max;
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: flashbench [-m] [-s seed]\n");
+			return 1;
+		}
+	}
+	srand(seed);
+	if ((dev = w25q_create(timing)) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	w25q_dev = dev;
+	dev->seed = seed;
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	printf("flash id %06x, %s timing\n", (unsigned)sFLASH_ReadID(),
+	    timing == &w25q_timing_max ? "max" : "typical");
+
+	bench_parts();
+	base = flash_part(FLASH_PART_SPIFFS)->start;
+	fill_pattern(base, 0x40000);
+	bench_reads(base);
+	bench_writes(flash_part(FLASH_PART_STAGING)->start);
+	bench_power_cut(flash_part(FLASH_PART_STAGING)->start);
+
+	printf("total %.3f ms virtual, %llu bytes, %llu ignored commands, "
+	    "max erase count %u\n", dev->now / 1e6,
+	    (unsigned long long)dev->stats.bytes,
+	    (unsigned long long)dev->stats.ignored, w25q_max_erase_count(dev));
+	w25q_destroy(dev);
+	return 0;
+}
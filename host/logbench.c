@@ -0,0 +1,271 @@
+/*
+ * Benchmarks the ring log of flash_log.c against the W25Q emulator:
+ * the append rate with and without idle time to erase ahead, the
+ * latency of single appends, reading back, and the cost of finding the
+ * head and tail at boot.  Times are virtual and deterministic.
+ *
+ * usage: logbench [-m] [-n records] [-l len] [-s seed]
+ *	-m	use datasheet maximum instead of typical timings
+ *	-n	records appended per run, default three times what fits
+ *	-l	record length, default 32
+ *	-s	seed for the seeks
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "flash_log.h"
+
+static struct w25q *dev;
+static struct flash_log flog;
+static uint64_t *lat;
+static uint32_t nrec, reclen = 32;
+
+static int
+by_value(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static void
+fill(uint8_t *buf, uint32_t seq, uint32_t len)
+{
+	uint32_t i;
+
+	for (i = 0; i < len; i++)
+		buf[i] = seq * 7 + i;
+}
+
+static void
+fail(const char *what, uint32_t seq)
+{
+	fprintf(stderr, "logbench: %s failed at record %u\n", what, seq);
+	exit(1);
+}
+
+static void
+format(void)
+{
+	if (flash_log_open(&flog, FLASH_PART_LOG) < 0 ||
+	    flash_log_format(&flog) < 0)
+		fail("format", 0);
+	sFLASH_WaitForWriteEnd();
+}
+
+/*
+ * Appends nrec records.  With "idle", the log erases ahead and the chip
+ * finishes programming between appends, off the clock.
+ */
+static void
+bench_append(const char *name, int idle)
+{
+	struct flash_log_stats st0 = flog.stats;
+	uint8_t buf[FLASH_LOG_MAX];
+	uint64_t t0, busy = 0;
+	uint32_t i;
+
+	if (nrec == 0)
+		return;
+	for (i = 0; i < nrec; i++) {
+		fill(buf, flog.next, reclen);
+		t0 = dev->now;
+		if (flash_log_append(&flog, 1, buf, reclen) < 0)
+			fail("append", i);
+		lat[i] = dev->now - t0;
+		busy += lat[i];
+		if (idle) {
+			while (flash_log_service(&flog) > 0)
+				;
+			sFLASH_WaitForWriteEnd();
+		}
+	}
+	if (!idle) {
+		/* The last program is part of the run */
+		t0 = dev->now;
+		sFLASH_WaitForWriteEnd();
+		busy += dev->now - t0;
+	}
+	qsort(lat, nrec, sizeof(*lat), by_value);
+	printf("%-22s %8.0f rec/s %7.1f KiB/s  p50 %6.1f p99 %6.1f "
+	    "max %7.1f us  %u stalls\n", name, nrec * 1e9 / busy,
+	    (double)nrec * reclen * 1e9 / 1024 / busy, lat[nrec / 2] / 1e3,
+	    lat[nrec - nrec / 100 - 1] / 1e3, lat[nrec - 1] / 1e3,
+	    flog.stats.stalls - st0.stalls);
+}
+
+/* Reads everything back, checking every record */
+static void
+bench_read(void)
+{
+	struct flash_log_cursor c;
+	uint8_t buf[FLASH_LOG_MAX], want[FLASH_LOG_MAX];
+	uint64_t t0 = dev->now;
+	uint32_t n = 0, seq;
+	uint16_t type;
+	int len;
+
+	flash_log_rewind(&flog, &c);
+	seq = c.seq;
+	while ((len = flash_log_read(&flog, &c, &type, buf, sizeof(buf))) > 0) {
+		fill(want, seq, reclen);
+		if (c.seq != seq + 1 || (uint32_t)len != reclen ||
+		    memcmp(buf, want, len) != 0)
+			fail("read", seq);
+		seq++;
+		n++;
+	}
+	if (len < 0 || seq != flog.next)
+		fail("read to the end", seq);
+	printf("%-22s %8.0f rec/s %7.1f KiB/s  %u records from %u\n",
+	    "read back", n * 1e9 / (dev->now - t0),
+	    (double)n * reclen * 1e9 / 1024 / (dev->now - t0), n,
+	    flash_log_first(&flog));
+}
+
+static void
+bench_seek(void)
+{
+	struct flash_log_cursor c;
+	uint8_t buf[FLASH_LOG_MAX];
+	uint64_t t0 = dev->now;
+	uint32_t first = flash_log_first(&flog), i, seq;
+	uint16_t type;
+
+	if (flog.next == first)
+		return;
+	for (i = 0; i < 1000; i++) {
+		seq = first + rand() % (flog.next - first);
+		flash_log_seek(&flog, &c, seq);
+		if (flash_log_read(&flog, &c, &type, buf, sizeof(buf)) <= 0 ||
+		    c.seq != seq + 1)
+			fail("seek", seq);
+	}
+	printf("%-22s %8.1f us per seek and read\n", "seek",
+	    (dev->now - t0) / 1e3 / 1000);
+}
+
+/* Reopens the log as after a reboot and checks it found the same ends */
+static void
+bench_open(const char *name)
+{
+	struct flash_log was = flog;
+	uint64_t t0, cmds;
+
+	sFLASH_WaitForWriteEnd();
+	t0 = dev->now;
+	cmds = dev->stats.selects;
+	if (flash_log_open(&flog, FLASH_PART_LOG) < 0)
+		fail("open", was.next);
+	if (flog.head != was.head || flog.head_seq != was.head_seq ||
+	    flog.count != was.count || flog.next != was.next ||
+	    (flog.head_off != was.head_off && flog.count > 0))
+		fail("recovery", was.next);
+	printf("%-22s %8.3f ms %5llu cmds  %3u of %u sectors in use\n", name,
+	    (dev->now - t0) / 1e6,
+	    (unsigned long long)(dev->stats.selects - cmds), flog.count,
+	    flog.sectors);
+}
+
+/* What finding the ends would cost reading every sector header */
+static void
+bench_scan(void)
+{
+	struct flash_log_sector h;
+	uint64_t t0 = dev->now;
+	uint32_t i;
+
+	for (i = 0; i < flog.sectors; i++)
+		flash_part_read(flog.part, i * FLASH_LOG_SECTOR, &h, sizeof(h));
+	printf("%-22s %8.3f ms\n", "linear header scan",
+	    (dev->now - t0) / 1e6);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct w25q_timing *timing = &w25q_timing_typ;
+	unsigned int seed = 1;
+	uint32_t per_sector, fits;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "l:mn:s:")) != -1) {
+		switch (ch) {
+		case 'l':
+			reclen = strtoul(optarg, NULL, 0);
+			break;
+		case 'm':
+			timing = &w25q_timing_max;
+			break;
+		case 'n':
+			nrec = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: logbench [-m] [-n records] "
+			    "[-l len] [-s seed]\n");
+			return 1;
+		}
+	}
+	if (reclen == 0 || reclen > FLASH_LOG_MAX) {
+		fprintf(stderr, "logbench: length 1 to %u\n",
+		    (unsigned)FLASH_LOG_MAX);
+		return 1;
+	}
+	srand(seed);
+	if ((dev = w25q_create(timing)) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	w25q_dev = dev;
+	dev->seed = seed;
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	format();
+	per_sector = (FLASH_LOG_SECTOR - sizeof(struct flash_log_sector)) /
+	    ((sizeof(struct flash_log_rec) + reclen + 3) & ~3);
+	fits = (flog.sectors - FLASH_LOG_AHEAD) * per_sector;
+	if (nrec == 0)
+		nrec = 3 * fits;
+	if ((lat = calloc(nrec > fits ? nrec : fits, sizeof(*lat))) == NULL) {
+		perror("calloc");
+		return 1;
+	}
+	printf("%u sectors, %u records of %u bytes, %s timing\n", flog.sectors,
+	    nrec, reclen, timing == &w25q_timing_max ? "max" : "typical");
+
+	bench_open("open empty");
+	bench_append("append, idle between", 1);
+	bench_append("append back to back", 0);
+	bench_read();
+	bench_seek();
+	bench_open("open wrapped");
+	bench_scan();
+
+	/* Part way through the first pass, and just before wrapping */
+	format();
+	nrec = nrec / 8 > fits ? fits : nrec / 8;
+	bench_append("append, first pass", 1);
+	bench_open("open first pass");
+	nrec = flog.count + FLASH_LOG_AHEAD < flog.sectors ?
+	    (flog.sectors - flog.count - FLASH_LOG_AHEAD) * per_sector : 0;
+	bench_append("append, to the end", 1);
+	bench_open("open full");
+	bench_read();
+
+	printf("total %.3f ms virtual, max erase count %u\n", dev->now / 1e6,
+	    w25q_max_erase_count(dev));
+	w25q_destroy(dev);
+	free(lat);
+	return 0;
+}
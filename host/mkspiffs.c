@@ -0,0 +1,548 @@
+/*
+ * Builds, lists and unpacks images of the SPIFFS partition.
+ *
+ * SPIFFS is compiled here with the firmware's own spiffs_config.h, so the
+ * geometry (the FLASH_PART_SPIFFS partition, 64k blocks, 256 byte pages)
+ * and the on-flash format are exactly the radio's.  The file system is
+ * built on the W25Q emulator and the partition is then saved as is,
+ * ready to be written at FLASH_PART_SPIFFS_ADDR.
+ *
+ * SPIFFS is flat, folders are kept the MTP way: a folder is an empty
+ * object of format association and every object's MTP_MetaData.parent
+ * holds the object id of its folder, 0 for the root.  Names must be
+ * unique over the whole image and shorter than SPIFFS_OBJ_NAME_LEN.
+ *
+ * The radio trusts its mount snapshot while it matches the flash, so an
+ * image written behind its back needs the FLASH_PART_SPIFFS_SNAP
+ * partition written too, either erased or with the snapshot -s saves.
+ *
+ * usage: mkspiffs -c dir [-z] [-s snapshot] image
+ *	  mkspiffs -l [-v] image
+ *	  mkspiffs -u dir image
+ *	-c	pack the tree under dir into image
+ *	-z	store the files compressed where that saves space, see
+ *		spiffs_lz.h
+ *	-s	also save the mount snapshot of the new image
+ *	-l	list the files in image and their metadata, -v for all of it
+ *	-u	unpack image into dir
+ */
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "spiffs_lz.h"
+
+/* MTP object formats and association types */
+#define MTP_FMT_UNDEFINED	0x3000
+#define MTP_FMT_ASSOCIATION	0x3001
+#define MTP_FMT_TEXT		0x3004
+#define MTP_FMT_WAV		0x3008
+#define MTP_FMT_BMP		0x3804
+#define MTP_FMT_PNG		0x380b
+#define MTP_ASSOC_FOLDER	0x0001
+#define MTP_STORAGE_ID		0x00010001
+
+#define MAX_DEPTH		16
+
+struct obj {
+	spiffs_obj_id		id;
+	u32_t			size;
+	char			name[SPIFFS_OBJ_NAME_LEN];
+	struct MTP_MetaData	meta;
+};
+
+static spiffs fs;
+static u8_t work[2 * 256];
+static u8_t fds[4 * sizeof(spiffs_fd)];
+static u8_t cache[sizeof(spiffs_cache) + 8 * (sizeof(spiffs_cache_page) + 256)];
+static u8_t buf[4096];
+static u32_t seq;
+static spiffs_lz lz;
+static int compress;
+static u32_t data_bytes, stored_bytes;
+static struct obj *objs;
+static int nobjs;
+
+static const struct {
+	const char	*ext;
+	u16_t		fmt;
+} formats[] = {
+	{ ".txt", MTP_FMT_TEXT },
+	{ ".csv", MTP_FMT_TEXT },
+	{ ".wav", MTP_FMT_WAV },
+	{ ".bmp", MTP_FMT_BMP },
+	{ ".png", MTP_FMT_PNG },
+};
+
+/*
+ * {HAL, the same as spiffs_port.c}
+ */
+
+static s32_t
+hal_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	sFLASH_CachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_write(u32_t addr, u32_t size, u8_t *src)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	sFLASH_WriteBuffer(src, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_erase(u32_t addr, u32_t size)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	switch (size) {
+	case 0x1000:
+		sFLASH_EraseSector(addr);
+		return SPIFFS_OK;
+	case 0x8000:
+		sFLASH_Erase32KBlock(addr);
+		return SPIFFS_OK;
+	case 0x10000:
+		sFLASH_Erase64KBlock(addr);
+		return SPIFFS_OK;
+	}
+	return -1;
+}
+
+static s32_t
+mount(void)
+{
+	spiffs_config cfg;
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.hal_read_f = hal_read;
+	cfg.hal_write_f = hal_write;
+	cfg.hal_erase_f = hal_erase;
+	return SPIFFS_mount(&fs, &cfg, work, fds, sizeof(fds), cache,
+	    sizeof(cache), NULL);
+}
+
+static void
+fail(const char *what, const char *path)
+{
+	if (SPIFFS_errno(&fs) != SPIFFS_OK)
+		fprintf(stderr, "mkspiffs: %s %s: spiffs error %d\n", what,
+		    path, (int)SPIFFS_errno(&fs));
+	else
+		fprintf(stderr, "mkspiffs: %s %s: %s\n", what, path,
+		    strerror(errno));
+	exit(1);
+}
+
+/*
+ * {Packing}
+ */
+
+static u16_t
+format_of(const char *name)
+{
+	size_t i, n = strlen(name), e;
+
+	for (i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+		e = strlen(formats[i].ext);
+		if (n > e && strcasecmp(name + n - e, formats[i].ext) == 0)
+			return formats[i].fmt;
+	}
+	return MTP_FMT_UNDEFINED;
+}
+
+static FILE *
+open_host(const char *path)
+{
+	FILE *f;
+
+	if ((f = fopen(path, "rb")) == NULL)
+		fail("open", path);
+	return f;
+}
+
+/* Creates "name" in folder "parent" from host file "path", or a folder. */
+static spiffs_obj_id
+add(const char *path, const char *name, u32_t parent, int folder)
+{
+	struct MTP_MetaData m;
+	spiffs_stat st;
+	spiffs_file fh;
+	FILE *f;
+	size_t n;
+	int stored = 0;
+
+	if (strlen(name) >= SPIFFS_OBJ_NAME_LEN) {
+		fprintf(stderr, "mkspiffs: %s: name longer than %d\n", path,
+		    SPIFFS_OBJ_NAME_LEN - 1);
+		exit(1);
+	}
+	fh = SPIFFS_open(&fs, name,
+	    SPIFFS_O_CREAT | SPIFFS_O_EXCL | SPIFFS_O_WRONLY, 0);
+	if (fh < 0) {
+		if (SPIFFS_errno(&fs) == SPIFFS_ERR_FILE_EXISTS) {
+			fprintf(stderr, "mkspiffs: %s: name %s already in "
+			    "the image\n", path, name);
+			exit(1);
+		}
+		fail("create", path);
+	}
+	memset(&m, 0, sizeof(m));
+	m.str_id = MTP_STORAGE_ID;
+	m.obj_fmt = folder ? MTP_FMT_ASSOCIATION : format_of(name);
+	m.parent = parent;
+	m.atype = folder ? MTP_ASSOC_FOLDER : 0;
+	m.seq = ++seq;
+
+	if (!folder && compress) {
+		/* Sets the csize on close */
+		SPIFFS_close(&fs, fh);
+		if (spiffs_lz_create(&lz, &fs, name, &m) < 0)
+			fail("create", path);
+		f = open_host(path);
+		while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+			if (spiffs_lz_write(&lz, buf, n) != (s32_t)n)
+				fail("write", path);
+		if (ferror(f))
+			fail("read", path);
+		fclose(f);
+		if (spiffs_lz_close(&lz) < 0)
+			fail("close", path);
+		m.csize = spiffs_lz_size(&lz);
+		if (SPIFFS_stat(&fs, name, &st) < 0)
+			fail("stat", path);
+		/*
+		 * spiffs_lz only sees the first block, here the whole file
+		 * is known: keep it as it is unless compressing saved space.
+		 */
+		if (!lz.lz || st.size < m.csize)
+			stored = 1;
+		else if ((fh = SPIFFS_open(&fs, name,
+		    SPIFFS_O_TRUNC | SPIFFS_O_WRONLY, 0)) < 0)
+			fail("create", path);
+	}
+	if (!stored) {
+		if (!folder) {
+			f = open_host(path);
+			while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+				if (SPIFFS_write(&fs, fh, buf, n) != (s32_t)n)
+					fail("write", path);
+			if (ferror(f))
+				fail("read", path);
+			fclose(f);
+		}
+		if (SPIFFS_fstat(&fs, fh, &st) < 0)
+			fail("stat", path);
+		m.csize = st.size;
+		if (SPIFFS_fupdate_meta(&fs, fh, &m) < 0 ||
+		    SPIFFS_close(&fs, fh) < 0)
+			fail("close", path);
+	}
+	if (SPIFFS_stat(&fs, name, &st) < 0)
+		fail("stat", path);
+	data_bytes += m.csize;
+	stored_bytes += st.size;
+	return st.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
+}
+
+static int
+skip_dots(const struct dirent *d)
+{
+	return d->d_name[0] != '.';
+}
+
+/* Packs the tree under "dir" into folder "parent", in name order. */
+static void
+pack(const char *dir, u32_t parent, int depth)
+{
+	struct dirent **ents;
+	struct stat sb;
+	char path[1024];
+	int i, n;
+
+	if (depth > MAX_DEPTH) {
+		fprintf(stderr, "mkspiffs: %s: nested too deep\n", dir);
+		exit(1);
+	}
+	if ((n = scandir(dir, &ents, skip_dots, alphasort)) < 0)
+		fail("scan", dir);
+	for (i = 0; i < n; i++) {
+		snprintf(path, sizeof(path), "%s/%s", dir, ents[i]->d_name);
+		if (stat(path, &sb) < 0)
+			fail("stat", path);
+		if (S_ISDIR(sb.st_mode))
+			pack(path, add(path, ents[i]->d_name, parent, 1),
+			    depth + 1);
+		else if (S_ISREG(sb.st_mode))
+			(void)add(path, ents[i]->d_name, parent, 0);
+		free(ents[i]);
+	}
+	free(ents);
+}
+
+/*
+ * {Reading an image}
+ */
+
+static void
+load(const char *image)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+	struct stat sb;
+
+	if (stat(image, &sb) < 0)
+		fail("stat", image);
+	if ((u32_t)sb.st_size != p->size) {
+		fprintf(stderr, "mkspiffs: %s: %lld bytes, the partition "
+		    "is %u\n", image, (long long)sb.st_size, p->size);
+		exit(1);
+	}
+	if (w25q_load(w25q_dev, image, p->start) < 0)
+		fail("load", image);
+	sFLASH_CacheFlush();
+	if (mount() < 0)
+		fail("mount", image);
+}
+
+static void
+collect(void)
+{
+	struct spiffs_dirent de;
+	spiffs_DIR d;
+	int max = 0;
+
+	if (SPIFFS_opendir(&fs, "/", &d) == NULL)
+		fail("list", "/");
+	while (SPIFFS_readdir(&d, &de) != NULL) {
+		if (nobjs == max) {
+			max = max ? 2 * max : 64;
+			if ((objs = realloc(objs, max * sizeof(*objs))) == NULL)
+				fail("list", "/");
+		}
+		objs[nobjs].id = de.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
+		objs[nobjs].size = de.size;
+		memcpy(objs[nobjs].name, de.name, SPIFFS_OBJ_NAME_LEN);
+		objs[nobjs].name[SPIFFS_OBJ_NAME_LEN - 1] = 0;
+		memcpy(&objs[nobjs].meta, de.meta, sizeof(objs[0].meta));
+		nobjs++;
+	}
+	SPIFFS_closedir(&d);
+}
+
+static struct obj *
+find(u32_t id)
+{
+	int i;
+
+	for (i = 0; i < nobjs; i++)
+		if (objs[i].id == id)
+			return &objs[i];
+	return NULL;
+}
+
+static int
+is_folder(const struct obj *o)
+{
+	return o->meta.obj_fmt == MTP_FMT_ASSOCIATION;
+}
+
+/* Path of "o" from the root, through folders only and loop safe. */
+static void
+path_of(const struct obj *o, char *s, size_t len)
+{
+	const struct obj *chain[MAX_DEPTH + 1], *p;
+	int n = 0;
+
+	chain[n++] = o;
+	while (n <= MAX_DEPTH && (p = find(chain[n - 1]->meta.parent)) &&
+	    is_folder(p) && p != o)
+		chain[n++] = p;
+	*s = 0;
+	while (n-- > 0) {
+		strncat(s, "/", len - strlen(s) - 1);
+		strncat(s, chain[n]->name, len - strlen(s) - 1);
+	}
+}
+
+static void
+list(int verbose)
+{
+	const struct obj *o;
+	const struct MTP_MetaData *m;
+	char path[MAX_DEPTH * SPIFFS_OBJ_NAME_LEN + 2];
+	u32_t total, used;
+	int i, j;
+
+	printf("   id parent    fmt perm     size    csize    seq path\n");
+	for (i = 0; i < nobjs; i++) {
+		o = &objs[i];
+		m = &o->meta;
+		path_of(o, path, sizeof(path));
+		printf("%5u %6u 0x%04x %4x %8u %8u %6u %s%s\n", o->id,
+		    m->parent, m->obj_fmt, m->perm, o->size, m->csize,
+		    m->seq, path, is_folder(o) ? "/" : "");
+		data_bytes += m->str_id != 0xffffffff ? m->csize : o->size;
+		stored_bytes += o->size;
+		if (!verbose)
+			continue;
+		printf("\tstorage 0x%08x thumb 0x%04x %u %ux%u "
+		    "image %ux%u depth %u\n"
+		    "\tassociation 0x%04x 0x%08x uid ", m->str_id, m->tfmt,
+		    m->tcsize, m->twidth, m->theight, m->width, m->height,
+		    m->depth, m->atype, m->adesc);
+		for (j = 0; j < 16; j++)
+			printf("%02x", m->uid[j]);
+		printf("\n");
+	}
+	if (SPIFFS_info(&fs, &total, &used) == SPIFFS_OK)
+		printf("%d objects, %u bytes stored in %u, %u of %u bytes "
+		    "used\n", nobjs, data_bytes, stored_bytes, used, total);
+}
+
+static void
+unpack(const char *dir)
+{
+	const struct obj *o;
+	char rel[MAX_DEPTH * SPIFFS_OBJ_NAME_LEN + 2], path[1024];
+	FILE *f;
+	s32_t n;
+	int i;
+
+	if (mkdir(dir, 0777) < 0 && errno != EEXIST)
+		fail("mkdir", dir);
+	/* Sorted by sequence, folders come before what is in them */
+	for (i = 0; i < nobjs; i++) {
+		o = &objs[i];
+		path_of(o, rel, sizeof(rel));
+		snprintf(path, sizeof(path), "%s%s", dir, rel);
+		if (is_folder(o)) {
+			if (mkdir(path, 0777) < 0 && errno != EEXIST)
+				fail("mkdir", path);
+			continue;
+		}
+		/* Compressed files come out decompressed */
+		if (spiffs_lz_open(&lz, &fs, o->name) < 0)
+			fail("open", o->name);
+		if ((f = fopen(path, "wb")) == NULL)
+			fail("create", path);
+		while ((n = spiffs_lz_read(&lz, buf, sizeof(buf))) > 0)
+			if (fwrite(buf, 1, n, f) != (size_t)n)
+				fail("write", path);
+		if (n < 0 && n != SPIFFS_ERR_END_OF_OBJECT &&
+		    SPIFFS_errno(&fs) != SPIFFS_ERR_END_OF_OBJECT)
+			fail("read", o->name);
+		if (fclose(f) != 0)
+			fail("write", path);
+		spiffs_lz_close(&lz);
+	}
+}
+
+static int
+by_seq(const void *a, const void *b)
+{
+	const struct obj *x = a, *y = b;
+
+	return x->meta.seq < y->meta.seq ? -1 : x->meta.seq > y->meta.seq;
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: mkspiffs -c dir [-z] [-s snapshot] image\n"
+	    "       mkspiffs -l [-v] image\n"
+	    "       mkspiffs -u dir image\n");
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct flash_part *p, *snap;
+	const char *dir = NULL, *snapshot = NULL, *image;
+	int ch, mode = 0, verbose = 0;
+
+	while ((ch = getopt(argc, argv, "c:ls:u:vz")) != -1) {
+		switch (ch) {
+		case 'c':
+		case 'u':
+			dir = optarg;
+			/* FALLTHROUGH */
+		case 'l':
+			if (mode)
+				usage();
+			mode = ch;
+			break;
+		case 's':
+			snapshot = optarg;
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		case 'z':
+			compress = 1;
+			break;
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if (argc != 1 || mode == 0 || ((snapshot || compress) && mode != 'c'))
+		usage();
+	image = argv[0];
+
+	if (w25q_create(&w25q_timing_typ) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	p = flash_part(FLASH_PART_SPIFFS);
+	snap = flash_part(FLASH_PART_SPIFFS_SNAP);
+
+	if (mode == 'c') {
+		(void)mount();
+		SPIFFS_unmount(&fs);
+		if (SPIFFS_format(&fs) < 0 || mount() < 0)
+			fail("format", image);
+		pack(dir, 0, 0);
+		printf("%u bytes stored in %u\n", data_bytes, stored_bytes);
+		/* Saves the snapshot */
+		SPIFFS_unmount(&fs);
+		sFLASH_WaitForWriteEnd();
+		if (w25q_save(w25q_dev, image, p->start, p->size) < 0)
+			fail("save", image);
+		if (snapshot && w25q_save(w25q_dev, snapshot, snap->start,
+		    snap->size) < 0)
+			fail("save", snapshot);
+	} else {
+		load(image);
+		collect();
+		qsort(objs, nobjs, sizeof(*objs), by_seq);
+		if (mode == 'l')
+			list(verbose);
+		else
+			unpack(dir);
+		SPIFFS_unmount(&fs);
+	}
+	w25q_destroy(w25q_dev);
+	return 0;
+}
@@ -0,0 +1,399 @@
+/*
+ * Serves the firmware's framed requests (hw/rpc.c) on a pseudo terminal,
+ * over the W25Q emulator and a freshly formatted SPIFFS, so that
+ * md380tools/tytrpc.py and rpcbench.py can be run without a radio.
+ *
+ * The pty stands in for the USB serial port.  Each direction is a delay
+ * line: bytes come out "latency" after they went in and no faster than
+ * "rate", roughly what full speed USB does with its 1 ms frames.  The
+ * radio's side of the link is a 4k pipe, as small as the CDC rings, so
+ * a host that stops reading holds up the responses as it would there.
+ *
+ * -t writes a line of text through usb_cdc_write_timeout() every so many
+ * milliseconds from another thread, the way the firmware's log does.
+ * Writes are serialised as in usbd_cdc_vcp.c, so the text lands between
+ * response frames and the host must drop it.
+ *
+ * usage: rpcsim [-l latency_us] [-r bytes_per_s] [-t text_ms]
+ *	The name of the pty is printed on stdout.  The pty stays open
+ *	for the next host until the sim is killed.
+ */
+
+#define _GNU_SOURCE
+#include <sys/types.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "controls.h"
+#include "lcd_driver.h"
+#include "usb_cdc.h"
+#include "rpc.h"
+
+struct chunk {
+	struct chunk	*next;
+	double		 t;		/* When it went in */
+	size_t		 len;
+	char		 buf[];
+};
+
+struct line {
+	int		 src, dst;
+	struct chunk	*head, **tail;
+	pthread_mutex_t	 m;
+	pthread_cond_t	 c;
+};
+
+spiffs spiffs_fs;
+static u8_t work[2 * 256];
+static u8_t fds[8 * sizeof(spiffs_fd)];
+static u8_t cache[sizeof(spiffs_cache) + 8 * (sizeof(spiffs_cache_page) + 256)];
+
+static long latency_us = 1000, rate = 1000000, text_ms;
+static struct line up, down;
+static int rx_fd, tx_fd;
+static pthread_mutex_t tx_lock = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long rx_bytes, tx_bytes;
+static void (*task_fn)(void *);
+
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void
+done(const char *why)
+{
+	fprintf(stderr, "rpcsim: %s, %lu bytes in, %lu out\n", why, rx_bytes,
+	    tx_bytes);
+	exit(0);
+}
+
+/*
+ * {Delay lines}
+ */
+
+static void *
+line_in(void *arg)
+{
+	struct line *l = arg;
+	struct chunk *c;
+	char buf[4096];
+	ssize_t n;
+
+	while ((n = read(l->src, buf, sizeof(buf))) > 0) {
+		if ((c = malloc(sizeof(*c) + n)) == NULL)
+			abort();
+		c->next = NULL;
+		c->t = now();
+		c->len = n;
+		memcpy(c->buf, buf, n);
+		pthread_mutex_lock(&l->m);
+		*l->tail = c;
+		l->tail = &c->next;
+		pthread_cond_signal(&l->c);
+		pthread_mutex_unlock(&l->m);
+	}
+	done("pty closed");
+	return NULL;
+}
+
+static void *
+line_out(void *arg)
+{
+	struct line *l = arg;
+	struct chunk *c;
+	double busy = 0, d;
+
+	for (;;) {
+		pthread_mutex_lock(&l->m);
+		while (l->head == NULL)
+			pthread_cond_wait(&l->c, &l->m);
+		c = l->head;
+		if ((l->head = c->next) == NULL)
+			l->tail = &l->head;
+		pthread_mutex_unlock(&l->m);
+		if (busy < c->t + latency_us / 1e6)
+			busy = c->t + latency_us / 1e6;
+		busy += (double)c->len / rate;
+		if ((d = busy - now()) > 0)
+			usleep(d * 1e6);
+		if (write(l->dst, c->buf, c->len) != (ssize_t)c->len)
+			done("write failed");
+		free(c);
+	}
+	return NULL;
+}
+
+static void
+line_start(struct line *l, int src, int dst)
+{
+	pthread_t t;
+
+	l->src = src;
+	l->dst = dst;
+	l->head = NULL;
+	l->tail = &l->head;
+	pthread_mutex_init(&l->m, NULL);
+	pthread_cond_init(&l->c, NULL);
+	if (pthread_create(&t, NULL, line_in, l) != 0 ||
+	    pthread_create(&t, NULL, line_out, l) != 0)
+		abort();
+}
+
+/*
+ * {What rpc.c calls}
+ */
+
+TickType_t
+xTaskGetTickCount(void)
+{
+	return now() * 1000;
+}
+
+size_t
+xPortGetFreeHeapSize(void)
+{
+	return 0;
+}
+
+BaseType_t
+xTaskCreate(void (*fn)(void *), const char *name, uint16_t stack, void *arg,
+    unsigned prio, TaskHandle_t *h)
+{
+	(void)name;
+	(void)stack;
+	(void)arg;
+	(void)prio;
+	task_fn = fn;
+	*h = &task_fn;
+	return pdPASS;
+}
+
+uint16_t VOL_Read(void)		{ return 0; }
+uint16_t BATT_Read(void)	{ return 0; }
+uint16_t BATT2_Read(void)	{ return 0; }
+uint16_t Temp_Read(void)	{ return 0; }
+uint8_t Encoder_Read(void)	{ return 0; }
+uint8_t PTT_Read(void)		{ return 0; }
+
+/* A gradient, so that a screen dump shows which way round it came back */
+int
+LCD_ReadRGB(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *buf)
+{
+	uint16_t c;
+	int i, j;
+
+	for (j = 0; j < h; j++)
+		for (i = 0; i < w; i++) {
+			c = ((x + i) * 31 / 159) << 11 | ((y + j) * 63 / 127) << 5;
+			*buf++ = c >> 8;
+			*buf++ = c;
+		}
+	return w * h;
+}
+
+ssize_t
+usb_cdc_read_some(void *buf, size_t len, uint32_t timeout)
+{
+	ssize_t n;
+
+	(void)timeout;
+	if ((n = read(rx_fd, buf, len)) <= 0)
+		done("link down");
+	rx_bytes += n;
+	return n;
+}
+
+ssize_t
+usb_cdc_write_timeout(const void *buf, size_t len, uint32_t timeout)
+{
+	size_t off;
+	ssize_t n;
+
+	(void)timeout;
+	pthread_mutex_lock(&tx_lock);
+	for (off = 0; off < len; off += n)
+		if ((n = write(tx_fd, (const char *)buf + off, len - off)) <= 0)
+			break;
+	tx_bytes += off;
+	pthread_mutex_unlock(&tx_lock);
+	return off;
+}
+
+static void *
+text_main(void *arg)
+{
+	char line[64];
+	unsigned long i;
+	int n;
+
+	(void)arg;
+	for (i = 0;; i++) {
+		usleep(text_ms * 1000);
+		n = snprintf(line, sizeof(line), "log line %lu\r\n", i);
+		usb_cdc_write_timeout(line, n, 0);
+	}
+	return NULL;
+}
+
+/*
+ * {HAL, the same as spiffs_port.c}
+ */
+
+static s32_t
+hal_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	sFLASH_CachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_write(u32_t addr, u32_t size, u8_t *src)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	sFLASH_WriteBuffer(src, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_erase(u32_t addr, u32_t size)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	switch (size) {
+	case 0x1000:
+		sFLASH_EraseSector(addr);
+		return SPIFFS_OK;
+	case 0x8000:
+		sFLASH_Erase32KBlock(addr);
+		return SPIFFS_OK;
+	case 0x10000:
+		sFLASH_Erase64KBlock(addr);
+		return SPIFFS_OK;
+	}
+	return -1;
+}
+
+static s32_t
+mount(void)
+{
+	spiffs_config cfg;
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.hal_read_f = hal_read;
+	cfg.hal_write_f = hal_write;
+	cfg.hal_erase_f = hal_erase;
+	return SPIFFS_mount(&spiffs_fs, &cfg, work, fds, sizeof(fds), cache,
+	    sizeof(cache), NULL);
+}
+
+static int
+raw(int fd)
+{
+	struct termios t;
+
+	if (tcgetattr(fd, &t) < 0)
+		return -1;
+	cfmakeraw(&t);
+	return tcsetattr(fd, TCSANOW, &t);
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: rpcsim [-l latency_us] [-r bytes_per_s] [-t text_ms]\n");
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	int ch, pty, slave, rx[2], tx[2];
+	pthread_t t;
+
+	while ((ch = getopt(argc, argv, "l:r:t:")) != -1) {
+		switch (ch) {
+		case 'l':
+			latency_us = atol(optarg);
+			break;
+		case 'r':
+			rate = atol(optarg);
+			break;
+		case 't':
+			text_ms = atol(optarg);
+			break;
+		default:
+			usage();
+		}
+	}
+	if (optind != argc || latency_us < 0 || rate <= 0 || text_ms < 0)
+		usage();
+
+	if (w25q_create(&w25q_timing_typ) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	(void)mount();
+	SPIFFS_unmount(&spiffs_fs);
+	if (SPIFFS_format(&spiffs_fs) < 0 || mount() < 0) {
+		fprintf(stderr, "rpcsim: format: spiffs error %d\n",
+		    (int)SPIFFS_errno(&spiffs_fs));
+		return 1;
+	}
+
+	if ((pty = posix_openpt(O_RDWR | O_NOCTTY)) < 0 || grantpt(pty) < 0 ||
+	    unlockpt(pty) < 0 || raw(pty) < 0) {
+		perror("rpcsim: pty");
+		return 1;
+	}
+	/* Held open so that reads do not fail before the host opens it */
+	if ((slave = open(ptsname(pty), O_RDWR | O_NOCTTY)) < 0 ||
+	    raw(slave) < 0) {
+		perror(ptsname(pty));
+		return 1;
+	}
+	if (pipe(rx) < 0 || pipe(tx) < 0) {
+		perror("rpcsim: pipe");
+		return 1;
+	}
+	(void)fcntl(tx[1], F_SETPIPE_SZ, 4096);
+	rx_fd = rx[0];
+	tx_fd = tx[1];
+	line_start(&up, pty, rx[1]);
+	line_start(&down, tx[0], pty);
+	if (text_ms > 0 && pthread_create(&t, NULL, text_main, NULL) != 0)
+		abort();
+	printf("%s\n", ptsname(pty));
+	fflush(stdout);
+
+	rpc_start();
+	task_fn(NULL);
+	return 0;
+}
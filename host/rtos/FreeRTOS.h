@@ -0,0 +1,31 @@
+#ifndef _RTOS_FREERTOS_H_
+#define _RTOS_FREERTOS_H_
+
+/*
+ * Just enough of FreeRTOS for rpc.c to build on the host, see rpcsim.c.
+ * The rpc task runs on the main thread and ticks are milliseconds.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t	TickType_t;
+typedef long		BaseType_t;
+typedef void		*TaskHandle_t;
+typedef void		*QueueHandle_t;
+typedef void		*SemaphoreHandle_t;
+
+#define portMAX_DELAY		0xffffffffu
+#define portTICK_PERIOD_MS	1
+#define pdMS_TO_TICKS(ms)	(ms)
+#define pdPASS			1
+
+#define taskENTER_CRITICAL()	do { } while (0)
+#define taskEXIT_CRITICAL()	do { } while (0)
+
+TickType_t xTaskGetTickCount(void);
+size_t xPortGetFreeHeapSize(void);
+BaseType_t xTaskCreate(void (*)(void *), const char *, uint16_t, void *,
+    unsigned, TaskHandle_t *);
+
+#endif /* _RTOS_FREERTOS_H_ */
@@ -0,0 +1 @@
+/* Declared in FreeRTOS.h, see there */
@@ -0,0 +1,37 @@
+#ifndef _SPIFFS_HOST_H_
+#define _SPIFFS_HOST_H_
+
+#include <stdint.h>
+
+/*
+ * Forced into the host build of SPIFFS with -include.  The geometry comes
+ * from the mount config instead of the singleton defines, and the GC
+ * weights are variables, so spiffsbench can sweep both without being
+ * rebuilt.
+ */
+
+#define SPIFFS_SINGLETON		0
+#define SPIFFS_BUFFER_HELP		1
+
+/* Room to merge header and data for pages of up to 1k */
+#define SPIFFS_COPY_BUFFER_STACK	1024
+
+extern int32_t spiffs_gc_w_delet;
+extern int32_t spiffs_gc_w_used;
+extern int32_t spiffs_gc_w_erase_age;
+
+#define SPIFFS_GC_HEUR_W_DELET		spiffs_gc_w_delet
+#define SPIFFS_GC_HEUR_W_USED		spiffs_gc_w_used
+#define SPIFFS_GC_HEUR_W_ERASE_AGE	spiffs_gc_w_erase_age
+
+/*
+ * spiffsfuzz counts the lock: the firmware's mutex is not recursive, so
+ * taking it twice or returning with it held hangs the radio.
+ */
+#ifdef SPIFFS_HOST_LOCK_CHECK
+void spiffs_host_lock(int);
+#define SPIFFS_LOCK(fs)			spiffs_host_lock(1)
+#define SPIFFS_UNLOCK(fs)		spiffs_host_lock(-1)
+#endif
+
+#endif
@@ -0,0 +1,738 @@
+/*
+ * Runs SPIFFS workloads on the W25Q emulator and sweeps the file system
+ * configuration: logical page and block size, cache pages, file
+ * descriptors and the GC weights.  For every configuration and workload
+ * it formats the SPIFFS partition, fills it with static files, replays
+ * the workload and reports throughput, per operation latency, erases,
+ * garbage collections, the time to mount afterwards and the RAM the
+ * configuration needs.
+ *
+ * Times are the flash's virtual time only.  CPU time spent in SPIFFS is
+ * not modelled, so configurations that trade flash accesses for more
+ * searching in RAM look slightly better here than on the radio.
+ *
+ * usage: spiffsbench [-kmu] [-s seed] [-n ops] [-F fill%] [-w workloads]
+ *	  [-p pages] [-b blocks] [-c cache pages] [-f fds] [-g weights]
+ *	-k	also time SPIFFS_check against SPIFFS_check_step after the run
+ *	-m	use datasheet maximum instead of typical timings
+ *	-u	read around the sector cache, to tell its share of the times
+ *		from SPIFFS's own
+ *	-n	operations per workload, default per workload
+ *	-F	percentage of the file system filled before the workload
+ *	-w	comma separated list of config, log, db, asset, stream
+ *	-p, -b, -c, -f
+ *		comma separated lists of values to sweep
+ *	-g	comma separated list of delete:used:age GC weights
+ *
+ * The defaults are the firmware configuration, for example
+ *	spiffsbench -p 256,512 -b 4096,32768,65536 -c 2,8,16
+ *	spiffsbench -w log -g 5:-1:50,10:-1:50,5:-1:0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+
+#define MAX_LIST	16
+
+int32_t spiffs_gc_w_delet = 5;
+int32_t spiffs_gc_w_used = -1;
+int32_t spiffs_gc_w_erase_age = 50;
+
+struct bconf {
+	uint32_t	page;
+	uint32_t	block;
+	uint32_t	cache;		/* Pages */
+	uint32_t	fds;
+	int32_t		w_delet, w_used, w_age;
+};
+
+struct workload {
+	const char	*name;
+	int		ops;		/* Default number of operations */
+	int		(*setup)(void);
+	int		(*op)(int);	/* Returns payload bytes, -1 on error */
+	void		(*done)(void);
+};
+
+static struct w25q *dev;
+static spiffs fs;
+static uint8_t *work, *fds, *cache;
+static uint32_t ram;
+static int check_too;
+static int no_cache;
+static uint8_t data[4096];
+static uint64_t *lat;
+
+/*
+ * {HAL, the same as spiffs_port.c without the partition checks}
+ */
+
+static s32_t
+hal_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	if (no_cache ||
+	    SPIFFS_IS_LOOKUP_PAGE(&fs, SPIFFS_PADDR_TO_PAGE(&fs, addr)))
+		sFLASH_UncachedRead(dst, addr, size);
+	else
+		sFLASH_CachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_stream_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	sFLASH_UncachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_write(u32_t addr, u32_t size, u8_t *src)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	sFLASH_WriteBuffer(src, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_erase(u32_t addr, u32_t size)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	switch (size) {
+	case 0x1000:
+		sFLASH_EraseSector(addr);
+		return SPIFFS_OK;
+	case 0x8000:
+		sFLASH_Erase32KBlock(addr);
+		return SPIFFS_OK;
+	case 0x10000:
+		sFLASH_Erase64KBlock(addr);
+		return SPIFFS_OK;
+	}
+	return -1;
+}
+
+static s32_t
+mount(const struct bconf *c)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+	spiffs_config cfg;
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.hal_read_f = hal_read;
+	cfg.hal_write_f = hal_write;
+	cfg.hal_erase_f = hal_erase;
+	cfg.hal_stream_read_f = hal_stream_read;
+	cfg.phys_addr = p->start;
+	cfg.phys_size = p->size;
+	cfg.phys_erase_block = c->block < 0x10000 ? c->block : 0x10000;
+	cfg.log_block_size = c->block;
+	cfg.log_page_size = c->page;
+	return SPIFFS_mount(&fs, &cfg, work, fds,
+	    SPIFFS_buffer_bytes_for_filedescs(&fs, c->fds), cache,
+	    SPIFFS_buffer_bytes_for_cache(&fs, c->cache), NULL);
+}
+
+/*
+ * {Workloads}
+ */
+
+/* Settings: small files rewritten whole and read back */
+#define CFG_FILES	64
+
+static int
+cfg_write(int f)
+{
+	char name[16];
+	spiffs_file fh;
+	int len = 32 + rand() % 480;
+	s32_t n;
+
+	snprintf(name, sizeof(name), "cfg%02d", f);
+	fh = SPIFFS_open(&fs, name, SPIFFS_O_CREAT | SPIFFS_O_TRUNC |
+	    SPIFFS_O_WRONLY, 0);
+	if (fh < 0)
+		return -1;
+	n = SPIFFS_write(&fs, fh, data, len);
+	if (SPIFFS_close(&fs, fh) < 0 || n != len)
+		return -1;
+	return len;
+}
+
+static int
+cfg_setup(void)
+{
+	int f;
+
+	for (f = 0; f < CFG_FILES; f++)
+		if (cfg_write(f) < 0)
+			return -1;
+	return 0;
+}
+
+static int
+cfg_op(int i)
+{
+	char name[16];
+	uint8_t buf[512];
+	spiffs_file fh;
+	s32_t n;
+
+	(void)i;
+	if (rand() % 2)
+		return cfg_write(rand() % CFG_FILES);
+	snprintf(name, sizeof(name), "cfg%02d", rand() % CFG_FILES);
+	fh = SPIFFS_open(&fs, name, SPIFFS_O_RDONLY, 0);
+	if (fh < 0)
+		return -1;
+	n = SPIFFS_read(&fs, fh, buf, sizeof(buf));
+	SPIFFS_close(&fs, fh);
+	return n;
+}
+
+/* Logging: records appended, open and closed each time, rotated */
+#define LOG_FILES	4
+#define LOG_ROTATE	0x20000
+
+static int log_cur;
+
+static int
+log_setup(void)
+{
+	log_cur = 0;
+	return 0;
+}
+
+static int
+log_op(int i)
+{
+	char name[16];
+	spiffs_stat st;
+	spiffs_file fh;
+	int len = 48 + rand() % 112;
+	s32_t n;
+
+	(void)i;
+	snprintf(name, sizeof(name), "log%d", log_cur % LOG_FILES);
+	fh = SPIFFS_open(&fs, name, SPIFFS_O_CREAT | SPIFFS_O_APPEND |
+	    SPIFFS_O_WRONLY, 0);
+	if (fh < 0)
+		return -1;
+	n = SPIFFS_write(&fs, fh, data, len);
+	if (SPIFFS_fstat(&fs, fh, &st) < 0)
+		st.size = 0;
+	if (SPIFFS_close(&fs, fh) < 0 || n != len)
+		return -1;
+	if (st.size >= LOG_ROTATE) {
+		log_cur++;
+		snprintf(name, sizeof(name), "log%d", log_cur % LOG_FILES);
+		if (SPIFFS_remove(&fs, name) < 0 &&
+		    SPIFFS_errno(&fs) != SPIFFS_ERR_NOT_FOUND)
+			return -1;
+	}
+	return len;
+}
+
+/* Database: fixed size records read and rewritten at random */
+#define DB_REC		128
+#define DB_RECS		8192
+
+static spiffs_file db_fh;
+
+static int
+db_setup(void)
+{
+	int i;
+
+	db_fh = SPIFFS_open(&fs, "db", SPIFFS_O_CREAT | SPIFFS_O_TRUNC |
+	    SPIFFS_O_RDWR, 0);
+	if (db_fh < 0)
+		return -1;
+	for (i = 0; i < DB_RECS * DB_REC; i += sizeof(data))
+		if (SPIFFS_write(&fs, db_fh, data, sizeof(data)) !=
+		    sizeof(data))
+			return -1;
+	return SPIFFS_fflush(&fs, db_fh) < 0 ? -1 : 0;
+}
+
+static int
+db_op(int i)
+{
+	uint8_t rec[DB_REC];
+	s32_t n;
+
+	(void)i;
+	if (SPIFFS_lseek(&fs, db_fh, (rand() % DB_RECS) * DB_REC,
+	    SPIFFS_SEEK_SET) < 0)
+		return -1;
+	if (rand() % 4 == 0)
+		n = SPIFFS_write(&fs, db_fh, data, DB_REC);
+	else
+		n = SPIFFS_read(&fs, db_fh, rec, DB_REC);
+	return n == DB_REC ? DB_REC : -1;
+}
+
+static void
+db_done(void)
+{
+	SPIFFS_close(&fs, db_fh);
+}
+
+/* Assets: a large file read in runs, by SPIFFS_read or streamed */
+#define ASSET_SIZE	0x40000
+#define ASSET_RUN	0x4000
+
+static spiffs_file asset_fh;
+static uint32_t asset_off;
+
+static int
+asset_setup(void)
+{
+	int i;
+
+	asset_fh = SPIFFS_open(&fs, "asset", SPIFFS_O_CREAT | SPIFFS_O_TRUNC |
+	    SPIFFS_O_RDWR, 0);
+	if (asset_fh < 0)
+		return -1;
+	for (i = 0; i < ASSET_SIZE; i += sizeof(data))
+		if (SPIFFS_write(&fs, asset_fh, data, sizeof(data)) !=
+		    sizeof(data))
+			return -1;
+	return SPIFFS_fflush(&fs, asset_fh) < 0 ? -1 : 0;
+}
+
+static int
+asset_seek(void)
+{
+	asset_off = rand() % (ASSET_SIZE / ASSET_RUN) * ASSET_RUN;
+	return SPIFFS_lseek(&fs, asset_fh, asset_off, SPIFFS_SEEK_SET);
+}
+
+/* Checks what is read against what asset_setup() wrote */
+static s32_t
+asset_sink(void *arg, const u8_t *buf, u32_t len)
+{
+	u32_t i;
+
+	(void)arg;
+	for (i = 0; i < len; i++, asset_off++)
+		if (buf[i] != data[asset_off % sizeof(data)])
+			return SPIFFS_ERR_INTERNAL;
+	return SPIFFS_OK;
+}
+
+static int
+asset_op(int i)
+{
+	static uint8_t buf[4096];
+	int n;
+
+	(void)i;
+	if (asset_seek() < 0)
+		return -1;
+	for (n = 0; n < ASSET_RUN; n += sizeof(buf))
+		if (SPIFFS_read(&fs, asset_fh, buf, sizeof(buf)) !=
+		    sizeof(buf) || asset_sink(NULL, buf, sizeof(buf)) < 0)
+			return -1;
+	return ASSET_RUN;
+}
+
+static int
+stream_op(int i)
+{
+	static uint8_t buf[4096];
+
+	(void)i;
+	if (asset_seek() < 0)
+		return -1;
+	return SPIFFS_read_stream(&fs, asset_fh, ASSET_RUN, buf, sizeof(buf),
+	    asset_sink, NULL);
+}
+
+static void
+asset_done(void)
+{
+	SPIFFS_close(&fs, asset_fh);
+}
+
+static const struct workload workloads[] = {
+	{ "config",	2000,	cfg_setup,	cfg_op,	NULL },
+	{ "log",	8000,	log_setup,	log_op,	NULL },
+	{ "db",		4000,	db_setup,	db_op,	db_done },
+	{ "asset",	500,	asset_setup,	asset_op,	asset_done },
+	{ "stream",	500,	asset_setup,	stream_op,	asset_done },
+};
+#define NWORKLOADS	(sizeof(workloads) / sizeof(workloads[0]))
+
+/*
+ * {Runs}
+ */
+
+/* Static files taking "pct" percent of the file system */
+static int
+fill(int pct)
+{
+	char name[16];
+	spiffs_file fh;
+	u32_t total, used, off;
+	int f;
+
+	if (SPIFFS_info(&fs, &total, &used) < 0)
+		return -1;
+	for (f = 0; used < (uint64_t)total * pct / 100; f++) {
+		snprintf(name, sizeof(name), "s%04d", f);
+		fh = SPIFFS_open(&fs, name, SPIFFS_O_CREAT | SPIFFS_O_WRONLY,
+		    0);
+		if (fh < 0)
+			return -1;
+		for (off = 0; off < 0x10000; off += sizeof(data))
+			if (SPIFFS_write(&fs, fh, data, sizeof(data)) !=
+			    sizeof(data))
+				return -1;
+		if (SPIFFS_close(&fs, fh) < 0 ||
+		    SPIFFS_info(&fs, &total, &used) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+static int
+cmp_u64(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+	return x < y ? -1 : x > y;
+}
+
+static double
+pct_ms(int n, int p)
+{
+	return lat[(n - 1) * p / 100] / 1e6;
+}
+
+static uint32_t
+max_erases(void)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+	uint32_t s, max = 0;
+
+	for (s = p->start / W25Q_SECTOR_SIZE;
+	    s < (p->start + p->size) / W25Q_SECTOR_SIZE; s++)
+		if (dev->erase_count[s] > max)
+			max = dev->erase_count[s];
+	return max;
+}
+
+/*
+ * Times a whole SPIFFS_check, then a whole check by SPIFFS_check_step,
+ * whose longest step is the worst lock hold of the background checker.
+ */
+static void
+check(const struct bconf *c)
+{
+	spiffs_check_cursor cur;
+	uint64_t t, full, max = 0;
+	uint32_t steps = 0;
+	void *cwork;
+	s32_t res;
+
+	t = dev->now;
+	if (SPIFFS_check(&fs) < 0) {
+		printf("  check failed, %d\n", (int)SPIFFS_errno(&fs));
+		return;
+	}
+	full = dev->now - t;
+	if ((cwork = malloc(c->page)) == NULL)
+		return;
+	SPIFFS_check_begin(&fs, &cur, cwork);
+	t = dev->now;
+	do {
+		uint64_t t0 = dev->now;
+
+		res = SPIFFS_check_step(&fs, &cur);
+		if (dev->now - t0 > max)
+			max = dev->now - t0;
+		steps++;
+	} while (res == 0);
+	if (res < 0)
+		printf("  check step failed, %d\n", (int)SPIFFS_errno(&fs));
+	else
+		printf("  check %.1f ms, in %u steps %.1f ms, max step %.3f ms, "
+		    "%u fixes\n", full / 1e6, steps, (dev->now - t) / 1e6,
+		    max / 1e6, cur.fixes);
+	free(cwork);
+}
+
+static void
+run(const struct bconf *c, const struct workload *w, int ops, int fill_pct)
+{
+	uint64_t start, t, bytes = 0, erases;
+	uint32_t gc;
+	int i, n;
+
+	printf("%5u %6u %3u %2u %3d:%d:%-3d %-7s ", c->page, c->block,
+	    c->cache, c->fds, c->w_delet, c->w_used, c->w_age, w->name);
+	fflush(stdout);
+	if (flash_part(FLASH_PART_SPIFFS)->size / c->page > 0xffff) {
+		printf("skipped, more than 64k pages\n");
+		return;
+	}
+	spiffs_gc_w_delet = c->w_delet;
+	spiffs_gc_w_used = c->w_used;
+	spiffs_gc_w_erase_age = c->w_age;
+	memset(dev->erase_count, 0, sizeof(dev->erase_count));
+	sFLASH_CacheFlush();
+
+	/* A fresh file system every time */
+	work = malloc(2 * c->page);
+	fds = malloc(c->fds * sizeof(spiffs_fd) + 8);
+	cache = malloc(sizeof(spiffs_cache) +
+	    c->cache * (sizeof(spiffs_cache_page) + c->page) + 8);
+	if (work == NULL || fds == NULL || cache == NULL) {
+		printf("out of memory\n");
+		goto out;
+	}
+	ram = sizeof(spiffs) + 2 * c->page + c->fds * sizeof(spiffs_fd) +
+	    sizeof(spiffs_cache) + c->cache *
+	    (sizeof(spiffs_cache_page) + c->page);
+#if SPIFFS_NAME_INDEX
+	ram += SPIFFS_NAME_INDEX_SIZE * 8;
+#endif
+#if SPIFFS_DIR_INDEX
+	ram += SPIFFS_DIR_INDEX_SIZE * 14 + SPIFFS_DIR_INDEX_SIZE / 4 * 2;
+#endif
+	(void)mount(c);
+	SPIFFS_unmount(&fs);
+	if (SPIFFS_format(&fs) < 0 || mount(c) < 0) {
+		printf("format failed, %d\n", (int)SPIFFS_errno(&fs));
+		goto out;
+	}
+	if (fill(fill_pct) < 0 || (w->setup && w->setup() < 0)) {
+		printf("setup failed, %d\n", (int)SPIFFS_errno(&fs));
+		goto unmount;
+	}
+
+	erases = dev->stats.erases;
+	gc = fs.stats_gc_runs;
+	start = dev->now;
+	for (i = 0; i < ops; i++) {
+		t = dev->now;
+		n = w->op(i);
+		lat[i] = dev->now - t;
+		if (n < 0) {
+			printf("op %d failed, %d\n", i,
+			    (int)SPIFFS_errno(&fs));
+			goto unmount;
+		}
+		bytes += n;
+	}
+	t = dev->now - start;
+	erases = dev->stats.erases - erases;
+	gc = fs.stats_gc_runs - gc;
+	if (w->done)
+		w->done();
+	qsort(lat, ops, sizeof(lat[0]), cmp_u64);
+	printf("%8.1f %7.3f %7.3f %7.3f %8.3f %6llu %4u %5u ",
+	    t ? bytes * 1e9 / 1024 / t : 0.0, pct_ms(ops, 50),
+	    pct_ms(ops, 90), pct_ms(ops, 99), lat[ops - 1] / 1e6,
+	    (unsigned long long)erases, max_erases(), gc);
+
+	/* Mount after a clean unmount, as at power up */
+	SPIFFS_unmount(&fs);
+	sFLASH_CacheFlush();
+	t = dev->now;
+	if (mount(c) < 0) {
+		printf("remount failed, %d\n", (int)SPIFFS_errno(&fs));
+		goto out;
+	}
+	printf("%8.3f %6u\n", (dev->now - t) / 1e6, ram);
+	if (check_too)
+		check(c);
+unmount:
+	SPIFFS_unmount(&fs);
+out:
+	free(work);
+	free(fds);
+	free(cache);
+}
+
+static int
+parse_list(const char *s, long *v)
+{
+	char *end;
+	int n = 0;
+
+	do {
+		if (n == MAX_LIST)
+			return -1;
+		v[n++] = strtol(s, &end, 0);
+		if (end == s || (*end != ',' && *end != 0))
+			return -1;
+		s = end + 1;
+	} while (*end == ',');
+	return n;
+}
+
+static int
+parse_weights(const char *s, long *v)
+{
+	char *end;
+	int n = 0;
+
+	do {
+		if (n == MAX_LIST)
+			return -1;
+		v[n * 3] = strtol(s, &end, 0);
+		if (end == s || *end != ':')
+			return -1;
+		s = end + 1;
+		v[n * 3 + 1] = strtol(s, &end, 0);
+		if (end == s || *end != ':')
+			return -1;
+		s = end + 1;
+		v[n * 3 + 2] = strtol(s, &end, 0);
+		if (end == s || (*end != ',' && *end != 0))
+			return -1;
+		s = end + 1;
+		n++;
+	} while (*end == ',');
+	return n;
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: spiffsbench [-kmu] [-s seed] [-n ops] "
+	    "[-F fill%%] [-w workloads]\n"
+	    "\t[-p pages] [-b blocks] [-c cache pages] [-f fds] "
+	    "[-g delete:used:age,...]\n");
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct w25q_timing *timing = &w25q_timing_typ;
+	long pages[MAX_LIST] = { 256 }, blocks[MAX_LIST] = { 65536 };
+	long caches[MAX_LIST] = { 8 }, nfds[MAX_LIST] = { 8 };
+	long weights[MAX_LIST * 3] = { 5, -1, 50 };
+	int np = 1, nb = 1, nc = 1, nf = 1, ng = 1;
+	unsigned int seed = 1, wmask = (1 << NWORKLOADS) - 1;
+	int ops = 0, fill_pct = 50, ch, p, b, c, f, g;
+	char *s;
+	size_t w;
+	struct bconf conf;
+
+	while ((ch = getopt(argc, argv, "b:c:f:F:g:kmn:p:s:uw:")) != -1) {
+		switch (ch) {
+		case 'b':
+			if ((nb = parse_list(optarg, blocks)) < 0)
+				usage();
+			break;
+		case 'c':
+			if ((nc = parse_list(optarg, caches)) < 0)
+				usage();
+			break;
+		case 'f':
+			if ((nf = parse_list(optarg, nfds)) < 0)
+				usage();
+			break;
+		case 'F':
+			fill_pct = atoi(optarg);
+			break;
+		case 'g':
+			if ((ng = parse_weights(optarg, weights)) < 0)
+				usage();
+			break;
+		case 'k':
+			check_too = 1;
+			break;
+		case 'm':
+			timing = &w25q_timing_max;
+			break;
+		case 'n':
+			ops = atoi(optarg);
+			break;
+		case 'p':
+			if ((np = parse_list(optarg, pages)) < 0)
+				usage();
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'u':
+			no_cache = 1;
+			break;
+		case 'w':
+			wmask = 0;
+			for (s = strtok(optarg, ","); s; s = strtok(NULL, ",")) {
+				for (w = 0; w < NWORKLOADS; w++)
+					if (strcmp(s, workloads[w].name) == 0)
+						break;
+				if (w == NWORKLOADS)
+					usage();
+				wmask |= 1 << w;
+			}
+			break;
+		default:
+			usage();
+		}
+	}
+	if ((dev = w25q_create(timing)) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	w25q_dev = dev;
+	dev->seed = seed;
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	ch = ops;
+	for (w = 0; w < NWORKLOADS; w++)
+		if (workloads[w].ops > ch)
+			ch = workloads[w].ops;
+	if ((lat = calloc(ch, sizeof(*lat))) == NULL) {
+		perror("calloc");
+		return 1;
+	}
+	for (w = 0; w < sizeof(data); w++)
+		data[w] = w * 7 + 3;
+
+	printf("%s timing, %d%% full, flash time only, latencies in ms\n",
+	    timing == &w25q_timing_max ? "max" : "typical", fill_pct);
+	printf(" page  block  $  fd  gc weight wload      KiB/s     p50"
+	    "     p90     p99      max erase  max    gc    mount    RAM\n");
+	for (p = 0; p < np; p++)
+	for (b = 0; b < nb; b++)
+	for (c = 0; c < nc; c++)
+	for (f = 0; f < nf; f++)
+	for (g = 0; g < ng; g++)
+	for (w = 0; w < NWORKLOADS; w++) {
+		if ((wmask & 1 << w) == 0)
+			continue;
+		conf.page = pages[p];
+		conf.block = blocks[b];
+		conf.cache = caches[c];
+		conf.fds = nfds[f];
+		conf.w_delet = weights[g * 3];
+		conf.w_used = weights[g * 3 + 1];
+		conf.w_age = weights[g * 3 + 2];
+		srand(seed);
+		run(&conf, &workloads[w], ops ? ops : workloads[w].ops,
+		    fill_pct);
+	}
+	w25q_destroy(dev);
+	return 0;
+}
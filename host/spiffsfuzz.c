@@ -0,0 +1,885 @@
+/*
+ * Power loss fuzzing of SPIFFS, its port and the flash driver on the
+ * W25Q emulator.
+ *
+ * Random file operations run on a small SPIFFS partition, set up as
+ * spiffs_port.c sets up the radio's: 256 byte pages, 64k blocks erased
+ * with 64k erases, the SPIFFS cache over sflash_cache.  Power is cut
+ * after a random number of SPI bytes, or at a random point inside a
+ * random page program or block erase, which leaves the bytes or pages
+ * beyond it partly programmed or erased.  Then the radio "reboots": the
+ * driver, the caches and the partitions start afresh and SPIFFS is
+ * mounted again, sometimes with another cut during the mount, then
+ * SPIFFS_check() mends what the cut left as spiffs_checkd does on the
+ * radio: a truncate or a removal cut short is only finished by a check.
+ * After every cut:
+ *
+ *	the mount and the check succeed,
+ *	every file that was not being changed is there with the same
+ *	content, and nothing else is,
+ *	the file being changed is in a state between before and after:
+ *	an append may be cut to any prefix, a rewrite may have the old
+ *	content, a prefix of it or a prefix of the new, a removal may leave
+ *	a prefix, and a renamed file has exactly one of its two names,
+ *	SPIFFS_info() is sane, and every "-k" cuts another SPIFFS_check()
+ *	leaves the files alone.
+ *
+ * Every "-c" cuts the radio is switched off cleanly instead: SPIFFS is
+ * unmounted, which saves the mount snapshot, with half the time a cut
+ * inside the unmount.  The next mount then comes from the snapshot, or
+ * from a scan if the cut tore it, and before any check the counters it
+ * restored must match a scan and every file must be as it was.
+ *
+ * Every call must take the SPIFFS lock once and give it back, as the
+ * firmware's mutex is not recursive.  The model then takes on what was
+ * found and the operations go on.  Throughput and mount times, in the
+ * flash's virtual time, are reported as it goes, so a change to the
+ * storage stack shows both what it costs and that it is still safe.
+ *
+ * On failure the seed and cut to repeat it are printed, and with -d the
+ * partition is saved for mkspiffs and friends.
+ *
+ * usage: spiffsfuzz [-mv] [-s seed] [-n cuts] [-o ops] [-S KiB]
+ *	  [-f files] [-z max size] [-k interval] [-c interval] [-d dump]
+ *	-m	use datasheet maximum instead of typical timings
+ *	-v	print where each cut landed
+ *	-n	power cuts to inject, default 500
+ *	-o	mean operations between cuts, default 24
+ *	-S	size of the SPIFFS partition, default 1024
+ *	-f	files at most, default 16
+ *	-z	bytes per file at most, default 32768
+ *	-k	cuts between full checks, default 8, 0 for none
+ *	-c	cuts between clean power offs, default 4, 0 for none
+ *	-d	file to save the partition to on failure
+ */
+
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+
+#define PAGE		256
+#define BLOCK		0x10000
+#define CACHE_PAGES	8		/* As spiffs_port.c */
+#define FDS		8
+#define MAX_FILES	64
+#define MAX_SIZE	0x40000
+
+int32_t spiffs_gc_w_delet = 5;
+int32_t spiffs_gc_w_used = -1;
+int32_t spiffs_gc_w_erase_age = 50;
+
+enum op {
+	OP_NONE,
+	OP_APPEND,
+	OP_REWRITE,
+	OP_OVERWRITE,
+	OP_REMOVE,
+	OP_RENAME,
+	OP_READ,
+	OP_GC,
+	OP_WEAR,
+	OP_CHECKPOINT,
+	OP_CHECK_STEP,
+	OP_REMOUNT,
+	NOPS
+};
+
+static const struct {
+	const char	*name;
+	int		weight;
+} ops[NOPS] = {
+	[OP_NONE] =		{ "none",	0 },
+	[OP_APPEND] =		{ "append",	24 },
+	[OP_REWRITE] =		{ "rewrite",	16 },
+	[OP_OVERWRITE] =	{ "overwrite",	10 },
+	[OP_REMOVE] =		{ "remove",	5 },
+	[OP_RENAME] =		{ "rename",	5 },
+	[OP_READ] =		{ "read",	20 },
+	[OP_GC] =		{ "gc step",	8 },
+	[OP_WEAR] =		{ "wear step",	2 },
+	[OP_CHECKPOINT] =	{ "checkpoint",	3 },
+	[OP_CHECK_STEP] =	{ "check step",	5 },
+	[OP_REMOUNT] =		{ "remount",	2 },
+};
+
+/* What the files should hold */
+struct mfile {
+	char		name[SPIFFS_OBJ_NAME_LEN];	/* Empty if none */
+	uint8_t		*data;
+	uint32_t	size;
+};
+
+/* The operation under way, which a cut may leave half done */
+struct pending {
+	enum op		op;
+	int		slot;		/* -1 if it changes no file */
+	char		name[SPIFFS_OBJ_NAME_LEN];	/* Created or renamed */
+	uint8_t		*data;		/* Content when done */
+	uint32_t	size;
+};
+
+struct totals {
+	uint64_t	ops, cuts, clean, mount_cuts, checks;
+	uint64_t	op_bytes, op_flash;	/* SPI bytes, programs and erases */
+	uint64_t	wbytes, wns, rbytes, rns;
+	uint64_t	mounts, mount_ns, mount_max;
+};
+
+static struct w25q *dev;
+static spiffs fs;
+static uint8_t work[2 * PAGE];
+static uint8_t fds[FDS * sizeof(spiffs_fd) + 8];
+static uint8_t cache[sizeof(spiffs_cache) +
+    CACHE_PAGES * (sizeof(spiffs_cache_page) + PAGE) + 8];
+static uint32_t check_work[PAGE / 4];
+static spiffs_check_cursor check_cur;
+
+static struct mfile model[MAX_FILES];
+static struct pending pend;
+static uint8_t *buf;
+static int nfiles = 16, lock_depth;
+static uint32_t max_size = 0x8000, budget, part_size = 1024 * 1024;
+static uint32_t names;		/* Makes names unique */
+static unsigned int seed = 1;
+static uint64_t cut_no;
+static const char *dump;
+static int verbose;
+static struct totals tot;
+static jmp_buf cut_jmp;
+
+static void
+fail(const char *fmt, ...)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+	va_list ap;
+
+	printf("\nFAIL after cut %llu, during %s: ", (unsigned long long)cut_no,
+	    ops[pend.op].name);
+	va_start(ap, fmt);
+	vprintf(fmt, ap);
+	va_end(ap);
+	printf("\nrepeat with -s %u, SPIFFS error %d\n", seed,
+	    (int)SPIFFS_errno(&fs));
+	if (dump != NULL && w25q_save(dev, dump, p->start, p->size) == 0)
+		printf("partition saved to %s\n", dump);
+	exit(1);
+}
+
+/* The firmware's mutex, which is not recursive */
+void
+spiffs_host_lock(int d)
+{
+	if (d > 0 && lock_depth != 0)
+		fail("lock taken twice");
+	if (d < 0 && lock_depth != 1)
+		fail("lock given back but not held");
+	lock_depth += d;
+}
+
+static void
+cut(struct w25q *w, void *arg)
+{
+	/* The MCU browns out too, abandon whatever it was doing */
+	longjmp(cut_jmp, 1);
+}
+
+static void
+cancel_cut(void)
+{
+	w25q_schedule_cut(dev, 0, NULL, NULL);
+	dev->cut_ops = 0;
+}
+
+/*
+ * {HAL, the same as spiffs_port.c without the partition checks}
+ */
+
+static s32_t
+hal_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	sFLASH_CachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_stream_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	sFLASH_UncachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_write(u32_t addr, u32_t size, u8_t *src)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	sFLASH_WriteBuffer(src, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_erase(u32_t addr, u32_t size)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	if (size != BLOCK)
+		return -1;
+	sFLASH_Erase64KBlock(addr);
+	return SPIFFS_OK;
+}
+
+static s32_t
+mount(void)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+	spiffs_config cfg;
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.hal_read_f = hal_read;
+	cfg.hal_write_f = hal_write;
+	cfg.hal_erase_f = hal_erase;
+	cfg.hal_stream_read_f = hal_stream_read;
+	cfg.phys_addr = p->start;
+	cfg.phys_size = p->size;
+	cfg.phys_erase_block = BLOCK;
+	cfg.log_block_size = BLOCK;
+	cfg.log_page_size = PAGE;
+	return SPIFFS_mount(&fs, &cfg, work, fds, sizeof(fds), cache,
+	    sizeof(cache), NULL);
+}
+
+/* Everything in RAM starts afresh, as after a reset */
+static void
+reboot(void)
+{
+	lock_depth = 0;
+	w25q_power_on(dev);
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	flash_parts[FLASH_PART_SPIFFS].size = part_size;
+}
+
+/*
+ * {Model}
+ */
+
+static void
+fill_random(uint8_t *p, uint32_t len)
+{
+	uint32_t x = rand() | 1;
+
+	while (len-- > 0) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		*p++ = x;
+	}
+}
+
+static uint32_t
+model_bytes(void)
+{
+	uint32_t n = 0;
+	int i;
+
+	for (i = 0; i < nfiles; i++)
+		n += model[i].size;
+	return n;
+}
+
+static int
+find(const char *name)
+{
+	int i;
+
+	for (i = 0; i < nfiles; i++)
+		if (model[i].name[0] != '\0' && strcmp(model[i].name, name) == 0)
+			return i;
+	return -1;
+}
+
+static int
+is_prefix(const uint8_t *whole, uint32_t wsize, const uint8_t *p,
+    uint32_t size)
+{
+	return size <= wsize && memcmp(whole, p, size) == 0;
+}
+
+/* Whether "slot" may hold "p" of "size" now */
+static int
+allowed(int slot, const uint8_t *p, uint32_t size)
+{
+	struct mfile *m = &model[slot];
+	uint32_t i;
+
+	if (pend.slot != slot)
+		return size == m->size && memcmp(m->data, p, size) == 0;
+	switch (pend.op) {
+	case OP_APPEND:
+		return size >= m->size && is_prefix(pend.data, pend.size, p,
+		    size);
+	case OP_REWRITE:
+		return is_prefix(m->data, m->size, p, size) ||
+		    is_prefix(pend.data, pend.size, p, size);
+	case OP_OVERWRITE:
+		if (size < m->size || size > pend.size)
+			return 0;
+		for (i = 0; i < size; i++)
+			if (p[i] != pend.data[i] &&
+			    (i >= m->size || p[i] != m->data[i]))
+				return 0;
+		return 1;
+	case OP_REMOVE:
+		return is_prefix(m->data, m->size, p, size);
+	default:
+		return size == m->size && memcmp(m->data, p, size) == 0;
+	}
+}
+
+static uint32_t
+read_file(const char *name, uint32_t size)
+{
+	spiffs_file fh;
+	s32_t n;
+
+	if ((fh = SPIFFS_open(&fs, name, SPIFFS_O_RDONLY, 0)) < 0)
+		fail("cannot open %s", name);
+	n = SPIFFS_read(&fs, fh, buf, MAX_SIZE);
+	if (n < 0 && SPIFFS_errno(&fs) == SPIFFS_ERR_END_OF_OBJECT)
+		n = 0;
+	if (n < 0 || (uint32_t)n != size)
+		fail("%s read %d bytes of %u", name, (int)n, size);
+	SPIFFS_close(&fs, fh);
+	return n;
+}
+
+/*
+ * Checks the files against the model, which then takes on how the
+ * operation under way was left.
+ */
+static void
+verify(void)
+{
+	spiffs_DIR d;
+	struct spiffs_dirent e, *pe;
+	char seen[MAX_FILES];
+	const char *name;
+	u32_t total, used;
+	int slot;
+
+	memset(seen, 0, sizeof(seen));
+	if (SPIFFS_opendir(&fs, "/", &d) == NULL)
+		fail("opendir");
+	while ((pe = SPIFFS_readdir(&d, &e)) != NULL) {
+		name = (const char *)e.name;
+		slot = find(name);
+		if (slot < 0 && pend.slot >= 0 && pend.name[0] != '\0' &&
+		    strcmp(pend.name, name) == 0)
+			slot = pend.slot;
+		if (slot < 0)
+			fail("stray file %s", name);
+		if (seen[slot]++)
+			fail("%s is there twice", name);
+		read_file(name, e.size);
+		if (!allowed(slot, buf, e.size))
+			fail("%s holds %u bytes that never were", name, e.size);
+		if (slot == pend.slot) {
+			strcpy(model[slot].name, name);
+			memcpy(model[slot].data, buf, e.size);
+			model[slot].size = e.size;
+		}
+	}
+	SPIFFS_closedir(&d);
+	if (lock_depth != 0)
+		fail("readdir kept the lock");
+
+	for (slot = 0; slot < nfiles; slot++) {
+		if (model[slot].name[0] == '\0' || seen[slot])
+			continue;
+		if (slot != pend.slot || (pend.op != OP_REMOVE &&
+		    pend.op != OP_REWRITE && pend.op != OP_APPEND))
+			fail("%s is lost", model[slot].name);
+		/* Never created, or removed */
+		model[slot].name[0] = '\0';
+		model[slot].size = 0;
+	}
+	if (SPIFFS_info(&fs, &total, &used) < 0 || used > total)
+		fail("info says %u of %u used", used, total);
+	pend.op = OP_NONE;
+	pend.slot = -1;
+}
+
+/* The files hold just what the model says */
+static void
+verify_all(void)
+{
+	pend.op = OP_NONE;
+	pend.slot = -1;
+	verify();
+}
+
+/*
+ * {Operations}
+ */
+
+static void
+new_name(char *name)
+{
+	snprintf(name, SPIFFS_OBJ_NAME_LEN, "f%u", names++);
+}
+
+static void
+write_file(const char *name, spiffs_flags flags, uint32_t off,
+    const uint8_t *p, uint32_t len)
+{
+	spiffs_file fh;
+
+	if ((fh = SPIFFS_open(&fs, name, flags, 0)) < 0)
+		fail("cannot open %s", name);
+	if (off != 0 && SPIFFS_lseek(&fs, fh, off, SPIFFS_SEEK_SET) < 0)
+		fail("cannot seek %s to %u", name, off);
+	if (len > 0 && SPIFFS_write(&fs, fh, (void *)p, len) != (s32_t)len)
+		fail("cannot write %u bytes to %s", len, name);
+	if (SPIFFS_close(&fs, fh) < 0)
+		fail("cannot close %s", name);
+}
+
+/* Returns the bytes written or read, or -1 if the operation was skipped */
+static int32_t
+run_op(enum op op, int slot)
+{
+	struct mfile *m = &model[slot];
+	uint32_t room = budget > model_bytes() ? budget - model_bytes() : 0;
+	uint32_t off, len;
+	s32_t res;
+
+	pend.op = op;
+	pend.slot = -1;
+	pend.name[0] = '\0';
+	switch (op) {
+	case OP_APPEND:
+		len = 1 + rand() % (max_size / 4);
+		if (len > room || m->size + len > max_size)
+			return -1;
+		if (m->name[0] == '\0')
+			new_name(pend.name);
+		memcpy(pend.data, m->data, m->size);
+		fill_random(pend.data + m->size, len);
+		pend.size = m->size + len;
+		pend.slot = slot;
+		write_file(m->name[0] ? m->name : pend.name, SPIFFS_O_CREAT |
+		    SPIFFS_O_APPEND | SPIFFS_O_WRONLY, 0, pend.data + m->size,
+		    len);
+		return len;
+	case OP_REWRITE:
+		len = rand() % max_size;
+		if (len > room + m->size)
+			return -1;
+		if (m->name[0] == '\0')
+			new_name(pend.name);
+		fill_random(pend.data, len);
+		pend.size = len;
+		pend.slot = slot;
+		write_file(m->name[0] ? m->name : pend.name, SPIFFS_O_CREAT |
+		    SPIFFS_O_TRUNC | SPIFFS_O_WRONLY, 0, pend.data, len);
+		return len;
+	case OP_OVERWRITE:
+		if (m->name[0] == '\0' || m->size == 0)
+			return -1;
+		off = rand() % m->size;
+		len = 1 + rand() % (max_size / 4);
+		if (off + len > max_size)
+			len = max_size - off;
+		if (off + len > m->size && off + len - m->size > room)
+			return -1;
+		memcpy(pend.data, m->data, m->size);
+		fill_random(pend.data + off, len);
+		pend.size = off + len > m->size ? off + len : m->size;
+		pend.slot = slot;
+		write_file(m->name, SPIFFS_O_RDWR, off, pend.data + off, len);
+		return len;
+	case OP_REMOVE:
+		if (m->name[0] == '\0')
+			return -1;
+		pend.slot = slot;
+		if (SPIFFS_remove(&fs, m->name) < 0)
+			fail("cannot remove %s", m->name);
+		return 0;
+	case OP_RENAME:
+		if (m->name[0] == '\0')
+			return -1;
+		new_name(pend.name);
+		pend.slot = slot;
+		if (SPIFFS_rename(&fs, m->name, pend.name) < 0)
+			fail("cannot rename %s to %s", m->name, pend.name);
+		return 0;
+	case OP_READ:
+		if (m->name[0] == '\0')
+			return -1;
+		read_file(m->name, m->size);
+		if (memcmp(buf, m->data, m->size) != 0)
+			fail("%s reads back wrong", m->name);
+		return m->size;
+	case OP_GC:
+		res = SPIFFS_gc_step(&fs, rand() % (BLOCK / PAGE));
+		break;
+	case OP_WEAR:
+		res = SPIFFS_wear_level_step(&fs, 4);
+		break;
+#if SPIFFS_MOUNT_SNAPSHOT
+	case OP_CHECKPOINT:
+		res = SPIFFS_checkpoint(&fs);
+		break;
+#endif
+	case OP_CHECK_STEP:
+		res = SPIFFS_check_step(&fs, &check_cur);
+		break;
+	case OP_REMOUNT:
+		SPIFFS_unmount(&fs);
+		res = mount();
+		SPIFFS_check_begin(&fs, &check_cur, check_work);
+		break;
+	default:
+		return -1;
+	}
+	if (res < 0)
+		fail("error %d", (int)res);
+	return 0;
+}
+
+/* Applies a finished operation to the model */
+static void
+done_op(void)
+{
+	struct mfile *m;
+
+	if (pend.slot >= 0) {
+		m = &model[pend.slot];
+		if (pend.name[0] != '\0')
+			strcpy(m->name, pend.name);
+		switch (pend.op) {
+		case OP_APPEND:
+		case OP_REWRITE:
+		case OP_OVERWRITE:
+			memcpy(m->data, pend.data, pend.size);
+			m->size = pend.size;
+			break;
+		case OP_REMOVE:
+			m->name[0] = '\0';
+			m->size = 0;
+			break;
+		default:
+			break;
+		}
+	}
+	pend.op = OP_NONE;
+	pend.slot = -1;
+}
+
+static enum op
+pick_op(void)
+{
+	int i, total = 0, r;
+
+	for (i = 0; i < NOPS; i++)
+		total += ops[i].weight;
+	r = rand() % total;
+	for (i = 0; r >= ops[i].weight; i++)
+		r -= ops[i].weight;
+	return i;
+}
+
+static uint64_t
+flash_ops(void)
+{
+	return dev->stats.programs + dev->stats.erases;
+}
+
+/* One operation, timed */
+static void
+step(void)
+{
+	enum op op = pick_op();
+	uint64_t t = dev->now, b = dev->stats.bytes, f = flash_ops();
+	int32_t n;
+
+	if ((n = run_op(op, rand() % nfiles)) < 0) {
+		pend.op = OP_NONE;
+		pend.slot = -1;
+		return;
+	}
+	if (lock_depth != 0)
+		fail("returned holding the lock");
+	done_op();
+	tot.ops++;
+	tot.op_bytes += dev->stats.bytes - b;
+	tot.op_flash += flash_ops() - f;
+	if (op == OP_READ) {
+		tot.rbytes += n;
+		tot.rns += dev->now - t;
+	} else if (op == OP_APPEND || op == OP_REWRITE ||
+	    op == OP_OVERWRITE) {
+		tot.wbytes += n;
+		tot.wns += dev->now - t;
+	}
+}
+
+/* The counters the mount restored are the ones a scan finds */
+static void
+check_counters(void)
+{
+	u32_t free_blocks = fs.free_blocks, p_allocated = fs.stats_p_allocated;
+	u32_t p_deleted = fs.stats_p_deleted;
+	spiffs_obj_id max_erase_count = fs.max_erase_count;
+
+	if (spiffs_obj_lu_scan(&fs) < 0)
+		fail("scan after the mount failed");
+	if (fs.free_blocks != free_blocks ||
+	    fs.stats_p_allocated != p_allocated ||
+	    fs.stats_p_deleted != p_deleted ||
+	    fs.max_erase_count != max_erase_count)
+		fail("mount found %u free blocks, %u used and %u deleted pages "
+		    "and erase count %u, a scan %u, %u, %u and %u",
+		    free_blocks, p_allocated, p_deleted, max_erase_count,
+		    fs.free_blocks, fs.stats_p_allocated, fs.stats_p_deleted,
+		    fs.max_erase_count);
+}
+
+/*
+ * Reboots and mounts, perhaps cut short again a few times.  After a clean
+ * power off the files are checked before SPIFFS_check() may mend them.
+ */
+static void
+recover(uint64_t *mount_bytes, int clean)
+{
+	static uint64_t t, bytes;
+	static s32_t res;
+
+	for (;;) {
+		reboot();
+		if (*mount_bytes > 0 && rand() % 8 == 0)
+			w25q_schedule_cut(dev, 1 + rand() % *mount_bytes, cut,
+			    NULL);
+		if (setjmp(cut_jmp) == 0) {
+			t = dev->now;
+			bytes = dev->stats.bytes;
+			res = mount();
+			cancel_cut();
+			break;
+		}
+		tot.mount_cuts++;
+	}
+	if (res < 0)
+		fail("mount failed, %d", (int)res);
+	if (lock_depth != 0)
+		fail("mount kept the lock");
+	*mount_bytes = dev->stats.bytes - bytes;
+	t = dev->now - t;
+	tot.mounts++;
+	tot.mount_ns += t;
+	if (t > tot.mount_max)
+		tot.mount_max = t;
+	if (clean) {
+		check_counters();
+		verify_all();
+	}
+	if (SPIFFS_check(&fs) < 0)
+		fail("check after the mount failed");
+	if (lock_depth != 0)
+		fail("check kept the lock");
+	SPIFFS_check_begin(&fs, &check_cur, check_work);
+}
+
+static void
+report(void)
+{
+	printf("%8llu cuts %6llu clean %6llu in mount %9llu ops "
+	    "%8.1f KiB/s write %8.1f KiB/s read  mount %.1f/%.1f ms\n",
+	    (unsigned long long)tot.cuts, (unsigned long long)tot.clean,
+	    (unsigned long long)tot.mount_cuts, (unsigned long long)tot.ops,
+	    tot.wns ? tot.wbytes * 1e9 / 1024 / tot.wns : 0.0,
+	    tot.rns ? tot.rbytes * 1e9 / 1024 / tot.rns : 0.0,
+	    tot.mounts ? tot.mount_ns / 1e6 / tot.mounts : 0.0,
+	    tot.mount_max / 1e6);
+	fflush(stdout);
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: spiffsfuzz [-mv] [-s seed] [-n cuts] [-o ops] "
+	    "[-S KiB]\n\t[-f files] [-z max size] [-k interval] "
+	    "[-c interval] [-d dump]\n");
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	const struct w25q_timing *timing = &w25q_timing_typ;
+	static uint64_t ncuts = 500, mount_bytes, unmount_bytes, window, b;
+	static int nops = 24, check_every = 8, clean_every = 4, i;
+	u32_t total, used;
+	int ch;
+
+	while ((ch = getopt(argc, argv, "c:d:f:k:mn:o:s:S:vz:")) != -1) {
+		switch (ch) {
+		case 'c':
+			clean_every = atoi(optarg);
+			break;
+		case 'd':
+			dump = optarg;
+			break;
+		case 'f':
+			nfiles = atoi(optarg);
+			if (nfiles < 1 || nfiles > MAX_FILES)
+				usage();
+			break;
+		case 'k':
+			check_every = atoi(optarg);
+			break;
+		case 'm':
+			timing = &w25q_timing_max;
+			break;
+		case 'n':
+			ncuts = strtoull(optarg, NULL, 0);
+			break;
+		case 'o':
+			if ((nops = atoi(optarg)) < 1)
+				usage();
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'S':
+			part_size = strtoul(optarg, NULL, 0) * 1024;
+			break;
+		case 'v':
+			verbose = 1;
+			break;
+		case 'z':
+			max_size = strtoul(optarg, NULL, 0);
+			if (max_size < 16 || max_size > MAX_SIZE)
+				usage();
+			break;
+		default:
+			usage();
+		}
+	}
+	if ((dev = w25q_create(timing)) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	w25q_dev = dev;
+	dev->seed = seed;
+	srand(seed);
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	if (part_size == 0 || part_size % BLOCK != 0 ||
+	    part_size > flash_parts[FLASH_PART_SPIFFS].size)
+		usage();
+	reboot();
+	for (i = 0; i < nfiles; i++)
+		if ((model[i].data = malloc(max_size)) == NULL)
+			return 1;
+	if ((pend.data = malloc(max_size)) == NULL ||
+	    (buf = malloc(MAX_SIZE)) == NULL)
+		return 1;
+	pend.slot = -1;
+
+	(void)mount();
+	SPIFFS_unmount(&fs);
+	if (SPIFFS_format(&fs) < 0 || mount() < 0 ||
+	    SPIFFS_info(&fs, &total, &used) < 0)
+		fail("cannot format");
+	/* Half full at most, so collection always has room */
+	budget = total / 2;
+	SPIFFS_check_begin(&fs, &check_cur, check_work);
+
+	printf("%u KiB, %d files of up to %u bytes, a cut every %d "
+	    "operations on average, seed %u\n", part_size / 1024, nfiles,
+	    max_size, nops, seed);
+	for (cut_no = 1; cut_no <= ncuts; cut_no++) {
+		if (clean_every > 0 && cut_no % clean_every == 0) {
+			/* Switched off, perhaps before the snapshot is out */
+			if (setjmp(cut_jmp) == 0) {
+				for (i = 0; i < nops; i++)
+					step();
+				if (unmount_bytes > 0 && rand() % 2 == 0)
+					w25q_schedule_cut(dev, 1 + rand() %
+					    unmount_bytes, cut, NULL);
+				b = dev->stats.bytes;
+				SPIFFS_unmount(&fs);
+				if (lock_depth != 0)
+					fail("unmount kept the lock");
+				cancel_cut();
+				unmount_bytes = dev->stats.bytes - b;
+				tot.clean++;
+			} else {
+				tot.cuts++;
+				if (verbose)
+					printf("cut %llu in unmount\n",
+					    (unsigned long long)cut_no);
+			}
+			recover(&mount_bytes, 1);
+			verify_all();
+		} else {
+			/* Half the cuts inside a program or erase */
+			if (cut_no & 1) {
+				window = tot.ops ? tot.op_bytes / tot.ops :
+				    20000;
+				w25q_schedule_cut(dev, 1 + rand() %
+				    (window * nops * 2), cut, NULL);
+			} else {
+				window = tot.ops ? tot.op_flash / tot.ops : 40;
+				w25q_schedule_cut_op(dev, 1 + rand() %
+				    (window * nops * 2 + 1), cut, NULL);
+			}
+			if (setjmp(cut_jmp) == 0) {
+				/* Long enough that the cut nearly always comes */
+				for (i = 0; i < nops * 8; i++)
+					step();
+				cancel_cut();
+				tot.clean++;
+				verify_all();
+			} else {
+				tot.cuts++;
+				if (verbose)
+					printf("cut %llu in %s of %s\n",
+					    (unsigned long long)cut_no,
+					    ops[pend.op].name, pend.slot >= 0 ?
+					    model[pend.slot].name : "-");
+				recover(&mount_bytes, 0);
+				verify();
+			}
+		}
+		if (check_every > 0 && cut_no % check_every == 0) {
+			if (SPIFFS_check(&fs) < 0)
+				fail("check failed");
+			if (lock_depth != 0)
+				fail("check kept the lock");
+			tot.checks++;
+			verify_all();
+		}
+		if (cut_no % (ncuts / 10 ? ncuts / 10 : 1) == 0)
+			report();
+	}
+	SPIFFS_unmount(&fs);
+	printf("ok, %llu full checks\n", (unsigned long long)tot.checks);
+	w25q_destroy(dev);
+	return 0;
+}
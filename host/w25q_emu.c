@@ -0,0 +1,588 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "w25q_emu.h"
+
+/* Commands, a subset of those in spi_flash.h */
+#define CMD_WRSR	0x01
+#define CMD_PP		0x02
+#define CMD_READ	0x03
+#define CMD_WRDI	0x04
+#define CMD_RDSR	0x05
+#define CMD_WREN	0x06
+#define CMD_FREAD	0x0b
+#define CMD_SE		0x20
+#define CMD_RDSR2	0x35
+#define CMD_PSR		0x42
+#define CMD_ESR		0x44
+#define CMD_RSR		0x48
+#define CMD_RUID	0x4b
+#define CMD_BE32	0x52
+#define CMD_CE2		0x60
+#define CMD_MDID	0x90
+#define CMD_RDID	0x9f
+#define CMD_RPDID	0xab
+#define CMD_PD		0xb9
+#define CMD_CE		0xc7
+#define CMD_BE64	0xd8
+
+#define SR1_BUSY	0x01
+#define SR1_WEL		0x02
+#define SR2_LB_SHIFT	3	/* LB1..LB3 in status register 2 */
+
+const struct w25q_timing w25q_timing_typ = {
+	.byte_prog_first =	30000,
+	.byte_prog_next =	2500,
+	.page_prog =		700000,
+	.erase_4k =		45000000,
+	.erase_32k =		120000000,
+	.erase_64k =		150000000,
+	.erase_chip =		40000000000ULL,
+	.write_sr =		10000000,
+};
+
+const struct w25q_timing w25q_timing_max = {
+	.byte_prog_first =	50000,
+	.byte_prog_next =	12000,
+	.page_prog =		3000000,
+	.erase_4k =		400000000,
+	.erase_32k =		1600000000,
+	.erase_64k =		2000000000,
+	.erase_chip =		200000000000ULL,
+	.write_sr =		15000000,
+};
+
+static const uint8_t unique_id[8] = {
+	0xd2, 0x64, 0x38, 0x41, 0x17, 0x4b, 0x2a, 0x33
+};
+
+static uint32_t
+rnd(struct w25q *w)
+{
+	/* xorshift32, deterministic for a given seed */
+	w->seed ^= w->seed << 13;
+	w->seed ^= w->seed >> 17;
+	w->seed ^= w->seed << 5;
+	return w->seed;
+}
+
+static void power_fail(struct w25q *);
+
+static void
+start_op(struct w25q *w, enum w25q_op op, uint32_t addr, uint32_t len,
+    uint64_t ns)
+{
+	w->op = op;
+	w->op_addr = addr;
+	w->op_len = len;
+	w->op_start = w->now;
+	w->op_end = w->now + ns;
+	w->sr1 |= SR1_BUSY;
+	w->stats.busy_ns += ns;
+	if ((op == W25Q_OP_PROGRAM || op == W25Q_OP_ERASE) &&
+	    w->cut_ops != 0 && --w->cut_ops == 0) {
+		w->now += rnd(w) % ns;
+		power_fail(w);
+	}
+}
+
+static uint8_t *
+op_target(struct w25q *w)
+{
+	if (w->op == W25Q_OP_SECREG_PROGRAM || w->op == W25Q_OP_SECREG_ERASE)
+		return w->secreg[(w->op_addr >> 12) - 1];
+	return w->mem;
+}
+
+static void
+count_erase(struct w25q *w, uint32_t addr, uint32_t len)
+{
+	uint32_t s;
+
+	if (w->op != W25Q_OP_ERASE)
+		return;
+	for (s = addr / W25Q_SECTOR_SIZE; s < (addr + len) / W25Q_SECTOR_SIZE; s++)
+		w->erase_count[s]++;
+}
+
+/*
+ * Applies the first "done" bytes of the operation in progress.  The
+ * byte after those, if any, is left with only some of its bits changed.
+ */
+static void
+apply_op(struct w25q *w, uint32_t done)
+{
+	uint8_t *mem = op_target(w);
+	uint32_t base, i, off;
+
+	switch (w->op) {
+	case W25Q_OP_PROGRAM:
+	case W25Q_OP_SECREG_PROGRAM:
+		base = w->op == W25Q_OP_PROGRAM ? w->op_addr & ~(W25Q_PAGE_SIZE - 1) : 0;
+		for (i = 0; i < w->op_len && i <= done; i++) {
+			off = (w->op_addr + i) & (W25Q_PAGE_SIZE - 1);
+			if (i < done)
+				mem[base + off] &= w->latch[off];
+			else
+				mem[base + off] &= w->latch[off] | rnd(w);
+		}
+		w->stats.programs++;
+		break;
+	case W25Q_OP_ERASE:
+	case W25Q_OP_SECREG_ERASE:
+		base = w->op == W25Q_OP_ERASE ? w->op_addr : 0;
+		if (done > w->op_len)
+			done = w->op_len;
+		memset(mem + base, 0xff, done);
+		for (i = done; i < w->op_len && i < done + W25Q_PAGE_SIZE; i++)
+			mem[base + i] |= rnd(w);
+		count_erase(w, w->op_addr, w->op_len);
+		w->stats.erases++;
+		break;
+	case W25Q_OP_WRITE_SR:
+		if (done > 0) {
+			w->sr1 = (w->latch[0] & ~(SR1_BUSY | SR1_WEL)) |
+			    (w->sr1 & (SR1_BUSY | SR1_WEL));
+			/* Lock bits are OTP, they can only be set */
+			w->sr2 = w->latch[1] | (w->sr2 & (7 << SR2_LB_SHIFT));
+		}
+		break;
+	case W25Q_OP_NONE:
+		break;
+	}
+	w->op = W25Q_OP_NONE;
+	w->sr1 &= ~(SR1_BUSY | SR1_WEL);
+}
+
+void
+w25q_settle(struct w25q *w)
+{
+	if (w->op != W25Q_OP_NONE && w->now >= w->op_end)
+		apply_op(w, w->op_len);
+}
+
+void
+w25q_advance(struct w25q *w, uint64_t ns)
+{
+	w->now += ns;
+	w25q_settle(w);
+}
+
+void
+w25q_cut_power(struct w25q *w)
+{
+	uint64_t span;
+	uint32_t done;
+
+	if (w->op != W25Q_OP_NONE && w->now < w->op_end) {
+		span = w->op_end - w->op_start;
+		done = (uint32_t)((w->now - w->op_start) * w->op_len / span);
+		apply_op(w, done);
+	}
+	w->op = W25Q_OP_NONE;
+	w->sr1 &= ~(SR1_BUSY | SR1_WEL);
+	w->powered = false;
+	w->selected = false;
+	w->cut_after = 0;
+	w->cut_ops = 0;
+}
+
+void
+w25q_power_on(struct w25q *w)
+{
+	w->powered = true;
+	w->powered_down = false;
+	w->selected = false;
+	w->sr1 &= ~(SR1_BUSY | SR1_WEL);
+}
+
+void
+w25q_schedule_cut(struct w25q *w, uint64_t bytes,
+    void (*cb)(struct w25q *, void *), void *arg)
+{
+	w->cut_after = bytes;
+	w->cut_cb = cb;
+	w->cut_arg = arg;
+}
+
+void
+w25q_schedule_cut_op(struct w25q *w, uint64_t ops,
+    void (*cb)(struct w25q *, void *), void *arg)
+{
+	w->cut_ops = ops;
+	w->cut_cb = cb;
+	w->cut_arg = arg;
+}
+
+static void
+power_fail(struct w25q *w)
+{
+	/* A status poll of a busy chip stands for the whole wait, so
+	 * let the cut land anywhere inside the operation. */
+	if (w->op != W25Q_OP_NONE && w->now < w->op_end &&
+	    w->nbytes > 0 && w->cmd == CMD_RDSR)
+		w->now += rnd(w) % (w->op_end - w->now);
+	w25q_cut_power(w);
+	if (w->cut_cb != NULL)
+		w->cut_cb(w, w->cut_arg);
+	else
+		w25q_power_on(w);	/* Brown-out of the flash alone */
+}
+
+void
+w25q_select(struct w25q *w)
+{
+	w->now += w->cs_ns;
+	if (!w->powered)
+		return;
+	w25q_settle(w);
+	w->selected = true;
+	w->dropped = false;
+	w->nbytes = 0;
+	w->addr = 0;
+	w->stats.selects++;
+}
+
+static uint8_t
+secreg_read(struct w25q *w, uint32_t addr)
+{
+	uint32_t reg = (addr >> 12) & 0xfff;
+
+	if (reg < 1 || reg > 3)
+		return 0xff;
+	return w->secreg[reg - 1][addr & (W25Q_PAGE_SIZE - 1)];
+}
+
+static void
+latch_byte(struct w25q *w, uint32_t n, uint8_t out)
+{
+	uint32_t off = (w->addr + n) & (W25Q_PAGE_SIZE - 1);
+
+	/* Past 256 bytes the address wraps and overwrites the latch */
+	w->latch[off] = out;
+}
+
+uint8_t
+w25q_xfer(struct w25q *w, uint8_t out)
+{
+	uint32_t n;
+	uint8_t in = 0xff;
+
+	w->now += w->byte_ns;
+	if (!w->powered || !w->selected)
+		return 0xff;
+	w->stats.bytes++;
+	if (w->cut_after != 0 && --w->cut_after == 0) {
+		power_fail(w);
+		return 0xff;
+	}
+	w25q_settle(w);
+	n = w->nbytes++;
+	if (n == 0) {
+		w->cmd = out;
+		if (w->powered_down && out != CMD_RPDID)
+			w->dropped = true;
+		else if (w->op != W25Q_OP_NONE && out != CMD_RDSR &&
+		    out != CMD_RDSR2)
+			w->dropped = true;
+		if (w->dropped)
+			w->stats.ignored++;
+		return 0xff;
+	}
+	if (w->dropped)
+		return 0xff;
+	if (n <= 3 && w->cmd != CMD_RDSR && w->cmd != CMD_RDSR2 &&
+	    w->cmd != CMD_RDID && w->cmd != CMD_WRSR)
+		w->addr = (w->addr << 8) | out;
+
+	switch (w->cmd) {
+	case CMD_RDSR:
+		w->stats.status_polls++;
+		if (w->op != W25Q_OP_NONE && w->fast_forward) {
+			w->now = w->op_end;
+			w25q_settle(w);
+		}
+		in = w->sr1;
+		break;
+	case CMD_RDSR2:
+		in = w->sr2;
+		break;
+	case CMD_READ:
+		if (n >= 4)
+			in = w->mem[(w->addr + n - 4) & (W25Q_SIZE - 1)];
+		break;
+	case CMD_FREAD:
+		if (n >= 5)
+			in = w->mem[(w->addr + n - 5) & (W25Q_SIZE - 1)];
+		break;
+	case CMD_RSR:
+		if (n >= 5)
+			in = secreg_read(w, (w->addr & ~0xff) |
+			    ((w->addr + n - 5) & 0xff));
+		break;
+	case CMD_RDID:
+		if (n <= 3)
+			in = W25Q_JEDEC_ID >> (8 * (3 - n));
+		break;
+	case CMD_MDID:
+		if (n >= 4)
+			in = (n - 4) & 1 ? W25Q_JEDEC_ID & 0xff : W25Q_JEDEC_ID >> 16;
+		break;
+	case CMD_RUID:
+		if (n >= 5)
+			in = unique_id[(n - 5) & 7];
+		break;
+	case CMD_RPDID:
+		if (n >= 4)
+			in = 0x17;
+		break;
+	case CMD_PP:
+	case CMD_PSR:
+		if (n >= 4)
+			latch_byte(w, n - 4, out);
+		break;
+	case CMD_WRSR:
+		if (n <= 2)
+			w->latch[n - 1] = out;
+		break;
+	}
+	return in;
+}
+
+static bool
+write_enabled(struct w25q *w)
+{
+	if (w->sr1 & SR1_WEL)
+		return true;
+	w->stats.ignored++;
+	return false;
+}
+
+static uint64_t
+program_time(struct w25q *w, uint32_t count)
+{
+	uint64_t t;
+
+	t = w->timing->byte_prog_first +
+	    (uint64_t)(count - 1) * w->timing->byte_prog_next;
+	return t < w->timing->page_prog ? t : w->timing->page_prog;
+}
+
+static void
+start_erase(struct w25q *w, uint32_t size, uint64_t ns)
+{
+	if (w->nbytes != 4) {
+		w->stats.ignored++;
+		return;
+	}
+	if (write_enabled(w))
+		start_op(w, W25Q_OP_ERASE, w->addr & (W25Q_SIZE - 1) & ~(size - 1),
+		    size, ns);
+}
+
+void
+w25q_deselect(struct w25q *w)
+{
+	uint32_t count, reg;
+
+	w->now += w->cs_ns;
+	if (!w->powered || !w->selected)
+		return;
+	w->selected = false;
+	if (w->dropped || w->nbytes == 0)
+		return;
+
+	switch (w->cmd) {
+	case CMD_WREN:
+		w->sr1 |= SR1_WEL;
+		w->stats.wren++;
+		break;
+	case CMD_WRDI:
+		w->sr1 &= ~SR1_WEL;
+		break;
+	case CMD_READ:
+	case CMD_FREAD:
+	case CMD_RSR:
+		w->stats.reads++;
+		break;
+	case CMD_PP:
+		if (w->nbytes < 5) {
+			w->stats.ignored++;
+			break;
+		}
+		if (!write_enabled(w))
+			break;
+		count = w->nbytes - 4 > W25Q_PAGE_SIZE ? W25Q_PAGE_SIZE :
+		    w->nbytes - 4;
+		start_op(w, W25Q_OP_PROGRAM, w->addr & (W25Q_SIZE - 1), count,
+		    program_time(w, count));
+		break;
+	case CMD_SE:
+		start_erase(w, 0x1000, w->timing->erase_4k);
+		break;
+	case CMD_BE32:
+		start_erase(w, 0x8000, w->timing->erase_32k);
+		break;
+	case CMD_BE64:
+		start_erase(w, 0x10000, w->timing->erase_64k);
+		break;
+	case CMD_CE:
+	case CMD_CE2:
+		if (w->nbytes == 1 && write_enabled(w))
+			start_op(w, W25Q_OP_ERASE, 0, W25Q_SIZE,
+			    w->timing->erase_chip);
+		break;
+	case CMD_PSR:
+	case CMD_ESR:
+		reg = (w->addr >> 12) & 0xfff;
+		if (reg < 1 || reg > 3 || w->nbytes < 4 ||
+		    (w->sr2 & (1 << (SR2_LB_SHIFT + reg - 1)))) {
+			w->stats.ignored++;
+			break;
+		}
+		if (!write_enabled(w))
+			break;
+		if (w->cmd == CMD_ESR) {
+			start_op(w, W25Q_OP_SECREG_ERASE, w->addr & ~0xff,
+			    W25Q_PAGE_SIZE, w->timing->erase_4k);
+		} else if (w->nbytes > 4) {
+			count = w->nbytes - 4 > W25Q_PAGE_SIZE ?
+			    W25Q_PAGE_SIZE : w->nbytes - 4;
+			start_op(w, W25Q_OP_SECREG_PROGRAM, w->addr, count,
+			    program_time(w, count));
+		}
+		break;
+	case CMD_WRSR:
+		if (w->nbytes < 2 || w->nbytes > 3) {
+			w->stats.ignored++;
+			break;
+		}
+		if (w->nbytes == 2)
+			w->latch[1] = w->sr2;
+		if (write_enabled(w))
+			start_op(w, W25Q_OP_WRITE_SR, 0, 1, w->timing->write_sr);
+		break;
+	case CMD_PD:
+		w->powered_down = true;
+		break;
+	case CMD_RPDID:
+		w->powered_down = false;
+		break;
+	case CMD_RDSR:
+	case CMD_RDSR2:
+	case CMD_RDID:
+	case CMD_MDID:
+	case CMD_RUID:
+		break;
+	default:
+		w->stats.unsupported++;
+		break;
+	}
+}
+
+uint32_t
+w25q_max_erase_count(const struct w25q *w)
+{
+	uint32_t max = 0;
+	int i;
+
+	for (i = 0; i < W25Q_SECTORS; i++)
+		if (w->erase_count[i] > max)
+			max = w->erase_count[i];
+	return max;
+}
+
+struct w25q *
+w25q_create(const struct w25q_timing *timing)
+{
+	struct w25q *w;
+
+	w = calloc(1, sizeof(*w));
+	if (w == NULL)
+		return NULL;
+	w->mem = malloc(W25Q_SIZE);
+	if (w->mem == NULL) {
+		free(w);
+		return NULL;
+	}
+	memset(w->mem, 0xff, W25Q_SIZE);
+	memset(w->secreg, 0xff, sizeof(w->secreg));
+	w->timing = timing != NULL ? timing : &w25q_timing_typ;
+	/* SPI1 at 42MHz plus the polled send loop in sFLASH_SendByte */
+	w->byte_ns = 250;
+	w->cs_ns = 100;
+	w->fast_forward = true;
+	w->powered = true;
+	w->seed = 1;
+	if (w25q_dev == NULL)
+		w25q_dev = w;
+	return w;
+}
+
+void
+w25q_destroy(struct w25q *w)
+{
+	if (w25q_dev == w)
+		w25q_dev = NULL;
+	free(w->mem);
+	free(w);
+}
+
+int
+w25q_load(struct w25q *w, const char *path, uint32_t offset)
+{
+	FILE *f;
+	size_t n;
+
+	if ((f = fopen(path, "rb")) == NULL)
+		return -1;
+	n = fread(w->mem + offset, 1, W25Q_SIZE - offset, f);
+	fclose(f);
+	return (int)n;
+}
+
+int
+w25q_save(struct w25q *w, const char *path, uint32_t offset, uint32_t len)
+{
+	FILE *f;
+	size_t n;
+
+	if (offset > W25Q_SIZE || len > W25Q_SIZE - offset)
+		return -1;
+	if ((f = fopen(path, "wb")) == NULL)
+		return -1;
+	n = fwrite(w->mem + offset, 1, len, f);
+	if (fclose(f) != 0 || n != len)
+		return -1;
+	return (int)n;
+}
+
+/*
+ * {Glue for spi_flash.c}
+ */
+
+struct w25q *w25q_dev;
+
+void
+sFLASH_Init(void)
+{
+}
+
+void
+sFLASH_DeInit(void)
+{
+}
+
+uint8_t
+sFLASH_SendByte(uint8_t byte)
+{
+	return w25q_xfer(w25q_dev, byte);
+}
+
+uint16_t
+sFLASH_SendHalfWord(uint16_t HalfWord)
+{
+	return (w25q_xfer(w25q_dev, HalfWord >> 8) << 8) |
+	    w25q_xfer(w25q_dev, HalfWord & 0xff);
+}
@@ -0,0 +1,129 @@
+#ifndef _W25Q_EMU_H_
+#define _W25Q_EMU_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Host-side emulation of a Winbond W25Q128 SPI NOR flash.
+ *
+ * The emulator sits behind sFLASH_SendByte() and the chip select macros,
+ * so spi_flash.c and everything above it runs unmodified when built with
+ * -DSFLASH_EMU.  Time is virtual: every byte clocked and every chip
+ * select edge advances the clock, and program/erase operations keep the
+ * chip busy for their datasheet time.
+ *
+ * Modelled: program only clears bits, page program wraps within the
+ * page, WEL handling, commands ignored while busy, 4k/32k/64k/chip erase,
+ * security registers, per-sector erase counts and power loss at any
+ * byte or inside any program or erase, leaving partially programmed or
+ * erased data behind.
+ */
+
+#define W25Q_SIZE		0x1000000
+#define W25Q_PAGE_SIZE		256
+#define W25Q_SECTOR_SIZE	4096
+#define W25Q_SECTORS		(W25Q_SIZE / W25Q_SECTOR_SIZE)
+#define W25Q_JEDEC_ID		0xef4018
+
+/* Operation times in ns, from the W25Q128FV datasheet */
+struct w25q_timing {
+	uint32_t	byte_prog_first;	/* tBP1 */
+	uint32_t	byte_prog_next;		/* tBP2 */
+	uint32_t	page_prog;		/* tPP, upper bound */
+	uint32_t	erase_4k;		/* tSE */
+	uint32_t	erase_32k;		/* tBE1 */
+	uint32_t	erase_64k;		/* tBE2 */
+	uint64_t	erase_chip;		/* tCE */
+	uint32_t	write_sr;		/* tW */
+};
+
+extern const struct w25q_timing w25q_timing_typ;
+extern const struct w25q_timing w25q_timing_max;
+
+enum w25q_op {
+	W25Q_OP_NONE,
+	W25Q_OP_PROGRAM,
+	W25Q_OP_ERASE,
+	W25Q_OP_SECREG_PROGRAM,
+	W25Q_OP_SECREG_ERASE,
+	W25Q_OP_WRITE_SR
+};
+
+struct w25q_stats {
+	uint64_t	bytes;		/* Bytes clocked over SPI */
+	uint64_t	selects;	/* Chip select cycles */
+	uint64_t	reads;		/* Read commands */
+	uint64_t	programs;	/* Page programs executed */
+	uint64_t	erases;		/* Erases executed, any size */
+	uint64_t	wren;		/* Write enables */
+	uint64_t	status_polls;	/* Status register bytes read */
+	uint64_t	busy_ns;	/* Time spent busy */
+	uint64_t	ignored;	/* Commands dropped: busy, no WEL, bad length */
+	uint64_t	unsupported;	/* Unknown commands */
+};
+
+struct w25q {
+	uint8_t		*mem;
+	uint8_t		secreg[3][W25Q_PAGE_SIZE];
+	uint32_t	erase_count[W25Q_SECTORS];
+	const struct w25q_timing *timing;
+
+	/* Virtual clock */
+	uint64_t	now;		/* ns */
+	uint32_t	byte_ns;	/* Time to clock one byte */
+	uint32_t	cs_ns;		/* Time for a chip select edge */
+	bool		fast_forward;	/* Status polls skip to op end */
+
+	/* Status and the operation in progress */
+	uint8_t		sr1, sr2;
+	bool		powered;
+	bool		powered_down;	/* Deep power down (0xb9) */
+	enum w25q_op	op;
+	uint64_t	op_start, op_end;
+	uint32_t	op_addr, op_len;
+	uint8_t		latch[W25Q_PAGE_SIZE];
+
+	/* Command being clocked in */
+	bool		selected;
+	bool		dropped;	/* Ignored, chip was busy */
+	uint8_t		cmd;
+	uint32_t	nbytes;
+	uint32_t	addr;
+
+	/*
+	 * Power loss injection, counted in SPI bytes, or in program and
+	 * erase operations to land somewhere inside one.  0 disables.
+	 */
+	uint64_t	cut_after;
+	uint64_t	cut_ops;
+	void		(*cut_cb)(struct w25q *, void *);
+	void		*cut_arg;
+	uint32_t	seed;
+
+	struct w25q_stats stats;
+};
+
+/* The device sFLASH_SendByte() talks to */
+extern struct w25q *w25q_dev;
+
+struct w25q *w25q_create(const struct w25q_timing *timing);
+void w25q_destroy(struct w25q *);
+int w25q_load(struct w25q *, const char *path, uint32_t offset);
+int w25q_save(struct w25q *, const char *path, uint32_t offset, uint32_t len);
+
+void w25q_select(struct w25q *);
+void w25q_deselect(struct w25q *);
+uint8_t w25q_xfer(struct w25q *, uint8_t out);
+
+void w25q_advance(struct w25q *, uint64_t ns);
+void w25q_settle(struct w25q *);
+void w25q_cut_power(struct w25q *);
+void w25q_power_on(struct w25q *);
+void w25q_schedule_cut(struct w25q *, uint64_t bytes,
+    void (*cb)(struct w25q *, void *), void *arg);
+void w25q_schedule_cut_op(struct w25q *, uint64_t ops,
+    void (*cb)(struct w25q *, void *), void *arg);
+uint32_t w25q_max_erase_count(const struct w25q *);
+
+#endif
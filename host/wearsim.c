@@ -0,0 +1,348 @@
+/*
+ * Runs SPIFFS on the W25Q emulator until the flash wears out, with and
+ * without static wear levelling, to show what SPIFFS_wear_level_step()
+ * buys.  The partition is shrunk so a run takes seconds: it is formatted,
+ * filled with static files that are never touched again, then a few hot
+ * files are rewritten over and over, with a background GC step after
+ * each write as spiffs_gcd does.  Every "-i" writes it takes a wear
+ * levelling step at each spread given with -d, 0 meaning none.  A run
+ * ends when some block has been erased "-l" times, the endurance of this
+ * scaled down flash, and reports how much was written until then.
+ *
+ * The erase counts SPIFFS keeps are checked against the emulator's.
+ *
+ * usage: wearsim [-s seed] [-S KiB] [-F fill%] [-l limit] [-i interval]
+ *	  [-d spreads]
+ *	-S	size of the SPIFFS partition, default 2048
+ *	-F	percentage of the file system filled with static files
+ *	-l	erases of the most worn block that end a run
+ *	-i	hot file writes between wear levelling steps
+ *	-d	comma separated list of spreads, default 0,8,16,32
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "w25q_emu.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+
+#define MAX_LIST	16
+#define PAGE		256
+#define BLOCK		0x10000
+#define CACHE_PAGES	8
+#define FDS		4
+#define HOT_FILES	8
+#define HOT_SIZE	0x4000
+#define STATIC_SIZE	0x10000
+/* As spiffs_gcd */
+#define GCD_FREE_BLOCKS	6
+#define GCD_MIN_DELETED	(BLOCK / PAGE / 8)
+
+int32_t spiffs_gc_w_delet = 5;
+int32_t spiffs_gc_w_used = -1;
+int32_t spiffs_gc_w_erase_age = 50;
+
+struct result {
+	uint64_t	bytes;		/* Written to the hot files */
+	uint32_t	min, max;	/* Erases of the least and most worn */
+	uint32_t	moves;
+	int		agree;		/* Counts match the emulator's */
+};
+
+static struct w25q *dev;
+static spiffs fs;
+static uint8_t work[2 * PAGE];
+static uint8_t fds[FDS * sizeof(spiffs_fd) + 8];
+static uint8_t cache[sizeof(spiffs_cache) +
+    CACHE_PAGES * (sizeof(spiffs_cache_page) + PAGE) + 8];
+static uint8_t data[HOT_SIZE];
+
+/*
+ * {HAL, the same as spiffs_port.c without the partition checks}
+ */
+
+static s32_t
+hal_read(u32_t addr, u32_t size, u8_t *dst)
+{
+	sFLASH_CachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_write(u32_t addr, u32_t size, u8_t *src)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	sFLASH_WriteBuffer(src, addr, size);
+	return SPIFFS_OK;
+}
+
+static s32_t
+hal_erase(u32_t addr, u32_t size)
+{
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	if (size != BLOCK)
+		return -1;
+	sFLASH_Erase64KBlock(addr);
+	return SPIFFS_OK;
+}
+
+static s32_t
+mount(void)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+	spiffs_config cfg;
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.hal_read_f = hal_read;
+	cfg.hal_write_f = hal_write;
+	cfg.hal_erase_f = hal_erase;
+	cfg.phys_addr = p->start;
+	cfg.phys_size = p->size;
+	cfg.phys_erase_block = BLOCK;
+	cfg.log_block_size = BLOCK;
+	cfg.log_page_size = PAGE;
+	return SPIFFS_mount(&fs, &cfg, work, fds, sizeof(fds), cache,
+	    sizeof(cache), NULL);
+}
+
+/* Erases of SPIFFS block "bix" according to the emulator */
+static uint32_t
+dev_erases(uint32_t bix)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+
+	return dev->erase_count[(p->start + bix * BLOCK) / W25Q_SECTOR_SIZE];
+}
+
+static int
+fill(int pct)
+{
+	char name[16];
+	spiffs_file fh;
+	u32_t total, used, off;
+	int f;
+
+	if (SPIFFS_info(&fs, &total, &used) < 0)
+		return -1;
+	for (f = 0; used + STATIC_SIZE <= (uint64_t)total * pct / 100; f++) {
+		snprintf(name, sizeof(name), "s%04d", f);
+		fh = SPIFFS_open(&fs, name, SPIFFS_O_CREAT | SPIFFS_O_WRONLY,
+		    0);
+		if (fh < 0)
+			return -1;
+		for (off = 0; off < STATIC_SIZE; off += 0x1000)
+			if (SPIFFS_write(&fs, fh, data, 0x1000) != 0x1000)
+				return -1;
+		if (SPIFFS_close(&fs, fh) < 0 ||
+		    SPIFFS_info(&fs, &total, &used) < 0)
+			return -1;
+	}
+	return 0;
+}
+
+/* The same decision as gcd_need() in spiffs_gcd.c */
+static uint32_t
+gcd_need(void)
+{
+	uint32_t data = (BLOCK / PAGE - SPIFFS_OBJ_LOOKUP_PAGES(&fs)) *
+	    (fs.block_count - 2);
+	uint32_t deleted = fs.stats_p_deleted;
+	uint32_t used = fs.stats_p_allocated + deleted;
+	uint32_t free = data > used ? data - used : 0;
+
+	if (deleted == 0)
+		return 0;
+	if (fs.free_blocks < GCD_FREE_BLOCKS)
+		return GCD_MIN_DELETED;
+	if (deleted > free)
+		return BLOCK / PAGE - SPIFFS_OBJ_LOOKUP_PAGES(&fs);
+	return 0;
+}
+
+static int
+hot_write(int f)
+{
+	char name[16];
+	spiffs_file fh;
+	uint32_t min;
+	s32_t res;
+
+	snprintf(name, sizeof(name), "h%d", f);
+	fh = SPIFFS_open(&fs, name, SPIFFS_O_CREAT | SPIFFS_O_TRUNC |
+	    SPIFFS_O_WRONLY, 0);
+	if (fh < 0)
+		return -1;
+	data[0] = rand();
+	if (SPIFFS_write(&fs, fh, data, HOT_SIZE) != HOT_SIZE ||
+	    SPIFFS_close(&fs, fh) < 0)
+		return -1;
+	if ((min = gcd_need()) == 0)
+		return 0;
+	/* As many steps as gcd takes to get a block erased */
+	while ((res = SPIFFS_gc_step(&fs, min)) == 2)
+		;
+	return res < 0 ? -1 : 0;
+}
+
+static int
+run(uint32_t spread, int fill_pct, uint32_t limit, int interval,
+    struct result *r)
+{
+	u32_t counts[SPIFFS_WEAR_BLOCKS];
+	spiffs_wear_stats st;
+	uint32_t n, i;
+	int ops;
+
+	memset(r, 0, sizeof(*r));
+	(void)mount();
+	SPIFFS_unmount(&fs);
+	if (SPIFFS_format(&fs) < 0)
+		return -1;
+	/* Count from a fresh flash, the format's erases aside */
+	if (flash_part_erase(flash_part(FLASH_PART_SPIFFS_WEAR), 0,
+	    flash_part(FLASH_PART_SPIFFS_WEAR)->size) < 0)
+		return -1;
+	memset(dev->erase_count, 0, sizeof(dev->erase_count));
+	if (mount() < 0 || fill(fill_pct) < 0)
+		return -1;
+
+	for (ops = 1; ; ops++) {
+		if (hot_write(rand() % HOT_FILES) < 0)
+			return -1;
+		r->bytes += HOT_SIZE;
+		if (spread > 0 && ops % interval == 0 &&
+		    SPIFFS_wear_level_step(&fs, spread) < 0)
+			return -1;
+		if (SPIFFS_wear_stats(&fs, &st) < 0)
+			return -1;
+		if (st.max >= limit)
+			break;
+	}
+	r->min = st.min;
+	r->max = st.max;
+	r->moves = st.moves;
+	n = SPIFFS_wear_counts(&fs, counts, SPIFFS_WEAR_BLOCKS);
+	r->agree = 1;
+	for (i = 0; i < n; i++)
+		if (counts[i] != dev_erases(i))
+			r->agree = 0;
+	SPIFFS_unmount(&fs);
+
+	/* The counts survive a remount */
+	if (mount() < 0 ||
+	    SPIFFS_wear_counts(&fs, counts, SPIFFS_WEAR_BLOCKS) != (s32_t)n)
+		return -1;
+	for (i = 0; i < n; i++)
+		if (counts[i] != dev_erases(i))
+			r->agree = 0;
+	SPIFFS_unmount(&fs);
+	return 0;
+}
+
+static int
+parse_list(const char *s, long *v)
+{
+	char *end;
+	int n = 0;
+
+	do {
+		if (n == MAX_LIST)
+			return -1;
+		v[n++] = strtol(s, &end, 0);
+		if (end == s || (*end != ',' && *end != 0))
+			return -1;
+		s = end + 1;
+	} while (*end == ',');
+	return n;
+}
+
+static void
+usage(void)
+{
+	fprintf(stderr, "usage: wearsim [-s seed] [-S KiB] [-F fill%%] "
+	    "[-l limit] [-i interval]\n\t[-d spreads]\n");
+	exit(1);
+}
+
+int
+main(int argc, char **argv)
+{
+	long spreads[MAX_LIST] = { 0, 8, 16, 32 };
+	int ns = 4, fill_pct = 50, interval = 16, ch, i;
+	uint32_t size = 2048, limit = 200;
+	unsigned int seed = 1;
+	uint64_t base = 0;
+	struct result r;
+
+	while ((ch = getopt(argc, argv, "d:F:i:l:s:S:")) != -1) {
+		switch (ch) {
+		case 'd':
+			if ((ns = parse_list(optarg, spreads)) < 0)
+				usage();
+			break;
+		case 'F':
+			fill_pct = atoi(optarg);
+			break;
+		case 'i':
+			if ((interval = atoi(optarg)) <= 0)
+				usage();
+			break;
+		case 'l':
+			limit = strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			seed = strtoul(optarg, NULL, 0);
+			break;
+		case 'S':
+			size = strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage();
+		}
+	}
+	if ((dev = w25q_create(&w25q_timing_typ)) == NULL) {
+		perror("w25q_create");
+		return 1;
+	}
+	w25q_dev = dev;
+	dev->seed = seed;
+	sFLASH_Init();
+	sFLASH_CacheInit();
+	flash_part_init();
+	if (size * 1024 % BLOCK != 0 ||
+	    size * 1024 > flash_parts[FLASH_PART_SPIFFS].size ||
+	    size * 1024 / BLOCK > SPIFFS_WEAR_BLOCKS)
+		usage();
+	flash_parts[FLASH_PART_SPIFFS].size = size * 1024;
+	for (i = 0; i < (int)sizeof(data); i++)
+		data[i] = i * 7 + 3;
+
+	printf("%u KiB, %d%% static, worn out at %u erases, "
+	    "a step every %d writes\n", size, fill_pct, limit, interval);
+	printf("spread   MiB written  lifetime  erases min-max  moves  counts\n");
+	for (i = 0; i < ns; i++) {
+		srand(seed);
+		if (run(spreads[i], fill_pct, limit, interval, &r) < 0) {
+			printf("%6ld failed, %d\n", spreads[i],
+			    (int)SPIFFS_errno(&fs));
+			continue;
+		}
+		if (base == 0)
+			base = r.bytes;
+		printf("%6ld %13.1f %8.2fx %9u-%-5u %6u  %s\n", spreads[i],
+		    r.bytes / 1048576.0, (double)r.bytes / base, r.min, r.max,
+		    r.moves, r.agree ? "ok" : "MISMATCH");
+	}
+	w25q_destroy(dev);
+	return 0;
+}
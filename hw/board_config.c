@@ -0,0 +1,76 @@
+#include <string.h>
+
+#include "board_config.h"
+#include "spi_flash.h"
+
+static struct board_config cfg;
+static bool cfg_read;
+
+/* MADCTL for each LCD variant: rotation and RGB/BGR order */
+static const uint8_t lcd_madctl[4] = {
+	0xa0,	/* MD-380? */
+	0x60,	/* MD-390 */
+	0xa8,	/* ??? */
+	0xa7	/* ??? */
+};
+
+/* An erased page, or a dead bus, reads back as all ones or all zeros. */
+static bool
+page_blank(const uint8_t *p)
+{
+	int i;
+
+	for (i = 1; i < BOARD_SECREG_SIZE; i++)
+		if (p[i] != p[0])
+			return false;
+	return p[0] == 0xff || p[0] == 0x00;
+}
+
+void
+board_config_init(void)
+{
+	uint8_t v;
+	int i;
+
+	if (cfg_read)
+		return;
+	/* One read command per page, RSR does not cross register pages */
+	for (i = 0; i < BOARD_SECREG_PAGES; i++)
+		sFLASH_ReadSecurityBuffer(cfg.secreg[i], (i + 1) << 12,
+		    BOARD_SECREG_SIZE);
+	cfg.valid = !page_blank(cfg.secreg[2]);
+	if (cfg.valid) {
+		v = cfg.secreg[2][BOARD_LCD_CONFIG & 0xff] & 3;
+		cfg.lcd_variant = v;
+		cfg.model = v == 0 ? BOARD_MODEL_MD380 :
+		    v == 1 ? BOARD_MODEL_MD390 : BOARD_MODEL_UNKNOWN;
+	} else {
+		/* Nothing usable, assume the most common radio */
+		cfg.lcd_variant = 0;
+		cfg.model = BOARD_MODEL_UNKNOWN;
+	}
+	cfg.lcd_madctl = lcd_madctl[cfg.lcd_variant];
+	cfg_read = true;
+}
+
+const struct board_config *
+board_config(void)
+{
+	return &cfg;
+}
+
+/*
+ * Returns the cached copy of security register bytes addr..addr+len-1,
+ * addressed the way sFLASH_ReadSecurityBuffer() takes them, or NULL if
+ * the range is outside a single register page.
+ */
+const uint8_t *
+board_secreg(uint32_t addr, size_t len)
+{
+	uint32_t page = addr >> 12, off = addr & 0xfff;
+
+	if (page < 1 || page > BOARD_SECREG_PAGES ||
+	    off >= BOARD_SECREG_SIZE || len > BOARD_SECREG_SIZE - off)
+		return NULL;
+	return &cfg.secreg[page - 1][off];
+}
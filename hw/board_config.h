@@ -0,0 +1,42 @@
+#ifndef _BOARD_CONFIG_H_
+#define _BOARD_CONFIG_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Per-unit configuration, programmed by the factory into the three
+ * security register pages of the SPI flash (0x1000, 0x2000, 0x3000).
+ * board_config_init() reads them once; everything else uses the copy.
+ */
+
+#define BOARD_SECREG_PAGES	3
+#define BOARD_SECREG_SIZE	256
+
+/* Byte in page 3 holding the LCD variant in its low two bits */
+#define BOARD_LCD_CONFIG	0x301d
+
+enum board_model {
+	BOARD_MODEL_UNKNOWN,
+	BOARD_MODEL_MD380,
+	BOARD_MODEL_MD390
+};
+
+struct board_config {
+	bool		valid;		/* Registers read back as programmed */
+	uint8_t		lcd_variant;	/* 0-3, see LCD_Init() */
+	uint8_t		lcd_madctl;	/* MADCTL value for this panel */
+	enum board_model model;
+	/*
+	 * Raw register contents.  Calibration data lives in here too, but
+	 * its layout is not known yet, so it is left undecoded.
+	 */
+	uint8_t		secreg[BOARD_SECREG_PAGES][BOARD_SECREG_SIZE];
+};
+
+void board_config_init(void);
+const struct board_config *board_config(void);
+const uint8_t *board_secreg(uint32_t addr, size_t len);
+
+#endif
@@ -0,0 +1,381 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "crc.h"
+#include "spi_flash.h"
+
+#define CRC_POLY	0x04c11db7
+#define CRC_HW_MIN	16	/* Words; below this restoring the state costs more */
+#define SFLASH_CHUNK	512	/* Bytes per SPI read when checking flash */
+
+#ifdef CRC_SOFT
+#define CRC_LOCK()
+#define CRC_UNLOCK()
+static const bool hw_ready = false;
+#else
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "stm32f4xx.h"
+#include "stm32f4xx_crc.h"
+#include "stm32f4xx_dma.h"
+#include "stm32f4xx_rcc.h"
+
+/* Only DMA2 can do memory to memory transfers */
+#define CRC_DMA_STREAM	DMA2_Stream1
+#define CRC_DMA_CHANNEL	DMA_Channel_0
+#define CRC_DMA_IRQn	DMA2_Stream1_IRQn
+#define CRC_DMA_TC	DMA_IT_TCIF1
+#define CRC_DMA_TE	DMA_IT_TEIF1
+#define CRC_DMA_MIN	64	/* Words; below this the setup costs more */
+#define CRC_DMA_MAX	0xffff
+
+static SemaphoreHandle_t crc_mutex;
+static SemaphoreHandle_t dma_done;
+static volatile bool dma_error;
+static bool hw_ready;
+
+#define CRC_LOCK()	xSemaphoreTake(crc_mutex, portMAX_DELAY)
+#define CRC_UNLOCK()	xSemaphoreGive(crc_mutex)
+#endif
+
+static struct crc_stats stats;
+
+/* The register after shifting in four more zero bits, by top nibble */
+static const uint32_t nibble_table[16] = {
+	0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9,
+	0x130476dc, 0x17c56b6b, 0x1a864db2, 0x1e475005,
+	0x2608edb8, 0x22c9f00f, 0x2f8ad6d6, 0x2b4bcb61,
+	0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd,
+};
+
+static inline uint32_t
+sw_word(uint32_t crc, uint32_t w)
+{
+	int i;
+
+	crc ^= w;
+	for (i = 0; i < 8; i++)
+		crc = (crc << 4) ^ nibble_table[crc >> 28];
+	return crc;
+}
+
+static inline uint32_t
+sw_byte(uint32_t crc, uint8_t b)
+{
+	crc ^= (uint32_t)b << 24;
+	crc = (crc << 4) ^ nibble_table[crc >> 28];
+	return (crc << 4) ^ nibble_table[crc >> 28];
+}
+
+uint32_t
+crc_sw_words(uint32_t crc, const uint32_t *w, size_t n)
+{
+	while (n--)
+		crc = sw_word(crc, *w++);
+	return crc;
+}
+
+#ifndef CRC_SOFT
+/*
+ * The unit can only be reset to 0xffffffff.  To carry on from another
+ * value, feed it the one word that takes it from reset to that value,
+ * found by running the register backwards.
+ */
+static uint32_t
+seed_word(uint32_t crc)
+{
+	int i;
+
+	for (i = 0; i < 32; i++)
+		crc = (crc & 1) ? ((crc ^ CRC_POLY) >> 1) | 0x80000000 :
+		    crc >> 1;
+	return crc ^ CRC_INIT;
+}
+
+static void
+hw_restore(uint32_t crc)
+{
+	CRC_ResetDR();
+	if (crc != CRC_INIT)
+		CRC->DR = seed_word(crc);
+}
+
+static inline bool
+dma_reachable(const uint32_t *w, size_t n)
+{
+	/* Word aligned and not in CCM, which is wired to the core only */
+	return n >= CRC_DMA_MIN && ((uintptr_t)w & 3) == 0 &&
+	    ((uintptr_t)w & 0xffff0000) != 0x10000000;
+}
+
+static void
+dma_start(const uint32_t *w, size_t n)
+{
+	DMA_InitTypeDef dma;
+
+	DMA_StructInit(&dma);
+	dma.DMA_Channel = CRC_DMA_CHANNEL;
+	dma.DMA_PeripheralBaseAddr = (uint32_t)w;	/* Source */
+	dma.DMA_Memory0BaseAddr = (uint32_t)&CRC->DR;	/* Destination */
+	dma.DMA_DIR = DMA_DIR_MemoryToMemory;
+	dma.DMA_BufferSize = n;
+	dma.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+	dma.DMA_MemoryInc = DMA_MemoryInc_Disable;
+	dma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+	dma.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+	/* Memory to memory needs the FIFO */
+	dma.DMA_FIFOMode = DMA_FIFOMode_Enable;
+	dma.DMA_FIFOThreshold = DMA_FIFOThreshold_Full;
+	DMA_Init(CRC_DMA_STREAM, &dma);
+	dma_error = false;
+	DMA_ITConfig(CRC_DMA_STREAM, DMA_IT_TC | DMA_IT_TE, ENABLE);
+	DMA_Cmd(CRC_DMA_STREAM, ENABLE);
+}
+
+static int
+dma_wait(void)
+{
+	xSemaphoreTake(dma_done, portMAX_DELAY);
+	return dma_error ? -1 : 0;
+}
+
+void
+DMA2_Stream1_IRQHandler(void)
+{
+	BaseType_t woken = pdFALSE;
+
+	if (DMA_GetITStatus(CRC_DMA_STREAM, CRC_DMA_TE) != RESET) {
+		DMA_ClearITPendingBit(CRC_DMA_STREAM, CRC_DMA_TE);
+		dma_error = true;
+	}
+	if (DMA_GetITStatus(CRC_DMA_STREAM, CRC_DMA_TC) != RESET)
+		DMA_ClearITPendingBit(CRC_DMA_STREAM, CRC_DMA_TC);
+	xSemaphoreGiveFromISR(dma_done, &woken);
+	portYIELD_FROM_ISR(woken);
+}
+
+static void
+cpu_feed(const uint32_t *w, size_t n)
+{
+	stats.cpu_words += n;
+	while (n--)
+		CRC->DR = *w++;
+}
+
+/* Feeds words to the unit, which must hold the CRC so far. */
+static void
+hw_feed(const uint32_t *w, size_t n)
+{
+	uint32_t prev;
+	size_t m;
+
+	while (n > 0) {
+		if (!dma_reachable(w, n)) {
+			cpu_feed(w, n);
+			return;
+		}
+		m = n > CRC_DMA_MAX ? CRC_DMA_MAX : n;
+		prev = CRC->DR;
+		dma_start(w, m);
+		if (dma_wait() == 0) {
+			stats.dma_words += m;
+		} else {
+			stats.dma_errors++;
+			hw_restore(prev);
+			cpu_feed(w, m);
+		}
+		w += m;
+		n -= m;
+	}
+}
+
+void
+crc_init(void)
+{
+	if (hw_ready)
+		return;
+	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_CRC | RCC_AHB1Periph_DMA2,
+	    ENABLE);
+	crc_mutex = xSemaphoreCreateMutex();
+	dma_done = xSemaphoreCreateBinary();
+	NVIC_SetPriority(CRC_DMA_IRQn, configLIBRARY_LOWEST_INTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(CRC_DMA_IRQn);
+	hw_ready = true;
+}
+#else
+void
+crc_init(void)
+{
+}
+#endif
+
+void
+crc_stats(struct crc_stats *st)
+{
+	if (!hw_ready) {
+		memset(st, 0, sizeof(*st));
+		return;
+	}
+	CRC_LOCK();
+	*st = stats;
+	CRC_UNLOCK();
+}
+
+static void
+words(struct crc_ctx *ctx, const uint32_t *w, size_t n)
+{
+	if (!hw_ready || n < CRC_HW_MIN) {
+		ctx->crc = crc_sw_words(ctx->crc, w, n);
+		return;
+	}
+#ifndef CRC_SOFT
+	CRC_LOCK();
+	hw_restore(ctx->crc);
+	hw_feed(w, n);
+	ctx->crc = CRC->DR;
+	CRC_UNLOCK();
+#endif
+}
+
+void
+crc_start(struct crc_ctx *ctx)
+{
+	ctx->crc = CRC_INIT;
+	ctx->ncarry = 0;
+}
+
+void
+crc_update(struct crc_ctx *ctx, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+	uint32_t bounce[32];
+	uint32_t w;
+	size_t n;
+
+	/* Complete a word left over from the last call */
+	if (ctx->ncarry > 0) {
+		n = 4 - ctx->ncarry;
+		if (len < n) {
+			memcpy(ctx->carry + ctx->ncarry, p, len);
+			ctx->ncarry += len;
+			return;
+		}
+		memcpy(&w, ctx->carry, ctx->ncarry);
+		memcpy((uint8_t *)&w + ctx->ncarry, p, n);
+		ctx->crc = sw_word(ctx->crc, w);
+		p += n;
+		len -= n;
+		ctx->ncarry = 0;
+	}
+	if (((uintptr_t)p & 3) == 0) {
+		n = len / 4;
+		words(ctx, (const uint32_t *)p, n);
+		p += n * 4;
+		len -= n * 4;
+	} else {
+		for (; len >= 4; p += n * 4, len -= n * 4) {
+			n = len / 4 > 32 ? 32 : len / 4;
+			memcpy(bounce, p, n * 4);
+			words(ctx, bounce, n);
+		}
+	}
+	memcpy(ctx->carry, p, len);
+	ctx->ncarry = len;
+}
+
+uint32_t
+crc_final(struct crc_ctx *ctx)
+{
+	uint32_t crc = ctx->crc;
+	int i;
+
+	for (i = 0; i < ctx->ncarry; i++)
+		crc = sw_byte(crc, ctx->carry[i]);
+	return crc;
+}
+
+uint32_t
+crc_block(const void *buf, size_t len)
+{
+	struct crc_ctx ctx;
+
+	crc_start(&ctx);
+	crc_update(&ctx, buf, len);
+	return crc_final(&ctx);
+}
+
+#ifndef CRC_SOFT
+/*
+ * Reads the next chunk over SPI while the DMA feeds the last one to
+ * the unit, so checking flash costs little more than reading it.
+ */
+static uint32_t
+hw_sflash(uint32_t addr, uint32_t len)
+{
+	static uint32_t buf[2][SFLASH_CHUNK / 4];	/* Not CCM */
+	uint32_t n, next, prev, crc;
+	int cur = 0;
+
+	CRC_LOCK();
+	CRC_ResetDR();
+	n = len > SFLASH_CHUNK ? SFLASH_CHUNK : len;
+	sFLASH_ReadBuffer((uint8_t *)buf[cur], addr, n);
+	while (n > 0) {
+		prev = CRC->DR;
+		dma_start(buf[cur], n / 4);
+		addr += n;
+		len -= n;
+		next = len > SFLASH_CHUNK ? SFLASH_CHUNK : len;
+		if (next > 0)
+			sFLASH_ReadBuffer((uint8_t *)buf[cur ^ 1], addr, next);
+		if (dma_wait() == 0) {
+			stats.dma_words += n / 4;
+		} else {
+			stats.dma_errors++;
+			hw_restore(prev);
+			cpu_feed(buf[cur], n / 4);
+		}
+		cur ^= 1;
+		n = next;
+	}
+	crc = CRC->DR;
+	CRC_UNLOCK();
+	return crc;
+}
+#endif
+
+uint32_t
+crc_sflash(uint32_t addr, uint32_t len)
+{
+	struct crc_ctx ctx;
+	uint32_t buf[64];
+	uint32_t n;
+
+	crc_start(&ctx);
+#ifndef CRC_SOFT
+	if (hw_ready && len >= 2 * SFLASH_CHUNK) {
+		n = len & ~(uint32_t)(CRC_DMA_MIN * 4 - 1);
+		ctx.crc = hw_sflash(addr, n);
+		addr += n;
+		len -= n;
+	}
+#endif
+	for (; len > 0; len -= n, addr += n) {
+		n = len > sizeof(buf) ? sizeof(buf) : len;
+		sFLASH_ReadBuffer((uint8_t *)buf, addr, n);
+		crc_update(&ctx, buf, n);
+	}
+	return crc_final(&ctx);
+}
+
+#ifndef CRC_SOFT
+/* Set by the linker script: the image as written by md380_fw.py */
+extern const uint32_t _fw_start[], _fw_end[];
+
+int
+crc_image(uint32_t *crc)
+{
+	*crc = crc_block(_fw_start, (_fw_end - _fw_start) * 4);
+	return *crc == *_fw_end ? 0 : -1;
+}
+#endif
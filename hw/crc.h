@@ -0,0 +1,54 @@
+#ifndef _CRC_H_
+#define _CRC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * CRC32 on the STM32 CRC unit: polynomial 0x04c11db7, initial value
+ * 0xffffffff, no reflection and no final xor (CRC-32/MPEG-2), computed
+ * over 32-bit words.  Byte streams are fed as little endian words; the
+ * zero to three bytes left over at the end are folded in one at a time,
+ * most significant bit first.  crc32_stm32() in md380tools/md380_fw.py
+ * computes the same thing.
+ *
+ * Large word-aligned blocks are moved into the unit by DMA.  Until
+ * crc_init() has run, and in host builds (CRC_SOFT), everything is
+ * computed in software with identical results.
+ */
+
+#define CRC_INIT	0xffffffff
+
+struct crc_ctx {
+	uint32_t	crc;
+	uint8_t		carry[3];	/* Bytes not yet making up a word */
+	uint8_t		ncarry;
+};
+
+struct crc_stats {
+	uint32_t	dma_words;	/* Words fed by DMA */
+	uint32_t	cpu_words;	/* Words fed by the CPU */
+	uint32_t	dma_errors;	/* Transfers redone by the CPU */
+};
+
+void crc_init(void);
+void crc_stats(struct crc_stats *);
+
+void crc_start(struct crc_ctx *);
+void crc_update(struct crc_ctx *, const void *buf, size_t len);
+uint32_t crc_final(struct crc_ctx *);
+uint32_t crc_block(const void *buf, size_t len);
+
+/* Software reference, also used where the unit cannot be */
+uint32_t crc_sw_words(uint32_t crc, const uint32_t *w, size_t n);
+
+/* CRC of a range of the external SPI flash */
+uint32_t crc_sflash(uint32_t addr, uint32_t len);
+
+/*
+ * Checks the CRC md380_fw.py --crc appends to the application image.
+ * Returns 0 if it matches, -1 if not (or if there is none).
+ */
+int crc_image(uint32_t *crc);
+
+#endif
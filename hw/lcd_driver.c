@@ -13,10 +13,10 @@
 #include <stdlib.h>
 #include <string.h>       // memset(), ...
 
+#include "board_config.h"
 #include "gpio.h"
 #include "lcd_driver.h"   // constants + API prototypes for the *alternative* LCD driver (no "gfx")
 #include "task.h"
-#include "spi_flash.h"
 #include "stm32f4xx.h"
 #include "stm32f4xx_fsmc.h"
 #include "stm32f4xx_rcc.h"
@@ -40,6 +40,7 @@ extern const uint8_t font_8_8[256*8]; // extra font with 256 characters from 'co
 
 #define LCD_WriteCommand(cmd)	*(volatile uint8_t*)0x60000000 = cmd
 #define LCD_WriteData(dta)	*(volatile uint8_t*)0x60040000 = dta
+#define LCD_ReadData()		(*(volatile uint8_t*)0x60040000)
 #define LCD_WritePixel(clr)				\
 	do {						\
 		LCD_WriteData(((clr) >> 8) & 0xff);	\
@@ -70,14 +71,13 @@ LimitUInt8( uint8_t *piValue, uint8_t min, uint8_t max)
 
 
 /*
- * Sets the coordinates before writing a rectangular area of pixels.
- * Returns the NUMBER OF PIXELS which must be sent to the controller
- * after setting the rectangle.
+ * Sets the coordinates of a rectangular area of pixels and returns the
+ * NUMBER OF PIXELS in it.
  *
  * Request LCD_EnablePort() to have been called.
  */
 static uint16_t
-LCD_SetOutputRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+LCD_SetRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 {
 	// Crude clipping, not bullet-proof but better than nothing:
 	LimitUInt8(&x1, 0, LCD_SCREEN_WIDTH-1);
@@ -100,11 +100,26 @@ LCD_SetOutputRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
 	LCD_WriteData(y2);
 	LCD_WriteData(y2);
 
-	LCD_WriteCommand(LCD_CMD_RAMWR);
-
 	return (1+x2-x1) * (1+y2-y1);
 }
 
+/*
+ * Sets the coordinates before writing a rectangular area of pixels.
+ * Returns the NUMBER OF PIXELS which must be sent to the controller
+ * after setting the rectangle.
+ *
+ * Request LCD_EnablePort() to have been called.
+ */
+static uint16_t
+LCD_SetOutputRect(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2)
+{
+	uint16_t n = LCD_SetRect(x1, y1, x2, y2);
+
+	if (n > 0)
+		LCD_WriteCommand(LCD_CMD_RAMWR);
+	return n;
+}
+
 /*
  * Inefficient method to draw anything (except maybe 'thin BRESENHAM lines').
  * Similar to Tytera's 'gfx_write_pixel_to_framebuffer' @0x08033728 in D13.020 .
@@ -220,7 +235,7 @@ LCD_FastColourGradient(void)
  * position, width, and height.
  */
 void
-LCD_DrawRGB(uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+LCD_DrawRGB(const uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
 {
 	uint16_t i;
 	uint8_t xx, yy;
@@ -237,13 +252,70 @@ LCD_DrawRGB(uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
 	LCD_ReleasePort();
 }
 
+/*
+ * Draws an RGB image in pieces as they are read: LCD_BeginRGB() sets up
+ * the rectangle, LCD_WriteRGB() takes the pixels high byte first in pieces
+ * of any length, and LCD_EndRGB() finishes.  The port is held in between.
+ */
+int
+LCD_BeginRGB(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	int n;
+
+	LCD_EnablePort();
+	if ((n = LCD_SetOutputRect(x, y, x + w - 1, y + h - 1)) <= 0)
+		LCD_ReleasePort();
+	return n;
+}
+
+void
+LCD_WriteRGB(const uint8_t *buf, uint32_t len)
+{
+	while (len-- > 0)
+		LCD_WriteData(*buf++);
+}
+
+void
+LCD_EndRGB(void)
+{
+	LCD_ReleasePort();
+}
+
+/*
+ * Reads back a rectangle of the screen into "buf" as RGB565, high byte
+ * first like LCD_WriteRGB() takes it.  The controller sends a dummy byte,
+ * then 18 bit colour as three bytes a pixel whatever COLMOD says.
+ * Returns the number of pixels read.
+ */
+int
+LCD_ReadRGB(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *buf)
+{
+	uint8_t r, g, b;
+	int i, n;
+
+	LCD_EnablePort();
+	if ((n = LCD_SetRect(x, y, x + w - 1, y + h - 1)) > 0) {
+		LCD_WriteCommand(LCD_CMD_RAMRD);
+		(void)LCD_ReadData();
+		for (i = 0; i < n; i++) {
+			r = LCD_ReadData();
+			g = LCD_ReadData();
+			b = LCD_ReadData();
+			*buf++ = (r & 0xf8) | g >> 5;
+			*buf++ = (g & 0x1c) << 3 | b >> 3;
+		}
+	}
+	LCD_ReleasePort();
+	return n;
+}
+
 /*
  * Draws an RGB image as LCD_DrawRGB, but with a transparent colour specified.
  * If a pixel is of the transparent colour, it is not drawn, and the screen at
  * that position remains unchanged.
  */
 void
-LCD_DrawRGBTransparent(uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t t)
+LCD_DrawRGBTransparent(const uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t t)
 {
 	uint16_t i;
 	uint8_t xx, yy;
@@ -682,12 +754,10 @@ LCD_ReleasePort(void)
 	xSemaphoreGive(LCD_Mutex);
 }
 
-extern uint16_t wlarc_logo[20480];
+extern const uint16_t wlarc_logo[20480];
 void LCD_Init(void)
 {
-	uint8_t config;
-
-	sFLASH_ReadSecurityBuffer(&config, 0x301d, 1);
+	board_config_init();
 	LCD_Mutex = xSemaphoreCreateMutex();
 	RCC_AHB3PeriphClockCmd(RCC_AHB3Periph_FSMC, ENABLE);
 	RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_GPIOC, ENABLE);
@@ -702,20 +772,7 @@ void LCD_Init(void)
 	LCD_WriteCommand(LCD_CMD_COLMOD);
 	LCD_WriteData(0x05);	// 16bpp
 	LCD_WriteCommand(LCD_CMD_MADCTL);
-	switch (config & 3) {
-	case 0x00:	/* MD-380? */
-		LCD_WriteData(0xa0);
-		break;
-	case 0x01:	/* MD-390 */
-		LCD_WriteData(0x60);
-		break;
-	case 0x02:	/* ??? */
-		LCD_WriteData(0xa8);
-		break;
-	case 0x03:	/* ??? */
-		LCD_WriteData(0xa7);
-		break;
-	}
+	LCD_WriteData(board_config()->lcd_madctl);
 	LCD_WriteCommand(LCD_CMD_SETCYC);
 	LCD_WriteData(0x00);	// Column inversion, 89 clocks per line
 	LCD_WriteCommand(LCD_CMD_SLPOUT);
@@ -171,8 +171,12 @@ uint8_t LCD_Printf(lcd_context_t *pContext, const char *fmt, ... );
   // Almost the same as LCD_DrawString,
   // but with all goodies supported by tinyprintf .
 
-void LCD_DrawRGB(uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h);
-void LCD_DrawRGBTransparent(uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t t);
+void LCD_DrawRGB(const uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+int LCD_BeginRGB(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+void LCD_WriteRGB(const uint8_t *buf, uint32_t len);
+void LCD_EndRGB(void);
+int LCD_ReadRGB(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *buf);
+void LCD_DrawRGBTransparent(const uint16_t *rgb, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t t);
 void LCD_DrawCircle(uint8_t x, uint8_t y, uint8_t r, uint16_t c, bool f);
 void LCD_DrawRectangle(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint16_t c, bool f);
 void LCD_DrawLine(uint8_t x, uint8_t y, uint8_t xx, uint8_t yy, uint16_t c);
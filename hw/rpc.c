@@ -0,0 +1,607 @@
+/*
+ * Framed requests over the USB serial port, see rpc.h.
+ *
+ * One task reads the port, splits what comes in into frames at the zero
+ * bytes and serves each request in turn, writing its response before it
+ * decodes the next.  Requests the host sends ahead wait in the USB
+ * receive ring, which NAKs the host when it is full, so pipelining needs
+ * no queue here.
+ *
+ * Each response is written with one usb_cdc_write_timeout(), which the
+ * text other tasks log cannot split, and starts with a zero byte too.
+ * A request sent again because its response was lost must do no harm
+ * the second time, see rpc.h.
+ *
+ * The host may only write and erase the partitions no driver owns, and
+ * opens files through its own slots, so it cannot touch what the
+ * firmware has open.  RPC_INFO starts a session and closes the files the
+ * last one left open.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "controls.h"
+#include "crc.h"
+#include "flash_part.h"
+#include "lcd_driver.h"
+#include "rpc.h"
+#include "sflash_cache.h"
+#include "spi_flash.h"
+#include "spiffs.h"
+#include "spiffs_port.h"
+#include "usb_cdc.h"
+
+#define RPC_STACK	768
+#define RPC_PRIORITY	1
+#define RPC_FILES	4
+#define RPC_TX_TIMEOUT	pdMS_TO_TICKS(1000)
+/* Decoded frame, and COBS encoded between its two delimiters */
+#define RPC_FRAME	(sizeof(struct rpc_hdr) + RPC_MAX_PAYLOAD + 4)
+#define RPC_WIRE	(RPC_FRAME + RPC_FRAME / 254 + 3)
+
+/* Partitions the host may write */
+#define RPC_WRITABLE	(1 << FLASH_PART_ASSETS | 1 << FLASH_PART_CONTACTS | \
+			 1 << FLASH_PART_STAGING)
+
+struct rpc_cmd_def {
+	uint8_t		cmd;
+	int32_t		(*fn)(const uint8_t *, uint32_t, uint8_t *);
+};
+
+static TaskHandle_t rpc_task;
+static struct rpc_stats stats;
+static uint8_t rx_wire[RPC_WIRE];	/* Decoded in place */
+static uint8_t tx_frame[RPC_FRAME];
+static uint8_t tx_wire[RPC_WIRE];
+static uint8_t tx_seq;
+static int16_t rx_seq = -1;		/* Last seen, -1 before the first */
+static spiffs_file files[RPC_FILES];
+static bool files_open[RPC_FILES];
+static uint16_t files_oflags[RPC_FILES];
+static char files_name[RPC_FILES][SPIFFS_OBJ_NAME_LEN];
+
+static uint32_t
+cobs_encode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t code_at = 0, o = 1, i;
+	uint8_t code = 1;
+
+	for (i = 0; i < len; i++) {
+		if (src[i] != 0) {
+			dst[o++] = src[i];
+			if (++code != 0xff)
+				continue;
+		}
+		dst[code_at] = code;
+		code_at = o++;
+		code = 1;
+	}
+	dst[code_at] = code;
+	return o;
+}
+
+/* Returns the decoded length, or -1 if "src" is not COBS */
+static int32_t
+cobs_decode(const uint8_t *src, uint32_t len, uint8_t *dst)
+{
+	uint32_t i = 0, o = 0, n;
+	uint8_t code;
+
+	while (i < len) {
+		code = src[i++];
+		if (code == 0 || code - 1U > len - i)
+			return -1;
+		for (n = 1; n < code; n++)
+			dst[o++] = src[i++];
+		if (code != 0xff && i < len)
+			dst[o++] = 0;
+	}
+	return o;
+}
+
+static const struct flash_part *
+rpc_part(const uint8_t *req, uint32_t len, struct rpc_flash_req *fr,
+    bool write)
+{
+	if (len < sizeof(*fr))
+		return NULL;
+	memcpy(fr, req, sizeof(*fr));
+	if (fr->part >= FLASH_PART_COUNT ||
+	    (write && (RPC_WRITABLE & 1 << fr->part) == 0))
+		return NULL;
+	return flash_part(fr->part);
+}
+
+/* The name in the rest of a request, NUL terminated into "name" */
+static int32_t
+rpc_name(const uint8_t *req, uint32_t len, char *name)
+{
+	if (len == 0 || len >= SPIFFS_OBJ_NAME_LEN ||
+	    memchr(req, 0, len) != NULL)
+		return RPC_ERR_ARG;
+	memcpy(name, req, len);
+	name[len] = 0;
+	return 0;
+}
+
+/* Seeks the file of the request to its offset */
+static int32_t
+rpc_file(const uint8_t *req, uint32_t len, struct rpc_file_req *fr)
+{
+	int32_t res;
+
+	if (len < sizeof(*fr))
+		return RPC_ERR_ARG;
+	memcpy(fr, req, sizeof(*fr));
+	if (fr->fd >= RPC_FILES || !files_open[fr->fd])
+		return RPC_ERR_ARG;
+	res = SPIFFS_lseek(&spiffs_fs, files[fr->fd], fr->off,
+	    SPIFFS_SEEK_SET);
+	return res < 0 ? res : 0;
+}
+
+static void
+rpc_close_all(void)
+{
+	int i;
+
+	for (i = 0; i < RPC_FILES; i++) {
+		if (files_open[i])
+			(void)SPIFFS_close(&spiffs_fs, files[i]);
+		files_open[i] = false;
+	}
+}
+
+static void
+rpc_stat_out(struct rpc_file_stat *st, uint32_t size, uint8_t type,
+    const uint8_t *name)
+{
+	memset(st, 0, sizeof(*st));
+	st->size = size;
+	st->type = type;
+	strncpy(st->name, (const char *)name, sizeof(st->name) - 1);
+}
+
+static int32_t
+rpc_ping(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	if (len > RPC_MAX_DATA)
+		return RPC_ERR_ARG;
+	memcpy(out, req, len);
+	return len;
+}
+
+static int32_t
+rpc_info(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_info info;
+	struct rpc_part rp;
+	const struct flash_part *p;
+	int i;
+
+	(void)req;
+	(void)len;
+	/* Sent again, the files the first one closed stay closed */
+	rpc_close_all();
+	info.version = RPC_VERSION;
+	info.max_data = RPC_MAX_DATA;
+	info.flash_id = sFLASH_ReadID();
+	info.parts = FLASH_PART_COUNT;
+	info.files = RPC_FILES;
+	info.screen_w = LCD_SCREEN_WIDTH;
+	info.screen_h = LCD_SCREEN_HEIGHT;
+	memcpy(out, &info, sizeof(info));
+	for (i = 0; i < FLASH_PART_COUNT; i++) {
+		p = flash_part(i);
+		memset(&rp, 0, sizeof(rp));
+		rp.start = p->start;
+		rp.size = p->size;
+		rp.erase_size = p->erase_size;
+		rp.id = p->id;
+		rp.flags = p->flags;
+		if (RPC_WRITABLE & 1 << i)
+			rp.flags |= RPC_PART_WRITE;
+		memcpy(out + sizeof(info) + i * sizeof(rp), &rp, sizeof(rp));
+	}
+	return sizeof(info) + FLASH_PART_COUNT * sizeof(rp);
+}
+
+static int32_t
+rpc_telemetry(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_telemetry t;
+	struct sflash_cache_stats cst;
+	struct rpc_stats st;
+
+	(void)req;
+	(void)len;
+	memset(&t, 0, sizeof(t));
+	t.uptime_ms = xTaskGetTickCount() * portTICK_PERIOD_MS;
+	t.vol = VOL_Read();
+	t.batt = BATT_Read();
+	t.batt2 = BATT2_Read();
+	t.temp = Temp_Read();
+	t.encoder = Encoder_Read();
+	t.ptt = PTT_Read();
+	t.heap_free = xPortGetFreeHeapSize();
+	sFLASH_CacheStats(&cst);
+	t.cache_hits = cst.hits;
+	t.cache_misses = cst.misses;
+	rpc_stats(&st);
+	t.rx_frames = st.rx_frames;
+	t.rx_bad = st.rx_bad;
+	t.rx_lost = st.rx_lost;
+	t.tx_frames = st.tx_frames;
+	t.tx_short = st.tx_short;
+	memcpy(out, &t, sizeof(t));
+	return sizeof(t);
+}
+
+static int32_t
+rpc_flash_read(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_flash_req fr;
+	const struct flash_part *p = rpc_part(req, len, &fr, false);
+
+	if (p == NULL || fr.len > RPC_MAX_DATA)
+		return RPC_ERR_ARG;
+	if (flash_part_read(p, fr.off, out, fr.len) != 0)
+		return RPC_ERR_FLASH;
+	return fr.len;
+}
+
+static int32_t
+rpc_flash_write(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_flash_req fr;
+	const struct flash_part *p = rpc_part(req, len, &fr, true);
+
+	(void)out;
+	if (p == NULL || fr.len != len - sizeof(fr))
+		return RPC_ERR_ARG;
+	if (flash_part_write(p, fr.off, req + sizeof(fr), fr.len) != 0)
+		return RPC_ERR_FLASH;
+	return 0;
+}
+
+static int32_t
+rpc_flash_erase(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_flash_req fr;
+	const struct flash_part *p = rpc_part(req, len, &fr, true);
+
+	(void)out;
+	if (p == NULL)
+		return RPC_ERR_ARG;
+	if (flash_part_erase(p, fr.off, fr.len) != 0)
+		return RPC_ERR_FLASH;
+	return 0;
+}
+
+static int32_t
+rpc_flash_crc(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_flash_req fr;
+	const struct flash_part *p = rpc_part(req, len, &fr, false);
+	uint32_t crc;
+
+	if (p == NULL)
+		return RPC_ERR_ARG;
+	if (flash_part_crc(p, fr.off, fr.len, &crc) != 0)
+		return RPC_ERR_FLASH;
+	memcpy(out, &crc, sizeof(crc));
+	return sizeof(crc);
+}
+
+static int32_t
+rpc_file_open(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	char name[SPIFFS_OBJ_NAME_LEN];
+	spiffs_flags flags = 0;
+	uint16_t oflags;
+	uint32_t fd;
+	int32_t res;
+
+	if (len < sizeof(oflags))
+		return RPC_ERR_ARG;
+	memcpy(&oflags, req, sizeof(oflags));
+	if ((res = rpc_name(req + sizeof(oflags), len - sizeof(oflags),
+	    name)) < 0)
+		return res;
+	/* Sent again after its response was lost, so the slot it took */
+	for (fd = 0; fd < RPC_FILES; fd++)
+		if (files_open[fd] && files_oflags[fd] == oflags &&
+		    strcmp(files_name[fd], name) == 0)
+			goto out;
+	for (fd = 0; fd < RPC_FILES && files_open[fd]; fd++)
+		;
+	if (fd == RPC_FILES)
+		return RPC_ERR_FILES;
+	if (oflags & RPC_O_READ)
+		flags |= SPIFFS_O_RDONLY;
+	if (oflags & RPC_O_WRITE)
+		flags |= SPIFFS_O_WRONLY;
+	if (oflags & RPC_O_CREAT)
+		flags |= SPIFFS_O_CREAT;
+	if (oflags & RPC_O_TRUNC)
+		flags |= SPIFFS_O_TRUNC;
+	if ((res = SPIFFS_open(&spiffs_fs, name, flags, 0)) < 0)
+		return res;
+	files[fd] = res;
+	files_open[fd] = true;
+	files_oflags[fd] = oflags;
+	strcpy(files_name[fd], name);
+out:
+	memcpy(out, &fd, sizeof(fd));
+	return sizeof(fd);
+}
+
+static int32_t
+rpc_file_read(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_file_req fr;
+	int32_t res;
+
+	if ((res = rpc_file(req, len, &fr)) < 0)
+		return res;
+	if (fr.len > RPC_MAX_DATA)
+		return RPC_ERR_ARG;
+	res = SPIFFS_read(&spiffs_fs, files[fr.fd], out, fr.len);
+	return res == SPIFFS_ERR_END_OF_OBJECT ? 0 : res;
+}
+
+static int32_t
+rpc_file_write(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct rpc_file_req fr;
+	int32_t res;
+
+	(void)out;
+	if ((res = rpc_file(req, len, &fr)) < 0)
+		return res;
+	if (fr.len != len - sizeof(fr))
+		return RPC_ERR_ARG;
+	res = SPIFFS_write(&spiffs_fs, files[fr.fd],
+	    (void *)(req + sizeof(fr)), fr.len);
+	return res < 0 ? res : 0;
+}
+
+static int32_t
+rpc_file_close(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	uint32_t fd;
+
+	(void)out;
+	if (len != sizeof(fd))
+		return RPC_ERR_ARG;
+	memcpy(&fd, req, sizeof(fd));
+	if (fd >= RPC_FILES)
+		return RPC_ERR_ARG;
+	if (!files_open[fd])
+		return 0;	/* Sent again, or closed by RPC_INFO */
+	files_open[fd] = false;
+	return SPIFFS_close(&spiffs_fs, files[fd]);
+}
+
+static int32_t
+rpc_file_stat(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	char name[SPIFFS_OBJ_NAME_LEN];
+	struct rpc_file_stat st;
+	spiffs_stat s;
+	int32_t res;
+
+	if ((res = rpc_name(req, len, name)) < 0 ||
+	    (res = SPIFFS_stat(&spiffs_fs, name, &s)) < 0)
+		return res;
+	rpc_stat_out(&st, s.size, s.type, s.name);
+	memcpy(out, &st, sizeof(st));
+	return sizeof(st);
+}
+
+static int32_t
+rpc_file_remove(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	char name[SPIFFS_OBJ_NAME_LEN];
+	int32_t res;
+
+	(void)out;
+	if ((res = rpc_name(req, len, name)) < 0)
+		return res;
+	return SPIFFS_remove(&spiffs_fs, name);
+}
+
+/* As many entries from "index" on as fit, none past the last */
+static int32_t
+rpc_file_list(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	struct spiffs_dirent e;
+	struct rpc_file_stat st;
+	spiffs_DIR d;
+	uint32_t index, i, n = 0;
+
+	if (len != sizeof(index))
+		return RPC_ERR_ARG;
+	memcpy(&index, req, sizeof(index));
+	if (SPIFFS_opendir(&spiffs_fs, "/", &d) == NULL)
+		return SPIFFS_errno(&spiffs_fs);
+	for (i = 0; (n + 1) * sizeof(st) <= RPC_MAX_DATA &&
+	    SPIFFS_readdir(&d, &e) != NULL; i++) {
+		if (i < index)
+			continue;
+		rpc_stat_out(&st, e.size, e.type, e.name);
+		memcpy(out + n++ * sizeof(st), &st, sizeof(st));
+	}
+	(void)SPIFFS_closedir(&d);
+	return n * sizeof(st);
+}
+
+static int32_t
+rpc_screen_read(const uint8_t *req, uint32_t len, uint8_t *out)
+{
+	if (len != 2 || req[1] == 0 ||
+	    req[0] + req[1] > LCD_SCREEN_HEIGHT ||
+	    req[1] * LCD_SCREEN_WIDTH * 2 > RPC_MAX_DATA)
+		return RPC_ERR_ARG;
+	return LCD_ReadRGB(0, req[0], LCD_SCREEN_WIDTH, req[1], out) * 2;
+}
+
+static const struct rpc_cmd_def rpc_cmds[] = {
+	{ RPC_PING,		rpc_ping },
+	{ RPC_INFO,		rpc_info },
+	{ RPC_TELEMETRY,	rpc_telemetry },
+	{ RPC_FLASH_READ,	rpc_flash_read },
+	{ RPC_FLASH_WRITE,	rpc_flash_write },
+	{ RPC_FLASH_ERASE,	rpc_flash_erase },
+	{ RPC_FLASH_CRC,	rpc_flash_crc },
+	{ RPC_FILE_OPEN,	rpc_file_open },
+	{ RPC_FILE_READ,	rpc_file_read },
+	{ RPC_FILE_WRITE,	rpc_file_write },
+	{ RPC_FILE_CLOSE,	rpc_file_close },
+	{ RPC_FILE_STAT,	rpc_file_stat },
+	{ RPC_FILE_REMOVE,	rpc_file_remove },
+	{ RPC_FILE_LIST,	rpc_file_list },
+	{ RPC_SCREEN_READ,	rpc_screen_read },
+};
+#define RPC_NCMDS	(sizeof(rpc_cmds) / sizeof(rpc_cmds[0]))
+
+static void
+rpc_reply(const struct rpc_hdr *req, int32_t res)
+{
+	struct rpc_hdr h;
+	uint32_t len = res > 0 ? res : 0, crc, n;
+	bool short_write;
+
+	h.seq = tx_seq++;
+	h.cmd = req->cmd | RPC_RESPONSE;
+	h.id = req->id;
+	res = res > 0 ? 0 : res;
+	memcpy(tx_frame, &h, sizeof(h));
+	memcpy(tx_frame + sizeof(h), &res, sizeof(res));
+	len += sizeof(h) + sizeof(res);
+	crc = crc_block(tx_frame, len);
+	memcpy(tx_frame + len, &crc, sizeof(crc));
+	/*
+	 * The leading zero ends whatever text was written since the last
+	 * frame, so the host drops the text and not this frame with it.
+	 * The write goes out whole, text from other tasks waits for it.
+	 */
+	tx_wire[0] = 0;
+	n = 1 + cobs_encode(tx_frame, len + sizeof(crc), tx_wire + 1);
+	tx_wire[n++] = 0;
+
+	short_write = usb_cdc_write_timeout(tx_wire, n, RPC_TX_TIMEOUT) !=
+	    (ssize_t)n;
+	taskENTER_CRITICAL();
+	stats.tx_frames++;
+	if (short_write)
+		stats.tx_short++;
+	taskEXIT_CRITICAL();
+}
+
+static void
+rpc_frame(uint8_t *buf, uint32_t len)
+{
+	struct rpc_hdr h;
+	uint32_t crc, i;
+	int32_t n = cobs_decode(buf, len, buf), res;
+
+	if (n < (int32_t)(sizeof(h) + sizeof(crc)))
+		goto bad;
+	n -= sizeof(crc);
+	memcpy(&crc, buf + n, sizeof(crc));
+	if (crc_block(buf, n) != crc)
+		goto bad;
+	memcpy(&h, buf, sizeof(h));
+	n -= sizeof(h);
+
+	taskENTER_CRITICAL();
+	stats.rx_frames++;
+	/* A new session counts from wherever the host starts */
+	if (rx_seq >= 0 && h.cmd != RPC_INFO)
+		stats.rx_lost += (uint8_t)(h.seq - rx_seq - 1);
+	taskEXIT_CRITICAL();
+	rx_seq = h.seq;
+
+	for (i = 0; i < RPC_NCMDS; i++)
+		if (rpc_cmds[i].cmd == h.cmd)
+			break;
+	if (n > RPC_MAX_PAYLOAD)
+		res = RPC_ERR_ARG;
+	else if (i == RPC_NCMDS)
+		res = RPC_ERR_CMD;
+	else
+		res = rpc_cmds[i].fn(buf + sizeof(h), n,
+		    tx_frame + sizeof(h) + sizeof(res));
+	rpc_reply(&h, res);
+	return;
+bad:
+	taskENTER_CRITICAL();
+	stats.rx_bad++;
+	taskEXIT_CRITICAL();
+}
+
+static void
+rpc_main(void *arg)
+{
+	static uint8_t in[256];
+	uint32_t len = 0;
+	bool over = false;
+	ssize_t i, n;
+
+	(void)arg;
+	for (;;) {
+		n = usb_cdc_read_some(in, sizeof(in), portMAX_DELAY);
+		for (i = 0; i < n; i++) {
+			if (in[i] != 0) {
+				if (len < sizeof(rx_wire))
+					rx_wire[len++] = in[i];
+				else
+					over = true;
+				continue;
+			}
+			if (over) {
+				taskENTER_CRITICAL();
+				stats.rx_bad++;
+				taskEXIT_CRITICAL();
+			} else if (len > 0) {
+				rpc_frame(rx_wire, len);
+			}
+			len = 0;
+			over = false;
+		}
+	}
+}
+
+void
+rpc_start(void)
+{
+	if (rpc_task == NULL)
+		xTaskCreate(rpc_main, "rpc", RPC_STACK, NULL, RPC_PRIORITY,
+		    &rpc_task);
+}
+
+void
+rpc_stats(struct rpc_stats *st)
+{
+	taskENTER_CRITICAL();
+	*st = stats;
+	taskEXIT_CRITICAL();
+}
+
+int
+rpc_report(char *buf, size_t len)
+{
+	struct rpc_stats st;
+
+	rpc_stats(&st);
+	return snprintf(buf, len, "rpc: %lu requests, %lu bad, %lu lost, "
+	    "%lu responses, %lu short\n", (unsigned long)st.rx_frames,
+	    (unsigned long)st.rx_bad, (unsigned long)st.rx_lost,
+	    (unsigned long)st.tx_frames, (unsigned long)st.tx_short);
+}
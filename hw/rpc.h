@@ -0,0 +1,146 @@
+#ifndef _RPC_H_
+#define _RPC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Framed binary requests over the USB serial port.
+ *
+ * Each frame is COBS encoded and ends with a zero byte; responses start
+ * with one as well, and empty frames are ignored.  Decoded, a frame is
+ * a struct rpc_hdr, the payload and a CRC32 (crc.h) of both, all little
+ * endian.  Every request gets one response with the same id and the
+ * command with RPC_RESPONSE set, whose payload starts with an int32_t
+ * status: 0, an RPC_ERR_* or a SPIFFS error.  The host may send requests
+ * without waiting for the responses, which come back in order.
+ *
+ * Each side counts its frames in seq so the other can tell how many it
+ * lost.  A frame that fails its CRC is dropped without a response; the
+ * host sends the request again when the response is late, so requests
+ * are made to be repeated safely: an open of a name the session has open
+ * with the same flags returns that fd, closing a closed fd succeeds and
+ * RPC_INFO only closes files.  Text other tasks write to the port goes
+ * between frames, never into one, and is dropped as a bad frame.
+ *
+ * md380tools/tytrpc.py is the host side.
+ */
+
+#define RPC_VERSION	1
+#define RPC_MAX_DATA	1024		/* Bulk data in one frame */
+#define RPC_MAX_PAYLOAD	(RPC_MAX_DATA + 16)
+#define RPC_NAME_LEN	32		/* Of names in responses, NUL padded */
+#define RPC_RESPONSE	0x80
+
+#define RPC_ERR_CMD	-1		/* Unknown command */
+#define RPC_ERR_ARG	-2		/* Malformed or out of range */
+#define RPC_ERR_FLASH	-3		/* Refused by flash_part */
+#define RPC_ERR_FILES	-4		/* Too many files open */
+
+struct rpc_hdr {
+	uint8_t		seq;
+	uint8_t		cmd;
+	uint16_t	id;		/* Chosen by the host */
+} __attribute__((packed));
+
+/* Request payload, then response data after the status */
+enum rpc_cmd {
+	RPC_PING = 0x01,	/* Any data, echoed */
+	RPC_INFO,		/* -, struct rpc_info and the partitions */
+	RPC_TELEMETRY,		/* -, struct rpc_telemetry */
+	RPC_FLASH_READ = 0x10,	/* struct rpc_flash_req, the data */
+	RPC_FLASH_WRITE,	/* struct rpc_flash_req and the data, - */
+	RPC_FLASH_ERASE,	/* struct rpc_flash_req, - */
+	RPC_FLASH_CRC,		/* struct rpc_flash_req, uint32_t */
+	RPC_FILE_OPEN = 0x20,	/* uint16_t RPC_O_* and the name, uint32_t fd */
+	RPC_FILE_READ,		/* struct rpc_file_req, the data */
+	RPC_FILE_WRITE,		/* struct rpc_file_req and the data, - */
+	RPC_FILE_CLOSE,		/* uint32_t fd, - */
+	RPC_FILE_STAT,		/* The name, struct rpc_file_stat */
+	RPC_FILE_REMOVE,	/* The name, - */
+	RPC_FILE_LIST,		/* uint32_t index, struct rpc_file_stat each */
+	RPC_SCREEN_READ = 0x30,	/* uint8_t row, rows; RGB565 high byte first */
+};
+
+#define RPC_O_READ	0x01
+#define RPC_O_WRITE	0x02
+#define RPC_O_CREAT	0x04
+#define RPC_O_TRUNC	0x08
+
+struct rpc_info {
+	uint16_t	version;
+	uint16_t	max_data;
+	uint32_t	flash_id;
+	uint8_t		parts;		/* struct rpc_part that follow */
+	uint8_t		files;		/* Files that can be open at once */
+	uint8_t		screen_w;
+	uint8_t		screen_h;
+} __attribute__((packed));
+
+struct rpc_part {
+	uint32_t	start;
+	uint32_t	size;
+	uint32_t	erase_size;
+	uint8_t		id;		/* enum flash_part_id */
+	uint8_t		flags;		/* FLASH_PART_*, RPC_PART_WRITE */
+	uint16_t	reserved;
+} __attribute__((packed));
+
+#define RPC_PART_WRITE	0x80		/* The host may write and erase it */
+
+struct rpc_flash_req {
+	uint8_t		part;
+	uint8_t		reserved[3];
+	uint32_t	off;		/* In the partition */
+	uint32_t	len;
+} __attribute__((packed));
+
+struct rpc_file_req {
+	uint32_t	fd;
+	uint32_t	off;
+	uint32_t	len;
+} __attribute__((packed));
+
+struct rpc_file_stat {
+	uint32_t	size;
+	uint8_t		type;		/* SPIFFS_TYPE_* */
+	uint8_t		reserved[3];
+	char		name[RPC_NAME_LEN];
+} __attribute__((packed));
+
+struct rpc_telemetry {
+	uint32_t	uptime_ms;
+	uint16_t	vol;		/* Raw ADC readings */
+	uint16_t	batt;
+	uint16_t	batt2;
+	uint16_t	temp;
+	uint8_t		encoder;
+	uint8_t		ptt;
+	uint16_t	reserved;
+	uint32_t	heap_free;
+	uint32_t	cache_hits;
+	uint32_t	cache_misses;
+	uint32_t	rx_frames;	/* struct rpc_stats */
+	uint32_t	rx_bad;
+	uint32_t	rx_lost;
+	uint32_t	tx_frames;
+	uint32_t	tx_short;
+} __attribute__((packed));
+
+struct rpc_stats {
+	uint32_t	rx_frames;	/* Requests served */
+	uint32_t	rx_bad;		/* Frames dropped, bad CRC or too long */
+	uint32_t	rx_lost;	/* Gaps in the host's seq */
+	uint32_t	tx_frames;
+	uint32_t	tx_short;	/* Responses the port did not take whole */
+};
+
+/* Starts the task that serves requests, after usb_cdc_init() */
+void rpc_start(void);
+
+void rpc_stats(struct rpc_stats *);
+
+/* Formats the statistics as one line of text */
+int rpc_report(char *buf, size_t len);
+
+#endif
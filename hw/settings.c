@@ -0,0 +1,425 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "crc.h"
+#include "flash_part.h"
+#include "settings.h"
+
+#ifdef SFLASH_EMU
+/* Host builds are single threaded */
+#define SETTINGS_LOCK()
+#define SETTINGS_UNLOCK()
+#define SETTINGS_LOCK_INIT()
+#else
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+static SemaphoreHandle_t settings_mutex;
+#define SETTINGS_LOCK()		xSemaphoreTake(settings_mutex, portMAX_DELAY)
+#define SETTINGS_UNLOCK()	xSemaphoreGive(settings_mutex)
+#define SETTINGS_LOCK_INIT()	do {				\
+	if (settings_mutex == NULL)				\
+		settings_mutex = xSemaphoreCreateMutex();	\
+} while (0)
+#endif
+
+#define HDR		sizeof(struct settings_hdr)
+#define REC		sizeof(struct settings_rec)
+#define PAD(n)		(((n) + 3) & ~3)
+#define PAGE		0x100
+#define NO_KEY		0xffff		/* Erased, and free slots */
+#define SLOT(i)		((i) & (SETTINGS_SLOTS - 1))
+
+struct entry {
+	uint16_t	key;
+	uint8_t		type;
+	uint8_t		len;
+	uint8_t		val[SETTINGS_VALUE_MAX];
+};
+
+/* Linear probing; a deleted key gives its slot back at once */
+static struct entry slots[SETTINGS_SLOTS];
+static uint32_t nkeys;
+
+static const struct flash_part *part;
+static uint32_t active;		/* Sector 0 or 1 */
+static uint32_t gen;
+static uint32_t woff;		/* Where the next record goes */
+static bool ready;
+static struct settings_stats stats;
+
+static struct entry *
+lookup(uint16_t key, bool add)
+{
+	struct entry *e;
+	uint32_t i;
+
+	for (i = 0; i < SETTINGS_SLOTS; i++) {
+		e = &slots[SLOT(key + i)];
+		if (e->key == key)
+			return e;
+		if (e->key == NO_KEY) {
+			if (!add || nkeys == SETTINGS_KEYS)
+				return NULL;
+			nkeys++;
+			e->key = key;
+			e->type = SETTINGS_DELETED;
+			e->len = 0;
+			return e;
+		}
+	}
+	return NULL;
+}
+
+/*
+ * Frees the slot of "e", moving back the keys after it whose probe went
+ * past it, so that no lookup stops short at the hole.
+ */
+static void
+unslot(struct entry *e)
+{
+	uint32_t hole = e - slots, i;
+
+	for (i = SLOT(hole + 1); slots[i].key != NO_KEY; i = SLOT(i + 1)) {
+		if (SLOT(i - slots[i].key) >= SLOT(i - hole)) {
+			slots[hole] = slots[i];
+			hole = i;
+		}
+	}
+	slots[hole].key = NO_KEY;
+	nkeys--;
+}
+
+/* Takes a record that is on the flash into RAM */
+static void
+apply(const struct entry *n)
+{
+	struct entry *e;
+
+	if ((e = lookup(n->key, n->type != SETTINGS_DELETED)) == NULL)
+		return;
+	if (n->type == SETTINGS_DELETED)
+		unslot(e);
+	else
+		*e = *n;
+}
+
+static uint32_t
+hdr_crc(const struct settings_hdr *h)
+{
+	return crc_block(h, offsetof(struct settings_hdr, crc));
+}
+
+static uint32_t
+rec_crc(const struct settings_rec *r, const void *val)
+{
+	struct crc_ctx c;
+
+	crc_start(&c);
+	crc_update(&c, r, offsetof(struct settings_rec, crc));
+	crc_update(&c, val, r->len);
+	return crc_final(&c);
+}
+
+/* Moves "off" to the next page if a record of "size" would cross one */
+static uint32_t
+place(uint32_t off, uint32_t size)
+{
+	if (off % PAGE + size > PAGE)
+		off = (off | (PAGE - 1)) + 1;
+	return off;
+}
+
+static int
+write_rec(uint32_t sector, uint32_t off, const struct entry *e)
+{
+	uint8_t buf[REC + SETTINGS_VALUE_MAX];
+	struct settings_rec *r = (struct settings_rec *)buf;
+
+	r->key = e->key;
+	r->type = e->type;
+	r->len = e->len;
+	r->crc = rec_crc(r, e->val);
+	memcpy(buf + REC, e->val, e->len);
+	return flash_part_write(part, sector * SETTINGS_SECTOR + off, buf,
+	    REC + e->len);
+}
+
+/*
+ * Copies every key into the other sector, with "n" in place of the key's
+ * value in RAM if it is given, and makes it the active one by writing its
+ * header last.  Deletes are not copied.
+ */
+static int
+compact(const struct entry *n)
+{
+	struct settings_hdr h;
+	const struct entry *e;
+	uint32_t target = active ^ 1, off = HDR, size;
+	int i;
+
+	if (flash_part_erase(part, target * SETTINGS_SECTOR,
+	    SETTINGS_SECTOR) < 0)
+		return -1;
+	for (i = 0; i <= SETTINGS_SLOTS; i++) {
+		if (i == SETTINGS_SLOTS)
+			e = n;
+		else if (n != NULL && slots[i].key == n->key)
+			continue;
+		else
+			e = &slots[i];
+		if (e == NULL || e->key == NO_KEY ||
+		    e->type == SETTINGS_DELETED)
+			continue;
+		size = PAD(REC + e->len);
+		off = place(off, size);
+		if (write_rec(target, off, e) < 0)
+			return -1;
+		off += size;
+	}
+	h.magic = SETTINGS_MAGIC;
+	h.gen = gen + 1;
+	h.crc = hdr_crc(&h);
+	h.reserved = 0xffffffff;
+	if (flash_part_write(part, target * SETTINGS_SECTOR, &h, HDR) < 0)
+		return -1;
+	active = target;
+	gen = h.gen;
+	woff = off;
+	stats.compactions++;
+	return 0;
+}
+
+/* Loads the records of the active sector, finding where the next goes */
+static void
+load(void)
+{
+	struct settings_rec r;
+	struct entry n;
+	uint32_t base = active * SETTINGS_SECTOR, off = HDR, next;
+
+	while (off + REC <= SETTINGS_SECTOR) {
+		flash_part_read(part, base + off, &r, REC);
+		if (r.key == NO_KEY) {
+			/* A record that did not fit may start the next page */
+			next = (off | (PAGE - 1)) + 1;
+			if (off % PAGE == 0 || next + REC > SETTINGS_SECTOR)
+				break;
+			flash_part_read(part, base + next, &r, REC);
+			if (r.key == NO_KEY)
+				break;
+			off = next;
+			continue;
+		}
+		if (r.len > SETTINGS_VALUE_MAX ||
+		    off % PAGE + PAD(REC + r.len) > PAGE ||
+		    flash_part_read(part, base + off + REC, n.val, r.len) < 0 ||
+		    rec_crc(&r, n.val) != r.crc) {
+			/* Cut short by power loss, write afresh elsewhere */
+			stats.bad++;
+			off = SETTINGS_SECTOR;
+			break;
+		}
+		n.key = r.key;
+		n.type = r.type;
+		n.len = r.len;
+		apply(&n);
+		off += PAD(REC + r.len);
+	}
+	woff = off;
+}
+
+int
+settings_init(void)
+{
+	struct settings_hdr h[2];
+	bool valid[2];
+	int i, res = 0;
+
+	SETTINGS_LOCK_INIT();
+	SETTINGS_LOCK();
+	part = flash_part(FLASH_PART_SETTINGS);
+	if (part->size < 2 * SETTINGS_SECTOR ||
+	    part->erase_size > SETTINGS_SECTOR) {
+		res = -1;
+		goto out;
+	}
+	for (i = 0; i < SETTINGS_SLOTS; i++)
+		slots[i].key = NO_KEY;
+	nkeys = 0;
+	for (i = 0; i < 2; i++) {
+		flash_part_read(part, i * SETTINGS_SECTOR, &h[i], HDR);
+		valid[i] = h[i].magic == SETTINGS_MAGIC &&
+		    h[i].crc == hdr_crc(&h[i]);
+	}
+	if (!valid[0] && !valid[1]) {
+		/* Nothing yet, start with an empty sector 0 */
+		active = 1;
+		gen = 0;
+		res = compact(NULL);
+	} else {
+		active = valid[0] && valid[1] ?
+		    (int32_t)(h[1].gen - h[0].gen) > 0 : valid[1];
+		gen = h[active].gen;
+		load();
+	}
+	ready = res == 0;
+out:
+	SETTINGS_UNLOCK();
+	return res;
+}
+
+int
+settings_get(uint16_t key, uint8_t type, void *buf, size_t len)
+{
+	struct entry *e;
+	int res = -1;
+
+	if (!ready)
+		return -1;
+	SETTINGS_LOCK();
+	e = lookup(key, false);
+	if (e != NULL && e->type == type && e->type != SETTINGS_DELETED &&
+	    e->len <= len) {
+		memcpy(buf, e->val, e->len);
+		res = e->len;
+	}
+	SETTINGS_UNLOCK();
+	return res;
+}
+
+int
+settings_set(uint16_t key, uint8_t type, const void *buf, size_t len)
+{
+	struct entry *e, n;
+	uint32_t off, size;
+	int res = -1;
+
+	if (!ready || key == 0 || key == NO_KEY || len > SETTINGS_VALUE_MAX)
+		return -1;
+	SETTINGS_LOCK();
+	if ((e = lookup(key, false)) == NULL) {
+		/* Deleting a key never set is fine */
+		if (type == SETTINGS_DELETED)
+			res = 0;
+		if (type == SETTINGS_DELETED || nkeys == SETTINGS_KEYS)
+			goto out;
+	} else if (e->type == type && e->len == len &&
+	    (len == 0 || memcmp(e->val, buf, len) == 0)) {
+		stats.unchanged++;
+		res = 0;
+		goto out;
+	}
+	n.key = key;
+	n.type = type;
+	n.len = len;
+	if (len > 0)
+		memcpy(n.val, buf, len);
+	/* RAM only takes what the flash holds, so a failed write loses it */
+	size = PAD(REC + len);
+	off = place(woff, size);
+	if (off + size > SETTINGS_SECTOR) {
+		res = compact(&n);
+	} else if ((res = write_rec(active, off, &n)) == 0) {
+		woff = off + size;
+		stats.writes++;
+	}
+	if (res == 0)
+		apply(&n);
+out:
+	SETTINGS_UNLOCK();
+	return res;
+}
+
+int
+settings_delete(uint16_t key)
+{
+	return settings_set(key, SETTINGS_DELETED, NULL, 0);
+}
+
+uint8_t
+settings_get_u8(uint16_t key, uint8_t def)
+{
+	uint8_t v;
+
+	return settings_get(key, SETTINGS_U8, &v, sizeof(v)) == sizeof(v) ?
+	    v : def;
+}
+
+uint32_t
+settings_get_u32(uint16_t key, uint32_t def)
+{
+	uint32_t v;
+
+	return settings_get(key, SETTINGS_U32, &v, sizeof(v)) == sizeof(v) ?
+	    v : def;
+}
+
+int32_t
+settings_get_i32(uint16_t key, int32_t def)
+{
+	int32_t v;
+
+	return settings_get(key, SETTINGS_I32, &v, sizeof(v)) == sizeof(v) ?
+	    v : def;
+}
+
+bool
+settings_get_bool(uint16_t key, bool def)
+{
+	return settings_get_u8(key, def) != 0;
+}
+
+int
+settings_set_u8(uint16_t key, uint8_t val)
+{
+	return settings_set(key, SETTINGS_U8, &val, sizeof(val));
+}
+
+int
+settings_set_u32(uint16_t key, uint32_t val)
+{
+	return settings_set(key, SETTINGS_U32, &val, sizeof(val));
+}
+
+int
+settings_set_i32(uint16_t key, int32_t val)
+{
+	return settings_set(key, SETTINGS_I32, &val, sizeof(val));
+}
+
+int
+settings_set_bool(uint16_t key, bool val)
+{
+	return settings_set_u8(key, val);
+}
+
+const char *
+settings_get_str(uint16_t key, char *buf, size_t len, const char *def)
+{
+	char tmp[SETTINGS_VALUE_MAX];
+	int n;
+
+	if (len == 0 || (n = settings_get(key, SETTINGS_STR, tmp,
+	    sizeof(tmp))) < 0)
+		return def;
+	if ((size_t)n >= len)
+		n = len - 1;
+	memcpy(buf, tmp, n);
+	buf[n] = '\0';
+	return buf;
+}
+
+int
+settings_set_str(uint16_t key, const char *s)
+{
+	return settings_set(key, SETTINGS_STR, s, strlen(s));
+}
+
+void
+settings_stats(struct settings_stats *st)
+{
+	SETTINGS_LOCK();
+	*st = stats;
+	SETTINGS_UNLOCK();
+}
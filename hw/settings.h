@@ -0,0 +1,98 @@
+#ifndef _SETTINGS_H_
+#define _SETTINGS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Key/value settings in the two sectors of FLASH_PART_SETTINGS.
+ *
+ * Each change appends a record with a CRC to the active sector.  A record
+ * never crosses a flash page, so a change costs one page program.  When
+ * the sector is full the latest value of every key is copied into the
+ * other sector, whose header goes last; until it does, the old sector
+ * stays the valid one.  settings_init() reads everything into RAM once,
+ * and reads never go to the flash after that.
+ */
+
+#define SETTINGS_SECTOR		0x1000
+#define SETTINGS_MAGIC		0x53544654	/* "TFTS" */
+#define SETTINGS_KEYS		48		/* Distinct keys */
+#define SETTINGS_SLOTS		64		/* Hash slots, a power of 2 */
+#define SETTINGS_VALUE_MAX	32
+
+/* Keys, never reused for something else */
+enum settings_key {
+	SETTING_SECREG = 1,		/* Security register byte on show */
+	SETTING_CACHE_PAGES,		/* SPIFFS cache size */
+	SETTING_CHECK_CURSOR,		/* Where spiffs_checkd is */
+};
+
+enum settings_type {
+	SETTINGS_DELETED,
+	SETTINGS_U8,
+	SETTINGS_U32,
+	SETTINGS_I32,
+	SETTINGS_STR,			/* Stored without the NUL */
+	SETTINGS_BLOB
+};
+
+/* On flash, little endian.  The header starts each sector in use. */
+struct settings_hdr {
+	uint32_t	magic;
+	uint32_t	gen;		/* The higher of the two is active */
+	uint32_t	crc;		/* Of the above */
+	uint32_t	reserved;
+} __attribute__((packed));
+
+/* Each record is this, then the value, padded to 4 bytes */
+struct settings_rec {
+	uint16_t	key;		/* 0xffff if erased */
+	uint8_t		type;
+	uint8_t		len;
+	uint32_t	crc;		/* Of key, type, len and the value */
+} __attribute__((packed));
+
+struct settings_stats {
+	uint32_t	writes;		/* Records appended */
+	uint32_t	unchanged;	/* Sets that wrote nothing */
+	uint32_t	compactions;
+	uint32_t	bad;		/* Torn records found at init */
+};
+
+/* Reads the settings, formatting the partition if it holds none */
+int settings_init(void);
+
+/*
+ * Copies the value of "key" to "buf" if it has type "type".  Returns its
+ * length, or -1 if it is unset, of another type or longer than "len".
+ */
+int settings_get(uint16_t key, uint8_t type, void *buf, size_t len);
+
+/*
+ * Stores a value, or deletes the key.  Returns 0, or -1 if there are
+ * already SETTINGS_KEYS keys or the flash write failed, in which case
+ * the old value stays.
+ */
+int settings_set(uint16_t key, uint8_t type, const void *buf, size_t len);
+int settings_delete(uint16_t key);
+
+/* Typed accessors, the getters return "def" if the key is unset */
+uint8_t settings_get_u8(uint16_t key, uint8_t def);
+uint32_t settings_get_u32(uint16_t key, uint32_t def);
+int32_t settings_get_i32(uint16_t key, int32_t def);
+bool settings_get_bool(uint16_t key, bool def);
+int settings_set_u8(uint16_t key, uint8_t val);
+int settings_set_u32(uint16_t key, uint32_t val);
+int settings_set_i32(uint16_t key, int32_t val);
+int settings_set_bool(uint16_t key, bool val);
+
+/* NUL terminated, truncated to fit; "def" if unset */
+const char *settings_get_str(uint16_t key, char *buf, size_t len,
+    const char *def);
+int settings_set_str(uint16_t key, const char *s);
+
+void settings_stats(struct settings_stats *);
+
+#endif
@@ -60,6 +60,13 @@ extern "C" {
 #define SPIFFS_ERR_IX_MAP_MAPPED        -10038
 #define SPIFFS_ERR_IX_MAP_BAD_RANGE     -10039
 
+#define SPIFFS_ERR_SNAP_INVALID         -10040
+#define SPIFFS_ERR_CACHE_TOO_SMALL      -10041
+#define SPIFFS_ERR_NOT_A_FOLDER         -10042
+#define SPIFFS_ERR_LZ_CORRUPT           -10043
+#define SPIFFS_ERR_PINNED               -10044
+#define SPIFFS_ERR_NO_WEAR_COUNTS       -10045
+
 #define SPIFFS_ERR_INTERNAL             -10050
 
 #define SPIFFS_ERR_TEST                 -10100
@@ -201,6 +208,11 @@ typedef struct {
   spiffs_write hal_write_f;
   // physical erase function
   spiffs_erase hal_erase_f;
+#if SPIFFS_READ_EXTENTS
+  // physical read function for SPIFFS_read_stream, reading file data
+  // once; hal_read_f is used if 0
+  spiffs_read hal_stream_read_f;
+#endif
 #if SPIFFS_SINGLETON == 0
   // physical size of the spi flash
   u32_t phys_size;
@@ -260,11 +272,15 @@ typedef struct spiffs_t {
   u32_t stats_p_deleted;
   // flag indicating that garbage collector is cleaning
   u8_t cleaning;
+  // block SPIFFS_gc_step is emptying, -1 if none
+  spiffs_block_ix gc_step_bix;
   // max erase count amongst all blocks
   spiffs_obj_id max_erase_count;
 
 #if SPIFFS_GC_STATS
   u32_t stats_gc_runs;
+  // collections forced inside a write because space ran low
+  u32_t stats_gc_sync;
 #endif
 
 #if SPIFFS_CACHE
@@ -275,7 +291,23 @@ typedef struct spiffs_t {
 #if SPIFFS_CACHE_STATS
   u32_t cache_hits;
   u32_t cache_misses;
+  u32_t cache_evictions;
+  u32_t cache_write_backs;
+  u32_t cache_promotions;
+#endif
+#endif
+
+#if SPIFFS_INCREMENTAL_CHECK
+  // fixes made by the consistency checks
+  u32_t stats_check_fixes;
+#endif
+#if SPIFFS_READ_EXTENTS
+  // extents handed out and not released, no block is erased meanwhile
+  volatile u32_t pinned;
 #endif
+#if SPIFFS_WEAR_LEVEL
+  // blocks of static data moved onto worn blocks
+  u32_t stats_wear_moves;
 #endif
 
   // check callback function
@@ -290,6 +322,62 @@ typedef struct spiffs_t {
   u32_t config_magic;
 } spiffs;
 
+#if SPIFFS_READ_EXTENTS
+/* where some file data is in flash, see SPIFFS_read_extents */
+typedef struct {
+  // physical address, as given to hal_read_f
+  u32_t addr;
+  u32_t len;
+  // data span index, as in the page header before addr
+  spiffs_span_ix span_ix;
+} spiffs_extent;
+
+/* consumer of SPIFFS_read_stream, returns < 0 to stop */
+typedef s32_t (*spiffs_sink)(void *arg, const u8_t *buf, u32_t len);
+#endif
+
+#if SPIFFS_WEAR_LEVEL
+/* erase counts over all blocks, see SPIFFS_wear_stats */
+typedef struct {
+  u32_t blocks;
+  // erases of the least and most erased blocks
+  u32_t min;
+  u32_t max;
+  // erases of all blocks together
+  u32_t total;
+  // blocks of static data moved since mount
+  u32_t moves;
+} spiffs_wear_stats;
+#endif
+
+#if SPIFFS_INCREMENTAL_CHECK
+/* position of an incremental consistency check, see SPIFFS_check_step */
+typedef struct {
+  // the pass being run, a spiffs_check_type
+  u8_t pass;
+  // set when the work memory must be filled afresh
+  u8_t restart;
+  // next block to check
+  spiffs_block_ix block;
+  // first page of the range the page pass is checking
+  spiffs_page_ix pix_offset;
+  // next free slot of the object id table of the index pass
+  u32_t log_ix;
+  // file system counters after the last step, to notice other writers
+  u32_t stamp[3];
+  // a logical page of work memory, 4-byte aligned, kept between steps
+  u8_t *work;
+  // whole checks completed
+  u32_t cycles;
+  // steps run
+  u32_t steps;
+  // steps that fixed something
+  u32_t fixes;
+  // page ranges started over because files changed halfway
+  u32_t rescans;
+} spiffs_check_cursor;
+#endif
+
 /* spiffs file status struct */
 typedef struct {
   spiffs_obj_id obj_id;
@@ -302,6 +390,25 @@ typedef struct {
 #endif
 } spiffs_stat;
 
+#if SPIFFS_CACHE && SPIFFS_CACHE_STATS
+typedef struct {
+  // reads served from the cache
+  u32_t hits;
+  // reads that had to go to the flash
+  u32_t misses;
+  // pages dropped to make room
+  u32_t evictions;
+  // cached data written out to the flash
+  u32_t write_backs;
+  // pages moved to the protected segment
+  u32_t promotions;
+  // pages in the cache, in use and protected
+  u8_t pages;
+  u8_t pages_used;
+  u8_t pages_protected;
+} spiffs_cache_stats;
+#endif
+
 struct spiffs_dirent {
   spiffs_obj_id obj_id;
   u8_t name[SPIFFS_OBJ_NAME_LEN];
@@ -397,6 +504,16 @@ s32_t SPIFFS_mount(spiffs *fs, spiffs_config *config, u8_t *work,
  */
 void SPIFFS_unmount(spiffs *fs);
 
+#if SPIFFS_MOUNT_SNAPSHOT
+/**
+ * Flushes all cached writes and saves a mount snapshot, so that a mount
+ * after an unclean shutdown can still skip the lookup scan as long as
+ * nothing was written since. Meant to be called when the system is idle.
+ * @param fs            the file system struct
+ */
+s32_t SPIFFS_checkpoint(spiffs *fs);
+#endif
+
 /**
  * Creates a new file.
  * @param fs            the file system struct
@@ -457,6 +574,52 @@ spiffs_file SPIFFS_open_by_page(spiffs *fs, spiffs_page_ix page_ix, spiffs_flags
  */
 s32_t SPIFFS_read(spiffs *fs, spiffs_file fh, void *buf, s32_t len);
 
+#if SPIFFS_READ_EXTENTS
+/**
+ * Like SPIFFS_read, but instead of copying the data, tells where it is in
+ * flash so it can be read straight into its consumer. Fills at most n
+ * extents, one per data page, and moves the file offset past them.
+ * If any are filled the file system is pinned: until SPIFFS_release_extents
+ * no block is erased, so the extents stay readable even if the file is
+ * changed or removed meanwhile. A write that needs a garbage collection
+ * waits for the release up to SPIFFS_PINNED_WAIT_MS, holding the file
+ * system lock, and then fails with SPIFFS_ERR_PINNED. So release promptly,
+ * and make no other SPIFFS calls before releasing.
+ * @param fs            the file system struct
+ * @param fh            the filehandle
+ * @param len           how much to read
+ * @param ext           the extents
+ * @param n             room in ext
+ * @returns number of extents filled, 0 at end of file, or error
+ */
+s32_t SPIFFS_read_extents(spiffs *fs, spiffs_file fh, s32_t len, spiffs_extent *ext, u32_t n);
+
+/**
+ * Unpins after a SPIFFS_read_extents that filled any extents.
+ * @param fs            the file system struct
+ */
+void SPIFFS_release_extents(spiffs *fs);
+
+/**
+ * Reads len bytes from the file and hands them to sink, page by page, with
+ * SPIFFS_read_extents. Extents of pages next to each other in flash are
+ * read in one go, headers and all, into buf with hal_stream_read_f, and
+ * the headers are checked there. Neither the cache nor the work buffers
+ * are used, and the lock is not held while sink runs.
+ * @param fs            the file system struct
+ * @param fh            the filehandle
+ * @param len           how much to read
+ * @param buf           buffer for the flash reads, at least a logical page
+ * @param buf_size      its size
+ * @param sink          consumer of the data
+ * @param arg           passed to sink
+ * @returns number of bytes handed to sink, or error; after an error the
+ *          file offset is just past the data sink accepted
+ */
+s32_t SPIFFS_read_stream(spiffs *fs, spiffs_file fh, s32_t len, u8_t *buf, u32_t buf_size,
+    spiffs_sink sink, void *arg);
+#endif
+
 /**
  * Writes to given filehandle.
  * @param fs            the file system struct
@@ -586,12 +749,69 @@ s32_t SPIFFS_closedir(spiffs_DIR *d);
  */
 struct spiffs_dirent *SPIFFS_readdir(spiffs_DIR *d, struct spiffs_dirent *e);
 
+#if SPIFFS_DIR_INDEX
+/**
+ * Lists a folder: the objects whose MTP_MetaData.parent is the folder's
+ * object id. A folder is an object of MTP format association.
+ * @param fs            the file system struct
+ * @param parent        object id of the folder, 0 for the root
+ * @param ids           filled with the object ids of up to max objects
+ * @param max           number of entries in ids
+ * @returns the number of objects in the folder, which may be more than
+ *          max, or error
+ */
+s32_t SPIFFS_dir_list(spiffs *fs, spiffs_obj_id parent, spiffs_obj_id *ids, u32_t max);
+
+/**
+ * Finds an object by its path, the names of the folders it is in from
+ * the root down and its own name, separated by '/'.
+ * @param fs            the file system struct
+ * @param path          the path, "/" for the root
+ * @param obj_id        the object id, 0 for the root
+ */
+s32_t SPIFFS_dir_lookup(spiffs *fs, const char *path, spiffs_obj_id *obj_id);
+#endif
+
 /**
  * Runs a consistency check on given filesystem.
  * @param fs            the file system struct
  */
 s32_t SPIFFS_check(spiffs *fs);
 
+#if SPIFFS_INCREMENTAL_CHECK
+/**
+ * Starts an incremental consistency check from the first block. A
+ * check saved halfway resumes by setting pass, block and pix_offset of
+ * the cursor afterwards.
+ * @param fs            the file system struct
+ * @param c             the cursor
+ * @param work          a logical page of memory, 4-byte aligned, kept
+ *                      for as long as the check runs
+ */
+void SPIFFS_check_begin(spiffs *fs, spiffs_check_cursor *c, void *work);
+
+/**
+ * Runs the checks of SPIFFS_check over the next block only, mending
+ * what it finds there. The page pass checks a range of pages at a time,
+ * which takes a step per block; if files change between the steps the
+ * range is started over. When the last pass is done the check starts
+ * again from the first block.
+ *
+ * Returns 1 when this step completed the check, 0 if it did not, or an
+ * error. The cursor moves on after errors too.
+ * @param fs            the file system struct
+ * @param c             the cursor
+ */
+s32_t SPIFFS_check_step(spiffs *fs, spiffs_check_cursor *c);
+
+/**
+ * Returns how far the check of a cursor is, in thousandths.
+ * @param fs            the file system struct
+ * @param c             the cursor
+ */
+u32_t SPIFFS_check_progress(spiffs *fs, const spiffs_check_cursor *c);
+#endif
+
 /**
  * Returns number of total bytes available and number of used bytes.
  * This is an estimation, and depends on if there a many files with little
@@ -671,6 +891,57 @@ s32_t SPIFFS_gc_quick(spiffs *fs, u16_t max_free_pages);
  */
 s32_t SPIFFS_gc(spiffs *fs, u32_t size);
 
+/**
+ * Does one bounded step of garbage collection: either one block erase, or
+ * moving at most SPIFFS_GC_STEP_MOVES live pages out of the block being
+ * emptied. A block holding only deleted pages is erased if there is one,
+ * otherwise the best candidate block with at least min_deleted deleted
+ * pages is emptied over as many calls as it takes and then erased.
+ * Meant for a background task, so that SPIFFS_gc rarely has to run
+ * inside a write.
+ *
+ * Returns 1 if a block was erased, 2 if pages were moved towards an erase,
+ * 0 if there was nothing worth doing, or an error.
+ *
+ * @param fs            the file system struct
+ * @param min_deleted   fewest deleted pages that make a block worth cleaning
+ */
+s32_t SPIFFS_gc_step(spiffs *fs, u32_t min_deleted);
+
+#if SPIFFS_WEAR_LEVEL
+/**
+ * Copies how often each block has been erased, since the counts were
+ * started, into counts.
+ * @param fs            the file system struct
+ * @param counts        the counts, indexed by block
+ * @param n             room in counts
+ * @returns number of blocks copied, or error
+ */
+s32_t SPIFFS_wear_counts(spiffs *fs, u32_t *counts, u32_t n);
+
+/**
+ * Summarizes the erase counts.
+ * @param fs            the file system struct
+ * @param st            the summary
+ */
+s32_t SPIFFS_wear_stats(spiffs *fs, spiffs_wear_stats *st);
+
+/**
+ * Does one step of static wear levelling. Blocks whose data never changes
+ * are never collected, so the others take all the erases. When the most
+ * erased free block has been erased more than spread times more often
+ * than the least erased block holding data, the data is moved onto the
+ * worn block and the little worn block is erased for the writes to use.
+ *
+ * Returns 1 if a block was moved, 0 if the spread is within bounds, or an
+ * error.
+ *
+ * @param fs            the file system struct
+ * @param spread        difference of erase counts to allow
+ */
+s32_t SPIFFS_wear_level_step(spiffs *fs, u32_t spread);
+#endif
+
 /**
  * Check if EOF reached.
  * @param fs            the file system struct
@@ -805,6 +1076,24 @@ u32_t SPIFFS_buffer_bytes_for_cache(spiffs *fs, u32_t num_pages);
 #endif
 
 #if SPIFFS_CACHE
+/**
+ * Moves the cache to another memory area, or resizes it in place. Cached
+ * writes are flushed first. The old area is no longer used on return.
+ * @param fs            the file system struct
+ * @param cache         memory for the cache, as for SPIFFS_mount
+ * @param cache_size    size of the memory, at most 32 pages are used
+ */
+s32_t SPIFFS_set_cache(spiffs *fs, void *cache, u32_t cache_size);
+
+#if SPIFFS_CACHE_STATS
+/**
+ * Returns the cache statistics.
+ * @param fs            the file system struct
+ * @param stats         filled in with the counters
+ * @param clear         if non-zero, the counters restart from zero
+ */
+s32_t SPIFFS_cache_stats(spiffs *fs, spiffs_cache_stats *stats, u8_t clear);
+#endif
 #endif
 #if defined(__cplusplus)
 }
@@ -29,6 +29,45 @@ static spiffs_cache_page *spiffs_cache_page_get(spiffs *fs, spiffs_page_ix pix)
   return 0;
 }
 
+#if SPIFFS_CACHE_SLRU
+// moves a probationary page to the protected segment when it is hit again
+// after some other page was loaded, pushing the least recently used
+// protected page back when that segment is full. Hits before any other
+// load are the same operation reading a page piecewise and do not count.
+static void spiffs_cache_page_promote(spiffs *fs, spiffs_cache_page *cp) {
+  spiffs_cache *cache = spiffs_get_cache(fs);
+  if (cp->flags & (SPIFFS_CACHE_FLAG_PROT | SPIFFS_CACHE_FLAG_TYPE_WR)) return;
+  if (cp->loaded == cache->loads) return;
+  cp->flags |= SPIFFS_CACHE_FLAG_PROT;
+  cache->cpage_prot++;
+#if SPIFFS_CACHE_STATS
+  fs->cache_promotions++;
+#endif
+  if (cache->cpage_prot <= cache->cpage_count - SPIFFS_CACHE_PROBATION(cache->cpage_count)) {
+    return;
+  }
+  int i;
+  int cand_ix = -1;
+  u32_t oldest_val = 0;
+  for (i = 0; i < cache->cpage_count; i++) {
+    spiffs_cache_page *cand = spiffs_get_cache_page_hdr(fs, cache, i);
+    if ((cache->cpage_use_map & (1<<i)) &&
+        (cand->flags & SPIFFS_CACHE_FLAG_PROT) &&
+        (cache->last_access - cand->last_access) >= oldest_val) {
+      oldest_val = cache->last_access - cand->last_access;
+      cand_ix = i;
+    }
+  }
+  if (cand_ix >= 0) {
+    // back to probation as its most recently used page
+    spiffs_cache_page *old = spiffs_get_cache_page_hdr(fs, cache, cand_ix);
+    old->flags &= ~SPIFFS_CACHE_FLAG_PROT;
+    old->last_access = cache->last_access;
+    cache->cpage_prot--;
+  }
+}
+#endif
+
 // frees cached page
 static s32_t spiffs_cache_page_free(spiffs *fs, int ix, u8_t write_back) {
   s32_t res = SPIFFS_OK;
@@ -40,8 +79,16 @@ static s32_t spiffs_cache_page_free(spiffs *fs, int ix, u8_t write_back) {
         (cp->flags & SPIFFS_CACHE_FLAG_DIRTY)) {
       u8_t *mem =  spiffs_get_cache_page(fs, cache, ix);
       res = SPIFFS_HAL_WRITE(fs, SPIFFS_PAGE_TO_PADDR(fs, cp->pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), mem);
+#if SPIFFS_CACHE_STATS
+      fs->cache_write_backs++;
+#endif
     }
 
+#if SPIFFS_CACHE_SLRU
+    if (cp->flags & SPIFFS_CACHE_FLAG_PROT) {
+      cache->cpage_prot--;
+    }
+#endif
     cp->flags = 0;
     cache->cpage_use_map &= ~(1 << ix);
 
@@ -69,6 +116,22 @@ static s32_t spiffs_cache_page_remove_oldest(spiffs *fs, u8_t flag_mask, u8_t fl
   int i;
   int cand_ix = -1;
   u32_t oldest_val = 0;
+#if SPIFFS_CACHE_SLRU
+  // probationary pages go first, so a long sequential read only ever
+  // recycles those and leaves the protected pages alone
+  u8_t seg;
+  for (seg = 0; seg <= SPIFFS_CACHE_FLAG_PROT && cand_ix < 0; seg += SPIFFS_CACHE_FLAG_PROT) {
+    for (i = 0; i < cache->cpage_count; i++) {
+      spiffs_cache_page *cp = spiffs_get_cache_page_hdr(fs, cache, i);
+      if ((cache->last_access - cp->last_access) > oldest_val &&
+          (cp->flags & flag_mask) == flags &&
+          (cp->flags & SPIFFS_CACHE_FLAG_PROT) == seg) {
+        oldest_val = cache->last_access - cp->last_access;
+        cand_ix = i;
+      }
+    }
+  }
+#else
   for (i = 0; i < cache->cpage_count; i++) {
     spiffs_cache_page *cp = spiffs_get_cache_page_hdr(fs, cache, i);
     if ((cache->last_access - cp->last_access) > oldest_val &&
@@ -77,8 +140,12 @@ static s32_t spiffs_cache_page_remove_oldest(spiffs *fs, u8_t flag_mask, u8_t fl
       cand_ix = i;
     }
   }
+#endif
 
   if (cand_ix >= 0) {
+#if SPIFFS_CACHE_STATS
+    fs->cache_evictions++;
+#endif
     res = spiffs_cache_page_free(fs, cand_ix, 1);
   }
 
@@ -135,6 +202,9 @@ s32_t spiffs_phys_rd(
     fs->cache_hits++;
 #endif
     cp->last_access = cache->last_access;
+#if SPIFFS_CACHE_SLRU
+    spiffs_cache_page_promote(fs, cp);
+#endif
     u8_t *mem =  spiffs_get_cache_page(fs, cache, cp->ix);
     memcpy(dst, &mem[SPIFFS_PADDR_TO_PAGE_OFFSET(fs, addr)], len);
   } else {
@@ -153,6 +223,9 @@ s32_t spiffs_phys_rd(
     if (cp) {
       cp->flags = SPIFFS_CACHE_FLAG_WRTHRU;
       cp->pix = SPIFFS_PADDR_TO_PAGE(fs, addr);
+#if SPIFFS_CACHE_SLRU
+      cp->loaded = ++cache->loads;
+#endif
 
       s32_t res2 = SPIFFS_HAL_READ(fs,
           addr - SPIFFS_PADDR_TO_PAGE_OFFSET(fs, addr),
@@ -277,6 +350,20 @@ void spiffs_cache_fd_release(spiffs *fs, spiffs_cache_page *cp) {
 
 #endif
 
+// writes back and drops all cache pages, before the cache memory goes away
+s32_t spiffs_cache_drop_all(spiffs *fs) {
+  s32_t res = SPIFFS_OK;
+  spiffs_cache *cache = spiffs_get_cache(fs);
+  int i;
+  for (i = 0; i < cache->cpage_count; i++) {
+    s32_t res2 = spiffs_cache_page_free(fs, i, 1);
+    if (res2 != SPIFFS_OK) {
+      res = res2;
+    }
+  }
+  return res;
+}
+
 // initializes the cache
 void spiffs_cache_init(spiffs *fs) {
   if (fs->cache == 0) return;
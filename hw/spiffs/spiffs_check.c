@@ -14,6 +14,8 @@
  * Page consistency
  *   Checks for pages that ought to be indexed, ought not to be indexed, are multiple indexed
  *
+ * With SPIFFS_INCREMENTAL_CHECK the same checks can also run a block at a time,
+ * see spiffs_check_slice.
  *
  *  Created on: Jul 7, 2013
  *      Author: petera
@@ -25,14 +27,26 @@
 
 #if !SPIFFS_READ_ONLY
 
+#if SPIFFS_INCREMENTAL_CHECK
+// counts the reports that are fixes
+#define CHECK_FIX(_fs, _rep) \
+  do { \
+    if ((_rep) > SPIFFS_CHECK_ERROR) (_fs)->stats_check_fixes++; \
+  } while (0)
+#else
+#define CHECK_FIX(_fs, _rep)
+#endif
+
 #if SPIFFS_HAL_CALLBACK_EXTRA
 #define CHECK_CB(_fs, _type, _rep, _arg1, _arg2) \
   do { \
+    CHECK_FIX(_fs, _rep); \
     if ((_fs)->check_cb_f) (_fs)->check_cb_f((_fs), (_type), (_rep), (_arg1), (_arg2)); \
   } while (0)
 #else
 #define CHECK_CB(_fs, _type, _rep, _arg1, _arg2) \
   do { \
+    CHECK_FIX(_fs, _rep); \
     if ((_fs)->check_cb_f) (_fs)->check_cb_f((_type), (_rep), (_arg1), (_arg2)); \
   } while (0)
 #endif
@@ -139,14 +153,15 @@ static s32_t spiffs_rewrite_index(spiffs *fs, spiffs_obj_id obj_id, spiffs_span_
     ((spiffs_page_ix*)((u8_t *)fs->lu_work + sizeof(spiffs_page_object_ix)))[SPIFFS_OBJ_IX_ENTRY(fs, data_spix)] = new_data_pix;
   }
 
-  res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
-      0, SPIFFS_PAGE_TO_PADDR(fs, free_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
-  SPIFFS_CHECK_RES(res);
+  // look up entry first, as spiffs_page_copy
   res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_UPDT,
       0, SPIFFS_BLOCK_TO_PADDR(fs, SPIFFS_BLOCK_FOR_PAGE(fs, free_pix)) + SPIFFS_OBJ_LOOKUP_ENTRY_FOR_PAGE(fs, free_pix) * sizeof(spiffs_page_ix),
       sizeof(spiffs_obj_id),
       (u8_t *)&obj_id);
   SPIFFS_CHECK_RES(res);
+  res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+      0, SPIFFS_PAGE_TO_PADDR(fs, free_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
+  SPIFFS_CHECK_RES(res);
   res = spiffs_page_delete(fs, objix_pix);
 
   return res;
@@ -169,6 +184,161 @@ static s32_t spiffs_delete_obj_lazy(spiffs *fs, spiffs_obj_id obj_id) {
   return res;
 }
 
+// sets *past if data span spix lies past the size of object obj_id, where
+// an append or truncate cut off by power loss leaves refs to pages it has
+// deleted
+static s32_t spiffs_past_size(spiffs *fs, spiffs_obj_id obj_id, spiffs_span_ix spix, u8_t *past) {
+  spiffs_page_object_ix_header objix_hdr;
+  spiffs_page_ix objix_hdr_pix;
+  s32_t res;
+  *past = 0;
+  res = spiffs_obj_lu_find_id_and_span(fs, obj_id | SPIFFS_OBJ_ID_IX_FLAG, 0, 0, &objix_hdr_pix);
+  if (res == SPIFFS_ERR_NOT_FOUND) {
+    return SPIFFS_OK;
+  }
+  SPIFFS_CHECK_RES(res);
+  res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+      0, SPIFFS_PAGE_TO_PADDR(fs, objix_hdr_pix), sizeof(objix_hdr), (u8_t *)&objix_hdr);
+  SPIFFS_CHECK_RES(res);
+  *past = objix_hdr.size == SPIFFS_UNDEFINED_LEN ||
+      (u32_t)spix * SPIFFS_DATA_PAGE_SIZE(fs) >= objix_hdr.size;
+  return SPIFFS_OK;
+}
+
+// deletes index page pix if another copy of it is live, as a move cut off
+// by power loss leaves behind, and sets *dropped
+static s32_t spiffs_drop_index_copy(spiffs *fs, spiffs_page_header *p_hdr, spiffs_page_ix pix, u8_t *dropped) {
+  spiffs_page_ix copy_pix;
+  s32_t res;
+  *dropped = 0;
+  res = spiffs_obj_lu_find_id_and_span(fs, p_hdr->obj_id | SPIFFS_OBJ_ID_IX_FLAG, p_hdr->span_ix, pix, &copy_pix);
+  if (res == SPIFFS_ERR_NOT_FOUND) {
+    return SPIFFS_OK;
+  }
+  SPIFFS_CHECK_RES(res);
+  SPIFFS_CHECK_DBG("PA: FIXUP: ix pix "_SPIPRIpg" is a copy of "_SPIPRIpg", delete it\n", pix, copy_pix);
+  *dropped = 1;
+  res = spiffs_page_delete(fs, pix);
+  SPIFFS_CHECK_RES(res);
+  // open files and the name index may still refer to the dropped copy
+  spiffs_cb_object_event(fs, (spiffs_page_object_ix *)p_hdr,
+      SPIFFS_EV_IX_MOV, p_hdr->obj_id, p_hdr->span_ix, copy_pix, 0);
+  return SPIFFS_OK;
+}
+
+// counts the references of index page pix that do not lead to a live data
+// page of the object and span they stand for
+static s32_t spiffs_index_bad_refs(spiffs *fs, spiffs_page_header *p_hdr, spiffs_page_ix pix, u32_t *bad) {
+  spiffs_page_ix refs[16];
+  spiffs_page_header rp_hdr;
+  spiffs_span_ix data_spix_offset;
+  u32_t entries, offset, i, j, n;
+  s32_t res;
+  if (p_hdr->span_ix == 0) {
+    entries = SPIFFS_OBJ_HDR_IX_LEN(fs);
+    offset = sizeof(spiffs_page_object_ix_header);
+    data_spix_offset = 0;
+  } else {
+    entries = SPIFFS_OBJ_IX_LEN(fs);
+    offset = sizeof(spiffs_page_object_ix);
+    data_spix_offset = SPIFFS_OBJ_HDR_IX_LEN(fs) + SPIFFS_OBJ_IX_LEN(fs) * (p_hdr->span_ix - 1);
+  }
+  *bad = 0;
+  for (i = 0; i < entries; i += n) {
+    n = MIN(entries - i, sizeof(refs) / sizeof(refs[0]));
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+        0, SPIFFS_PAGE_TO_PADDR(fs, pix) + offset + i * sizeof(spiffs_page_ix),
+        n * sizeof(spiffs_page_ix), (u8_t*)refs);
+    SPIFFS_CHECK_RES(res);
+    for (j = 0; j < n; j++) {
+      if (refs[j] == (spiffs_page_ix)-1) {
+        continue;
+      }
+      if (refs[j] >= SPIFFS_MAX_PAGES(fs) || SPIFFS_IS_LOOKUP_PAGE(fs, refs[j])) {
+        (*bad)++;
+        continue;
+      }
+      res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+          0, SPIFFS_PAGE_TO_PADDR(fs, refs[j]), sizeof(spiffs_page_header), (u8_t*)&rp_hdr);
+      SPIFFS_CHECK_RES(res);
+      if (rp_hdr.obj_id != (p_hdr->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG) ||
+          rp_hdr.span_ix != data_spix_offset + i + j ||
+          (rp_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL)) !=
+          (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX)) {
+        (*bad)++;
+      }
+    }
+  }
+  return SPIFFS_OK;
+}
+
+// a page move cut off by power loss, after the new copy was finalized but
+// before the old one was deleted, leaves two live copies of an index page
+// that may refer to different, both live, copies of the data. If gc marked
+// one as the source of its move the other wins, else the copy with fewer
+// broken references does, either one on a tie as both then describe the
+// same contents; the loser is deleted. A source left without a copy is
+// copied afresh so lookups stop looking past it. Sets *dropped to the
+// deleted page, or 0 if pix is left as it is.
+static s32_t spiffs_resolve_index_copy(spiffs *fs, spiffs_page_header *p_hdr, spiffs_page_ix pix,
+    spiffs_page_ix *dropped) {
+  spiffs_page_header c_hdr;
+  spiffs_page_ix copy_pix;
+  u32_t bad, copy_bad;
+  s32_t res;
+  *dropped = 0;
+  res = spiffs_obj_lu_find_id_and_span(fs, p_hdr->obj_id | SPIFFS_OBJ_ID_IX_FLAG, p_hdr->span_ix, pix, &copy_pix);
+  if (res == SPIFFS_ERR_NOT_FOUND) {
+    if (p_hdr->flags & SPIFFS_PH_FLAG_MOVING) {
+      return SPIFFS_OK;
+    }
+    SPIFFS_CHECK_DBG("LU: FIXUP: ix pix "_SPIPRIpg" is an unfinished move, copy it\n", pix);
+    c_hdr = *p_hdr;
+    c_hdr.flags |= SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_MOVING;
+    res = spiffs_rewrite_page(fs, pix, &c_hdr, &copy_pix);
+    SPIFFS_CHECK_RES(res);
+    c_hdr.flags &= ~SPIFFS_PH_FLAG_FINAL;
+    res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+        0, SPIFFS_PAGE_TO_PADDR(fs, copy_pix) + offsetof(spiffs_page_header, flags),
+        sizeof(u8_t), (u8_t*)&c_hdr.flags);
+    SPIFFS_CHECK_RES(res);
+    *dropped = pix;
+  } else {
+    SPIFFS_CHECK_RES(res);
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+        0, SPIFFS_PAGE_TO_PADDR(fs, copy_pix), sizeof(spiffs_page_header), (u8_t*)&c_hdr);
+    SPIFFS_CHECK_RES(res);
+    if (c_hdr.obj_id != p_hdr->obj_id || c_hdr.span_ix != p_hdr->span_ix ||
+        ((c_hdr.flags ^ p_hdr->flags) & ~SPIFFS_PH_FLAG_MOVING)) {
+      // not a finished copy, the look up check of that page sees to it
+      return SPIFFS_OK;
+    }
+    if ((c_hdr.flags ^ p_hdr->flags) & SPIFFS_PH_FLAG_MOVING) {
+      bad = (p_hdr->flags & SPIFFS_PH_FLAG_MOVING) ? 0 : 1;
+      copy_bad = !bad;
+    } else {
+      res = spiffs_index_bad_refs(fs, p_hdr, pix, &bad);
+      SPIFFS_CHECK_RES(res);
+      res = spiffs_index_bad_refs(fs, &c_hdr, copy_pix, &copy_bad);
+      SPIFFS_CHECK_RES(res);
+    }
+    SPIFFS_CHECK_DBG("LU: ix pix "_SPIPRIpg" ("_SPIPRIi" bad) has a copy at "_SPIPRIpg" ("_SPIPRIi" bad)\n",
+        pix, bad, copy_pix, copy_bad);
+    if (copy_bad > bad) {
+      *dropped = copy_pix;
+      copy_pix = pix;
+    } else {
+      *dropped = pix;
+    }
+  }
+  res = spiffs_page_delete(fs, *dropped);
+  SPIFFS_CHECK_RES(res);
+  // open files and the name index may still refer to the dropped copy
+  spiffs_cb_object_event(fs, (spiffs_page_object_ix *)p_hdr,
+      SPIFFS_EV_IX_MOV, p_hdr->obj_id, p_hdr->span_ix, copy_pix, 0);
+  return SPIFFS_OK;
+}
+
 // validates the given look up entry
 static s32_t spiffs_lookup_check_validate(spiffs *fs, spiffs_obj_id lu_obj_id, spiffs_page_header *p_hdr,
     spiffs_page_ix cur_pix, spiffs_block_ix cur_block, int cur_entry, int *reload_lu) {
@@ -178,6 +348,14 @@ static s32_t spiffs_lookup_check_validate(spiffs *fs, spiffs_obj_id lu_obj_id, s
   s32_t res = SPIFFS_OK;
   spiffs_page_ix objix_pix;
   spiffs_page_ix ref_pix;
+  // a delete cut off by power loss clears only some of the id bits in the
+  // look up, finish it
+  if ((p_hdr->flags & SPIFFS_PH_FLAG_USED) == 0 && lu_obj_id != SPIFFS_OBJ_ID_DELETED &&
+      lu_obj_id != p_hdr->obj_id &&
+      (lu_obj_id & p_hdr->obj_id) == lu_obj_id) {
+    SPIFFS_CHECK_DBG("LU: pix "_SPIPRIpg" half deleted in lu:"_SPIPRIid" ph:"_SPIPRIid"\n", cur_pix, lu_obj_id, p_hdr->obj_id);
+    lu_obj_id = SPIFFS_OBJ_ID_DELETED;
+  }
   // check validity, take actions
   if (((lu_obj_id == SPIFFS_OBJ_ID_DELETED) && (p_hdr->flags & SPIFFS_PH_FLAG_DELET)) ||
       ((lu_obj_id == SPIFFS_OBJ_ID_FREE) && (p_hdr->flags & SPIFFS_PH_FLAG_USED) == 0)) {
@@ -243,6 +421,8 @@ static s32_t spiffs_lookup_check_validate(spiffs *fs, spiffs_obj_id lu_obj_id, s
     // look up entry used
     if ((p_hdr->obj_id | SPIFFS_OBJ_ID_IX_FLAG) != (lu_obj_id | SPIFFS_OBJ_ID_IX_FLAG)) {
       SPIFFS_CHECK_DBG("LU: pix "_SPIPRIpg" differ in obj_id lu:"_SPIPRIid" ph:"_SPIPRIid"\n", cur_pix, lu_obj_id, p_hdr->obj_id);
+      // the lookups below use the work buffer the visitor scans
+      *reload_lu = 1;
       delete_page = 1;
       if ((p_hdr->flags & SPIFFS_PH_FLAG_DELET) == 0 ||
           (p_hdr->flags & SPIFFS_PH_FLAG_FINAL) ||
@@ -345,6 +525,7 @@ static s32_t spiffs_lookup_check_validate(spiffs *fs, spiffs_obj_id lu_obj_id, s
     } else if (((lu_obj_id & SPIFFS_OBJ_ID_IX_FLAG) && (p_hdr->flags & SPIFFS_PH_FLAG_INDEX)) ||
         ((lu_obj_id & SPIFFS_OBJ_ID_IX_FLAG) == 0 && (p_hdr->flags & SPIFFS_PH_FLAG_INDEX) == 0)) {
       SPIFFS_CHECK_DBG("LU: "_SPIPRIpg" lu/page index marking differ\n", cur_pix);
+      *reload_lu = 1;
       spiffs_page_ix data_pix, objix_pix_d;
       // see if other data page exists for given obj id and span index
       res = spiffs_obj_lu_find_id_and_span(fs, lu_obj_id & ~SPIFFS_OBJ_ID_IX_FLAG, p_hdr->span_ix, cur_pix, &data_pix);
@@ -429,6 +610,17 @@ static s32_t spiffs_lookup_check_validate(spiffs *fs, spiffs_obj_id lu_obj_id, s
               sizeof(u8_t), (u8_t*)&flags);
         }
       }
+    } else if ((lu_obj_id & SPIFFS_OBJ_ID_IX_FLAG) &&
+        (p_hdr->flags & (SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_IXDELE)) == SPIFFS_PH_FLAG_IXDELE) {
+      spiffs_page_ix dropped;
+      // the search for a copy reuses the look up buffer
+      *reload_lu = 1;
+      res = spiffs_resolve_index_copy(fs, p_hdr, cur_pix, &dropped);
+      SPIFFS_CHECK_RES(res);
+      if (dropped) {
+        SPIFFS_CHECK_DBG("LU: FIXUP: deleted index copy "_SPIPRIpg"\n", dropped);
+        CHECK_CB(fs, SPIFFS_CHECK_LOOKUP, SPIFFS_CHECK_DELETE_PAGE, dropped, 0);
+      }
     }
   }
 
@@ -505,338 +697,402 @@ s32_t spiffs_lookup_consistency_check(spiffs *fs, u8_t check_all_objects) {
 //  * x000 free, unreferenced, not index
 //  * x011 used, referenced only once, not index
 //  * x101 used, unreferenced, index
-// The working memory might not fit all pages so several scans might be needed
-static s32_t spiffs_page_consistency_check_i(spiffs *fs) {
+// The working memory might not fit all pages so several scans might be needed,
+// one per range of pages. The bitmap of a range is built block by block.
+static s32_t spiffs_page_check_block(spiffs *fs, spiffs_page_ix pix_offset,
+    spiffs_block_ix cur_block, u8_t *restart) {
   const u32_t bits = 4;
   const spiffs_page_ix pages_per_scan = SPIFFS_CFG_LOG_PAGE_SZ(fs) * 8 / bits;
-
   s32_t res = SPIFFS_OK;
-  spiffs_page_ix pix_offset = 0;
 
-  // for each range of pages fitting into work memory
-  while (pix_offset < SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count) {
-    // set this flag to abort all checks and rescan the page range
-    u8_t restart = 0;
-    memset(fs->work, 0, SPIFFS_CFG_LOG_PAGE_SZ(fs));
+  CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_PROGRESS,
+      (pix_offset*256)/(SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count) +
+      ((((cur_block * pages_per_scan * 256)/ (SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count))) / fs->block_count),
+      0);
+  // traverse each page except for lookup pages
+  spiffs_page_ix cur_pix = SPIFFS_OBJ_LOOKUP_PAGES(fs) + SPIFFS_PAGES_PER_BLOCK(fs) * cur_block;
+  while (!*restart && cur_pix < SPIFFS_PAGES_PER_BLOCK(fs) * (cur_block+1)) {
+    //if ((cur_pix & 0xff) == 0)
+    //  SPIFFS_CHECK_DBG("PA: processing pix "_SPIPRIpg", block "_SPIPRIbl" of pix "_SPIPRIpg", block "_SPIPRIbl"\n",
+    //      cur_pix, cur_block, SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count, fs->block_count);
+
+    // read header
+    spiffs_page_header p_hdr;
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+        0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
+    SPIFFS_CHECK_RES(res);
 
-    spiffs_block_ix cur_block = 0;
-    // build consistency bitmap for id range traversing all blocks
-    while (!restart && cur_block < fs->block_count) {
-      CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_PROGRESS,
-          (pix_offset*256)/(SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count) +
-          ((((cur_block * pages_per_scan * 256)/ (SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count))) / fs->block_count),
-          0);
-      // traverse each page except for lookup pages
-      spiffs_page_ix cur_pix = SPIFFS_OBJ_LOOKUP_PAGES(fs) + SPIFFS_PAGES_PER_BLOCK(fs) * cur_block;
-      while (!restart && cur_pix < SPIFFS_PAGES_PER_BLOCK(fs) * (cur_block+1)) {
-        //if ((cur_pix & 0xff) == 0)
-        //  SPIFFS_CHECK_DBG("PA: processing pix "_SPIPRIpg", block "_SPIPRIbl" of pix "_SPIPRIpg", block "_SPIPRIbl"\n",
-        //      cur_pix, cur_block, SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count, fs->block_count);
-
-        // read header
-        spiffs_page_header p_hdr;
-        res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
-            0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
-        SPIFFS_CHECK_RES(res);
+    u8_t within_range = (cur_pix >= pix_offset && cur_pix < pix_offset + pages_per_scan);
+    const u32_t pix_byte_ix = (cur_pix - pix_offset) / (8/bits);
+    const u8_t pix_bit_ix = (cur_pix & ((8/bits)-1)) * bits;
 
-        u8_t within_range = (cur_pix >= pix_offset && cur_pix < pix_offset + pages_per_scan);
-        const u32_t pix_byte_ix = (cur_pix - pix_offset) / (8/bits);
-        const u8_t pix_bit_ix = (cur_pix & ((8/bits)-1)) * bits;
+    if (within_range &&
+        (p_hdr.flags & SPIFFS_PH_FLAG_DELET) && (p_hdr.flags & SPIFFS_PH_FLAG_USED) == 0) {
+      // used
+      fs->work[pix_byte_ix] |= (1<<(pix_bit_ix + 0));
+    }
+    if ((p_hdr.flags & SPIFFS_PH_FLAG_DELET) &&
+        (p_hdr.flags & SPIFFS_PH_FLAG_IXDELE) &&
+        (p_hdr.flags & (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED)) == 0) {
+      // found non-deleted index
+      if (within_range) {
+        fs->work[pix_byte_ix] |= (1<<(pix_bit_ix + 2));
+      }
 
-        if (within_range &&
-            (p_hdr.flags & SPIFFS_PH_FLAG_DELET) && (p_hdr.flags & SPIFFS_PH_FLAG_USED) == 0) {
-          // used
-          fs->work[pix_byte_ix] |= (1<<(pix_bit_ix + 0));
-        }
-        if ((p_hdr.flags & SPIFFS_PH_FLAG_DELET) &&
-            (p_hdr.flags & SPIFFS_PH_FLAG_IXDELE) &&
-            (p_hdr.flags & (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED)) == 0) {
-          // found non-deleted index
-          if (within_range) {
-            fs->work[pix_byte_ix] |= (1<<(pix_bit_ix + 2));
-          }
+      // load non-deleted index
+      res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+          0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
+      SPIFFS_CHECK_RES(res);
 
-          // load non-deleted index
-          res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
-              0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
-          SPIFFS_CHECK_RES(res);
+      // traverse index for referenced pages
+      spiffs_page_ix *object_page_index;
+
+      int entries;
+      int i;
+      spiffs_span_ix data_spix_offset;
+      if (p_hdr.span_ix == 0) {
+        // object header page index
+        entries = SPIFFS_OBJ_HDR_IX_LEN(fs);
+        data_spix_offset = 0;
+        object_page_index = (spiffs_page_ix *)((u8_t *)fs->lu_work + sizeof(spiffs_page_object_ix_header));
+      } else {
+        // object page index
+        entries = SPIFFS_OBJ_IX_LEN(fs);
+        data_spix_offset = SPIFFS_OBJ_HDR_IX_LEN(fs) + SPIFFS_OBJ_IX_LEN(fs) * (p_hdr.span_ix - 1);
+        object_page_index = (spiffs_page_ix *)((u8_t *)fs->lu_work + sizeof(spiffs_page_object_ix));
+      }
 
-          // traverse index for referenced pages
-          spiffs_page_ix *object_page_index;
-          spiffs_page_header *objix_p_hdr = (spiffs_page_header *)fs->lu_work;
-
-          int entries;
-          int i;
-          spiffs_span_ix data_spix_offset;
-          if (p_hdr.span_ix == 0) {
-            // object header page index
-            entries = SPIFFS_OBJ_HDR_IX_LEN(fs);
-            data_spix_offset = 0;
-            object_page_index = (spiffs_page_ix *)((u8_t *)fs->lu_work + sizeof(spiffs_page_object_ix_header));
+      // for all entries in index
+      for (i = 0; !*restart && i < entries; i++) {
+        spiffs_page_ix rpix = object_page_index[i];
+        u8_t rpix_within_range = rpix >= pix_offset && rpix < pix_offset + pages_per_scan;
+
+        if ((rpix != (spiffs_page_ix)-1 && rpix > SPIFFS_MAX_PAGES(fs))
+            || (rpix_within_range && SPIFFS_IS_LOOKUP_PAGE(fs, rpix))) {
+
+          // bad reference
+          SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg"x bad pix / LU referenced from page "_SPIPRIpg"\n",
+              rpix, cur_pix);
+          // a live copy of this index page is the newer one, mending this
+          // one would make a second live index
+          u8_t dropped;
+          res = spiffs_drop_index_copy(fs, &p_hdr, cur_pix, &dropped);
+          SPIFFS_CHECK_RES(res);
+          if (dropped) {
+            CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_PAGE, p_hdr.obj_id, p_hdr.span_ix);
+            *restart = 1;
+            break;
+          }
+          // check for data page elsewhere, the look up reuses lu_work so use
+          // the index page header copy from here on
+          spiffs_page_ix data_pix;
+          res = spiffs_obj_lu_find_id_and_span(fs, p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG,
+              data_spix_offset + i, 0, &data_pix);
+          if (res == SPIFFS_ERR_NOT_FOUND) {
+            res = SPIFFS_OK;
+            data_pix = 0;
+          }
+          SPIFFS_CHECK_RES(res);
+          if (data_pix == 0) {
+            // if not, allocate free page
+            spiffs_page_header new_ph;
+            new_ph.flags = 0xff & ~(SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL);
+            new_ph.obj_id = p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
+            new_ph.span_ix = data_spix_offset + i;
+            res = spiffs_page_allocate_data(fs, new_ph.obj_id, &new_ph, 0, 0, 0, 1, &data_pix);
+            SPIFFS_CHECK_RES(res);
+            SPIFFS_CHECK_DBG("PA: FIXUP: found no existing data page, created new @ "_SPIPRIpg"\n", data_pix);
+          }
+          // remap index
+          SPIFFS_CHECK_DBG("PA: FIXUP: rewriting index pix "_SPIPRIpg"\n", cur_pix);
+          res = spiffs_rewrite_index(fs, p_hdr.obj_id | SPIFFS_OBJ_ID_IX_FLAG,
+              data_spix_offset + i, data_pix, cur_pix);
+          if (res <= _SPIFFS_ERR_CHECK_FIRST && res > _SPIFFS_ERR_CHECK_LAST) {
+            // index bad also, cannot mend this file
+            SPIFFS_CHECK_DBG("PA: FIXUP: index bad "_SPIPRIi", cannot mend - delete object\n", res);
+            CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
+            // delete file
+            res = spiffs_page_delete(fs, cur_pix);
           } else {
-            // object page index
-            entries = SPIFFS_OBJ_IX_LEN(fs);
-            data_spix_offset = SPIFFS_OBJ_HDR_IX_LEN(fs) + SPIFFS_OBJ_IX_LEN(fs) * (p_hdr.span_ix - 1);
-            object_page_index = (spiffs_page_ix *)((u8_t *)fs->lu_work + sizeof(spiffs_page_object_ix));
+            CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, p_hdr.obj_id, p_hdr.span_ix);
           }
+          SPIFFS_CHECK_RES(res);
+          *restart = 1;
 
-          // for all entries in index
-          for (i = 0; !restart && i < entries; i++) {
-            spiffs_page_ix rpix = object_page_index[i];
-            u8_t rpix_within_range = rpix >= pix_offset && rpix < pix_offset + pages_per_scan;
+        } else if (rpix_within_range) {
 
-            if ((rpix != (spiffs_page_ix)-1 && rpix > SPIFFS_MAX_PAGES(fs))
-                || (rpix_within_range && SPIFFS_IS_LOOKUP_PAGE(fs, rpix))) {
+          // valid reference
+          // read referenced page header
+          spiffs_page_header rp_hdr;
+          res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+              0, SPIFFS_PAGE_TO_PADDR(fs, rpix), sizeof(spiffs_page_header), (u8_t*)&rp_hdr);
+          SPIFFS_CHECK_RES(res);
 
-              // bad reference
-              SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg"x bad pix / LU referenced from page "_SPIPRIpg"\n",
+          // cross reference page header check
+          if (rp_hdr.obj_id != (p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG) ||
+              rp_hdr.span_ix != data_spix_offset + i ||
+              (rp_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED)) !=
+                  (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX)) {
+           SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" has inconsistent page header ix id/span:"_SPIPRIid"/"_SPIPRIsp", ref id/span:"_SPIPRIid"/"_SPIPRIsp" flags:"_SPIPRIfl"\n",
+                rpix, p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG, data_spix_offset + i,
+                rp_hdr.obj_id, rp_hdr.span_ix, rp_hdr.flags);
+           // a stale copy of the index, left by a move cut short, refers to
+           // pages its successor has since deleted; pointing it at the
+           // successor's pages would leave two live copies
+           u8_t dropped;
+           res = spiffs_drop_index_copy(fs, &p_hdr, cur_pix, &dropped);
+           SPIFFS_CHECK_RES(res);
+           if (dropped) {
+             CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_PAGE, p_hdr.obj_id, p_hdr.span_ix);
+             *restart = 1;
+             break;
+           }
+           // try finding correct page
+           spiffs_page_ix data_pix;
+           res = spiffs_obj_lu_find_id_and_span(fs, p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG,
+               data_spix_offset + i, rpix, &data_pix);
+           if (res == SPIFFS_ERR_NOT_FOUND) {
+             res = SPIFFS_OK;
+             data_pix = 0;
+           }
+           SPIFFS_CHECK_RES(res);
+           u8_t past = 0;
+           if (data_pix == 0) {
+             res = spiffs_past_size(fs, p_hdr.obj_id, data_spix_offset + i, &past);
+             SPIFFS_CHECK_RES(res);
+           }
+           if (past) {
+             // nothing of the file there, forget the ref
+             SPIFFS_CHECK_DBG("PA: FIXUP: clear ref past the end, rewrite ix pix "_SPIPRIpg" id "_SPIPRIid"\n",
+                 cur_pix, p_hdr.obj_id);
+             res = spiffs_rewrite_index(fs, p_hdr.obj_id, data_spix_offset + i,
+                 (spiffs_page_ix)SPIFFS_OBJ_ID_FREE, cur_pix);
+             SPIFFS_CHECK_RES(res);
+             CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, p_hdr.obj_id, p_hdr.span_ix);
+             *restart = 1;
+           } else if (data_pix == 0) {
+             // not found, this index is badly borked
+             SPIFFS_CHECK_DBG("PA: FIXUP: index bad, delete object id "_SPIPRIid"\n", p_hdr.obj_id);
+             CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
+             res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
+             SPIFFS_CHECK_RES(res);
+             break;
+           } else {
+             // found it, so rewrite index
+             SPIFFS_CHECK_DBG("PA: FIXUP: found correct data pix "_SPIPRIpg", rewrite ix pix "_SPIPRIpg" id "_SPIPRIid"\n",
+                 data_pix, cur_pix, p_hdr.obj_id);
+             res = spiffs_rewrite_index(fs, p_hdr.obj_id, data_spix_offset + i, data_pix, cur_pix);
+             if (res <= _SPIFFS_ERR_CHECK_FIRST && res > _SPIFFS_ERR_CHECK_LAST) {
+               // index bad also, cannot mend this file
+               SPIFFS_CHECK_DBG("PA: FIXUP: index bad "_SPIPRIi", cannot mend!\n", res);
+               CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
+               res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
+             } else {
+               CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, p_hdr.obj_id, p_hdr.span_ix);
+             }
+             SPIFFS_CHECK_RES(res);
+             *restart = 1;
+           }
+          }
+          else {
+            // mark rpix as referenced
+            const u32_t rpix_byte_ix = (rpix - pix_offset) / (8/bits);
+            const u8_t rpix_bit_ix = (rpix & ((8/bits)-1)) * bits;
+            if (fs->work[rpix_byte_ix] & (1<<(rpix_bit_ix + 1))) {
+              u8_t dropped;
+              SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" multiple referenced from page "_SPIPRIpg"\n",
                   rpix, cur_pix);
-              // check for data page elsewhere
-              spiffs_page_ix data_pix;
-              res = spiffs_obj_lu_find_id_and_span(fs, objix_p_hdr->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG,
-                  data_spix_offset + i, 0, &data_pix);
-              if (res == SPIFFS_ERR_NOT_FOUND) {
-                res = SPIFFS_OK;
-                data_pix = 0;
-              }
+              res = spiffs_drop_index_copy(fs, &p_hdr, cur_pix, &dropped);
               SPIFFS_CHECK_RES(res);
-              if (data_pix == 0) {
-                // if not, allocate free page
-                spiffs_page_header new_ph;
-                new_ph.flags = 0xff & ~(SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL);
-                new_ph.obj_id = objix_p_hdr->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
-                new_ph.span_ix = data_spix_offset + i;
-                res = spiffs_page_allocate_data(fs, new_ph.obj_id, &new_ph, 0, 0, 0, 1, &data_pix);
-                SPIFFS_CHECK_RES(res);
-                SPIFFS_CHECK_DBG("PA: FIXUP: found no existing data page, created new @ "_SPIPRIpg"\n", data_pix);
-              }
-              // remap index
-              SPIFFS_CHECK_DBG("PA: FIXUP: rewriting index pix "_SPIPRIpg"\n", cur_pix);
-              res = spiffs_rewrite_index(fs, objix_p_hdr->obj_id | SPIFFS_OBJ_ID_IX_FLAG,
-                  data_spix_offset + i, data_pix, cur_pix);
-              if (res <= _SPIFFS_ERR_CHECK_FIRST && res > _SPIFFS_ERR_CHECK_LAST) {
-                // index bad also, cannot mend this file
-                SPIFFS_CHECK_DBG("PA: FIXUP: index bad "_SPIPRIi", cannot mend - delete object\n", res);
-                CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, objix_p_hdr->obj_id, 0);
-                // delete file
-                res = spiffs_page_delete(fs, cur_pix);
-              } else {
-                CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, objix_p_hdr->obj_id, objix_p_hdr->span_ix);
+              if (dropped) {
+                CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_PAGE, p_hdr.obj_id, p_hdr.span_ix);
+                *restart = 1;
+                break;
               }
+              // Here, we should have fixed all broken references - getting this means there
+              // must be multiple files with same object id. Only solution is to delete
+              // the object which is referring to this page
+              SPIFFS_CHECK_DBG("PA: FIXUP: removing object "_SPIPRIid" and page "_SPIPRIpg"\n",
+                  p_hdr.obj_id, cur_pix);
+              CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
+              res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
               SPIFFS_CHECK_RES(res);
-              restart = 1;
-
-            } else if (rpix_within_range) {
-
-              // valid reference
-              // read referenced page header
-              spiffs_page_header rp_hdr;
-              res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
-                  0, SPIFFS_PAGE_TO_PADDR(fs, rpix), sizeof(spiffs_page_header), (u8_t*)&rp_hdr);
+              // extra precaution, delete this page also
+              res = spiffs_page_delete(fs, cur_pix);
               SPIFFS_CHECK_RES(res);
-
-              // cross reference page header check
-              if (rp_hdr.obj_id != (p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG) ||
-                  rp_hdr.span_ix != data_spix_offset + i ||
-                  (rp_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED)) !=
-                      (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX)) {
-               SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" has inconsistent page header ix id/span:"_SPIPRIid"/"_SPIPRIsp", ref id/span:"_SPIPRIid"/"_SPIPRIsp" flags:"_SPIPRIfl"\n",
-                    rpix, p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG, data_spix_offset + i,
-                    rp_hdr.obj_id, rp_hdr.span_ix, rp_hdr.flags);
-               // try finding correct page
-               spiffs_page_ix data_pix;
-               res = spiffs_obj_lu_find_id_and_span(fs, p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG,
-                   data_spix_offset + i, rpix, &data_pix);
-               if (res == SPIFFS_ERR_NOT_FOUND) {
-                 res = SPIFFS_OK;
-                 data_pix = 0;
-               }
-               SPIFFS_CHECK_RES(res);
-               if (data_pix == 0) {
-                 // not found, this index is badly borked
-                 SPIFFS_CHECK_DBG("PA: FIXUP: index bad, delete object id "_SPIPRIid"\n", p_hdr.obj_id);
-                 CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
-                 res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
-                 SPIFFS_CHECK_RES(res);
-                 break;
-               } else {
-                 // found it, so rewrite index
-                 SPIFFS_CHECK_DBG("PA: FIXUP: found correct data pix "_SPIPRIpg", rewrite ix pix "_SPIPRIpg" id "_SPIPRIid"\n",
-                     data_pix, cur_pix, p_hdr.obj_id);
-                 res = spiffs_rewrite_index(fs, p_hdr.obj_id, data_spix_offset + i, data_pix, cur_pix);
-                 if (res <= _SPIFFS_ERR_CHECK_FIRST && res > _SPIFFS_ERR_CHECK_LAST) {
-                   // index bad also, cannot mend this file
-                   SPIFFS_CHECK_DBG("PA: FIXUP: index bad "_SPIPRIi", cannot mend!\n", res);
-                   CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
-                   res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
-                 } else {
-                   CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, p_hdr.obj_id, p_hdr.span_ix);
-                 }
-                 SPIFFS_CHECK_RES(res);
-                 restart = 1;
-               }
-              }
-              else {
-                // mark rpix as referenced
-                const u32_t rpix_byte_ix = (rpix - pix_offset) / (8/bits);
-                const u8_t rpix_bit_ix = (rpix & ((8/bits)-1)) * bits;
-                if (fs->work[rpix_byte_ix] & (1<<(rpix_bit_ix + 1))) {
-                  SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" multiple referenced from page "_SPIPRIpg"\n",
-                      rpix, cur_pix);
-                  // Here, we should have fixed all broken references - getting this means there
-                  // must be multiple files with same object id. Only solution is to delete
-                  // the object which is referring to this page
-                  SPIFFS_CHECK_DBG("PA: FIXUP: removing object "_SPIPRIid" and page "_SPIPRIpg"\n",
-                      p_hdr.obj_id, cur_pix);
-                  CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
-                  res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
-                  SPIFFS_CHECK_RES(res);
-                  // extra precaution, delete this page also
-                  res = spiffs_page_delete(fs, cur_pix);
-                  SPIFFS_CHECK_RES(res);
-                  restart = 1;
-                }
-                fs->work[rpix_byte_ix] |= (1<<(rpix_bit_ix + 1));
-              }
+              *restart = 1;
             }
-          } // for all index entries
-        } // found index
+            fs->work[rpix_byte_ix] |= (1<<(rpix_bit_ix + 1));
+          }
+        }
+      } // for all index entries
+    } // found index
 
-        // next page
-        cur_pix++;
-      }
-      // next block
-      cur_block++;
-    }
-    // check consistency bitmap
-    if (!restart) {
-      spiffs_page_ix objix_pix;
-      spiffs_page_ix rpix;
+    // next page
+    cur_pix++;
+  }
+  return res;
+}
+
+// Mends the pages of a range whose bitmap is complete
+static s32_t spiffs_page_check_bitmap(spiffs *fs, spiffs_page_ix pix_offset, u8_t *restart) {
+  const u32_t bits = 4;
+  s32_t res = SPIFFS_OK;
+  spiffs_page_ix objix_pix;
+  spiffs_page_ix rpix;
 
-      u32_t byte_ix;
-      u8_t bit_ix;
-      for (byte_ix = 0; !restart && byte_ix < SPIFFS_CFG_LOG_PAGE_SZ(fs); byte_ix++) {
-        for (bit_ix = 0; !restart && bit_ix < 8/bits; bit_ix ++) {
-          u8_t bitmask = (fs->work[byte_ix] >> (bit_ix * bits)) & 0x7;
-          spiffs_page_ix cur_pix = pix_offset + byte_ix * (8/bits) + bit_ix;
+  u32_t byte_ix;
+  u8_t bit_ix;
+  for (byte_ix = 0; !*restart && byte_ix < SPIFFS_CFG_LOG_PAGE_SZ(fs); byte_ix++) {
+    for (bit_ix = 0; !*restart && bit_ix < 8/bits; bit_ix ++) {
+      u8_t bitmask = (fs->work[byte_ix] >> (bit_ix * bits)) & 0x7;
+      spiffs_page_ix cur_pix = pix_offset + byte_ix * (8/bits) + bit_ix;
 
-          // 000 ok - free, unreferenced, not index
+      // 000 ok - free, unreferenced, not index
 
-          if (bitmask == 0x1) {
+      if (bitmask == 0x1) {
 
-            // 001
-            SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" USED, UNREFERENCED, not index\n", cur_pix);
+        // 001
+        SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" USED, UNREFERENCED, not index\n", cur_pix);
 
-            u8_t rewrite_ix_to_this = 0;
-            u8_t delete_page = 0;
-            // check corresponding object index entry
-            spiffs_page_header p_hdr;
+        u8_t rewrite_ix_to_this = 0;
+        u8_t delete_page = 0;
+        // check corresponding object index entry
+        spiffs_page_header p_hdr;
+        res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+            0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
+        SPIFFS_CHECK_RES(res);
+
+        res = spiffs_object_get_data_page_index_reference(fs, p_hdr.obj_id, p_hdr.span_ix,
+            &rpix, &objix_pix);
+        if (res == SPIFFS_OK) {
+          if (((rpix == (spiffs_page_ix)-1 || rpix > SPIFFS_MAX_PAGES(fs)) || (SPIFFS_IS_LOOKUP_PAGE(fs, rpix)))) {
+            // pointing to a bad page altogether, rewrite index to this
+            rewrite_ix_to_this = 1;
+            SPIFFS_CHECK_DBG("PA: corresponding ref is bad: "_SPIPRIpg", rewrite to this "_SPIPRIpg"\n", rpix, cur_pix);
+          } else {
+            // pointing to something else, check what
+            spiffs_page_header rp_hdr;
             res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
-                0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
+                0, SPIFFS_PAGE_TO_PADDR(fs, rpix), sizeof(spiffs_page_header), (u8_t*)&rp_hdr);
             SPIFFS_CHECK_RES(res);
-
-            res = spiffs_object_get_data_page_index_reference(fs, p_hdr.obj_id, p_hdr.span_ix,
-                &rpix, &objix_pix);
-            if (res == SPIFFS_OK) {
-              if (((rpix == (spiffs_page_ix)-1 || rpix > SPIFFS_MAX_PAGES(fs)) || (SPIFFS_IS_LOOKUP_PAGE(fs, rpix)))) {
-                // pointing to a bad page altogether, rewrite index to this
+            if (((p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG) == rp_hdr.obj_id) &&
+                ((rp_hdr.flags & (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL)) ==
+                    (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_DELET))) {
+              // pointing to something else valid, just delete this page then
+              SPIFFS_CHECK_DBG("PA: corresponding ref is good but different: "_SPIPRIpg", delete this "_SPIPRIpg"\n", rpix, cur_pix);
+              delete_page = 1;
+            } else {
+              // pointing to something weird, update index to point to this page instead
+              if (rpix != cur_pix) {
+                SPIFFS_CHECK_DBG("PA: corresponding ref is weird: "_SPIPRIpg" %s%s%s%s, rewrite this "_SPIPRIpg"\n", rpix,
+                    (rp_hdr.flags & SPIFFS_PH_FLAG_INDEX) ? "" : "INDEX ",
+                        (rp_hdr.flags & SPIFFS_PH_FLAG_DELET) ? "" : "DELETED ",
+                            (rp_hdr.flags & SPIFFS_PH_FLAG_USED) ? "NOTUSED " : "",
+                                (rp_hdr.flags & SPIFFS_PH_FLAG_FINAL) ? "NOTFINAL " : "",
+                    cur_pix);
                 rewrite_ix_to_this = 1;
-                SPIFFS_CHECK_DBG("PA: corresponding ref is bad: "_SPIPRIpg", rewrite to this "_SPIPRIpg"\n", rpix, cur_pix);
               } else {
-                // pointing to something else, check what
-                spiffs_page_header rp_hdr;
-                res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
-                    0, SPIFFS_PAGE_TO_PADDR(fs, rpix), sizeof(spiffs_page_header), (u8_t*)&rp_hdr);
-                SPIFFS_CHECK_RES(res);
-                if (((p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG) == rp_hdr.obj_id) &&
-                    ((rp_hdr.flags & (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL)) ==
-                        (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_DELET))) {
-                  // pointing to something else valid, just delete this page then
-                  SPIFFS_CHECK_DBG("PA: corresponding ref is good but different: "_SPIPRIpg", delete this "_SPIPRIpg"\n", rpix, cur_pix);
-                  delete_page = 1;
-                } else {
-                  // pointing to something weird, update index to point to this page instead
-                  if (rpix != cur_pix) {
-                    SPIFFS_CHECK_DBG("PA: corresponding ref is weird: "_SPIPRIpg" %s%s%s%s, rewrite this "_SPIPRIpg"\n", rpix,
-                        (rp_hdr.flags & SPIFFS_PH_FLAG_INDEX) ? "" : "INDEX ",
-                            (rp_hdr.flags & SPIFFS_PH_FLAG_DELET) ? "" : "DELETED ",
-                                (rp_hdr.flags & SPIFFS_PH_FLAG_USED) ? "NOTUSED " : "",
-                                    (rp_hdr.flags & SPIFFS_PH_FLAG_FINAL) ? "NOTFINAL " : "",
-                        cur_pix);
-                    rewrite_ix_to_this = 1;
-                  } else {
-                    // should not happen, destined for fubar
-                  }
-                }
+                // should not happen, destined for fubar
               }
-            } else if (res == SPIFFS_ERR_NOT_FOUND) {
-              SPIFFS_CHECK_DBG("PA: corresponding ref not found, delete "_SPIPRIpg"\n", cur_pix);
-              delete_page = 1;
-              res = SPIFFS_OK;
             }
+          }
+        } else if (res == SPIFFS_ERR_NOT_FOUND) {
+          SPIFFS_CHECK_DBG("PA: corresponding ref not found, delete "_SPIPRIpg"\n", cur_pix);
+          delete_page = 1;
+          res = SPIFFS_OK;
+        }
 
-            if (rewrite_ix_to_this) {
-              // if pointing to invalid page, redirect index to this page
-              SPIFFS_CHECK_DBG("PA: FIXUP: rewrite index id "_SPIPRIid" data spix "_SPIPRIsp" to point to this pix: "_SPIPRIpg"\n",
-                  p_hdr.obj_id, p_hdr.span_ix, cur_pix);
-              res = spiffs_rewrite_index(fs, p_hdr.obj_id, p_hdr.span_ix, cur_pix, objix_pix);
-              if (res <= _SPIFFS_ERR_CHECK_FIRST && res > _SPIFFS_ERR_CHECK_LAST) {
-                // index bad also, cannot mend this file
-                SPIFFS_CHECK_DBG("PA: FIXUP: index bad "_SPIPRIi", cannot mend!\n", res);
-                CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
-                res = spiffs_page_delete(fs, cur_pix);
-                SPIFFS_CHECK_RES(res);
-                res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
-              } else {
-                CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, p_hdr.obj_id, p_hdr.span_ix);
-              }
-              SPIFFS_CHECK_RES(res);
-              restart = 1;
-              continue;
-            } else if (delete_page) {
-              SPIFFS_CHECK_DBG("PA: FIXUP: deleting page "_SPIPRIpg"\n", cur_pix);
-              CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_PAGE, cur_pix, 0);
-              res = spiffs_page_delete(fs, cur_pix);
-            }
+        if (rewrite_ix_to_this) {
+          // if pointing to invalid page, redirect index to this page
+          SPIFFS_CHECK_DBG("PA: FIXUP: rewrite index id "_SPIPRIid" data spix "_SPIPRIsp" to point to this pix: "_SPIPRIpg"\n",
+              p_hdr.obj_id, p_hdr.span_ix, cur_pix);
+          res = spiffs_rewrite_index(fs, p_hdr.obj_id, p_hdr.span_ix, cur_pix, objix_pix);
+          if (res <= _SPIFFS_ERR_CHECK_FIRST && res > _SPIFFS_ERR_CHECK_LAST) {
+            // index bad also, cannot mend this file
+            SPIFFS_CHECK_DBG("PA: FIXUP: index bad "_SPIPRIi", cannot mend!\n", res);
+            CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_BAD_FILE, p_hdr.obj_id, 0);
+            res = spiffs_page_delete(fs, cur_pix);
             SPIFFS_CHECK_RES(res);
+            res = spiffs_delete_obj_lazy(fs, p_hdr.obj_id);
+          } else {
+            CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_FIX_INDEX, p_hdr.obj_id, p_hdr.span_ix);
           }
-          if (bitmask == 0x2) {
+          SPIFFS_CHECK_RES(res);
+          *restart = 1;
+          continue;
+        } else if (delete_page) {
+          SPIFFS_CHECK_DBG("PA: FIXUP: deleting page "_SPIPRIpg"\n", cur_pix);
+          CHECK_CB(fs, SPIFFS_CHECK_PAGE, SPIFFS_CHECK_DELETE_PAGE, cur_pix, 0);
+          res = spiffs_page_delete(fs, cur_pix);
+        }
+        SPIFFS_CHECK_RES(res);
+      }
+      if (bitmask == 0x2) {
 
-            // 010
-            SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" FREE, REFERENCED, not index\n", cur_pix);
+        // 010
+        SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" FREE, REFERENCED, not index\n", cur_pix);
 
-            // no op, this should be taken care of when checking valid references
-          }
+        // no op, this should be taken care of when checking valid references
+      }
 
-          // 011 ok - busy, referenced, not index
+      // 011 ok - busy, referenced, not index
 
-          if (bitmask == 0x4) {
+      if (bitmask == 0x4) {
 
-            // 100
-            SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" FREE, unreferenced, INDEX\n", cur_pix);
+        // 100
+        SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" FREE, unreferenced, INDEX\n", cur_pix);
 
-            // this should never happen, major fubar
-          }
+        // this should never happen, major fubar
+      }
 
-          // 101 ok - busy, unreferenced, index
+      // 101 ok - busy, unreferenced, index
 
-          if (bitmask == 0x6) {
+      if (bitmask == 0x6) {
 
-            // 110
-            SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" FREE, REFERENCED, INDEX\n", cur_pix);
+        // 110
+        SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" FREE, REFERENCED, INDEX\n", cur_pix);
 
-            // no op, this should be taken care of when checking valid references
-          }
-          if (bitmask == 0x7) {
+        // no op, this should be taken care of when checking valid references
+      }
+      if (bitmask == 0x7) {
 
-            // 111
-            SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" USED, REFERENCED, INDEX\n", cur_pix);
+        // 111
+        SPIFFS_CHECK_DBG("PA: pix "_SPIPRIpg" USED, REFERENCED, INDEX\n", cur_pix);
 
-            // no op, this should be taken care of when checking valid references
-          }
-        }
+        // no op, this should be taken care of when checking valid references
       }
     }
+  }
+  return res;
+}
+
+static s32_t spiffs_page_consistency_check_i(spiffs *fs) {
+  const u32_t bits = 4;
+  const spiffs_page_ix pages_per_scan = SPIFFS_CFG_LOG_PAGE_SZ(fs) * 8 / bits;
+
+  s32_t res = SPIFFS_OK;
+  spiffs_page_ix pix_offset = 0;
+
+  // for each range of pages fitting into work memory
+  while (pix_offset < SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count) {
+    // set this flag to abort all checks and rescan the page range
+    u8_t restart = 0;
+    memset(fs->work, 0, SPIFFS_CFG_LOG_PAGE_SZ(fs));
+
+    spiffs_block_ix cur_block = 0;
+    // build consistency bitmap for id range traversing all blocks
+    while (!restart && cur_block < fs->block_count) {
+      res = spiffs_page_check_block(fs, pix_offset, cur_block, &restart);
+      SPIFFS_CHECK_RES(res);
+      // next block
+      cur_block++;
+    }
+    // check consistency bitmap
+    if (!restart) {
+      res = spiffs_page_check_bitmap(fs, pix_offset, &restart);
+      SPIFFS_CHECK_RES(res);
+    }
 
     SPIFFS_CHECK_DBG("PA: processed "_SPIPRIpg", restart "_SPIPRIi"\n", pix_offset, restart);
     // next page range
@@ -992,4 +1248,139 @@ s32_t spiffs_object_index_consistency_check(spiffs *fs) {
   return res;
 }
 
+#if SPIFFS_INCREMENTAL_CHECK
+//---------------------------------------
+// Incremental check
+
+// The passes above, one block per slice. Between slices other callers may
+// change the file system, which is noticed by the allocation counters and
+// the free cursor: any page written, deleted or erased moves one of them.
+// The object id table of the index pass and the bitmap of the page pass
+// are then filled afresh.
+
+static void spiffs_check_stamp(spiffs *fs, u32_t *stamp) {
+  stamp[0] = fs->stats_p_allocated;
+  stamp[1] = fs->stats_p_deleted;
+  stamp[2] = (fs->free_cursor_block_ix << 16) ^ fs->free_cursor_obj_lu_entry;
+}
+
+static s32_t spiffs_lookup_check_block_v(spiffs *fs, spiffs_obj_id obj_id, spiffs_block_ix cur_block,
+    int cur_entry, const void *user_const_p, void *user_var_p) {
+  if (cur_block != *(const spiffs_block_ix *)user_const_p) {
+    return SPIFFS_VIS_END;
+  }
+  return spiffs_lookup_check_v(fs, obj_id, cur_block, cur_entry, 0, user_var_p);
+}
+
+static s32_t spiffs_object_index_check_block_v(spiffs *fs, spiffs_obj_id obj_id, spiffs_block_ix cur_block,
+    int cur_entry, const void *user_const_p, void *user_var_p) {
+  if (cur_block != *(const spiffs_block_ix *)user_const_p) {
+    return SPIFFS_VIS_END;
+  }
+  return spiffs_object_index_consistency_check_v(fs, obj_id, cur_block, cur_entry, 0, user_var_p);
+}
+
+// Checks the block at the cursor and moves it on. Returns 1 when the last
+// pass is done and the cursor is back at the start.
+s32_t spiffs_check_slice(spiffs *fs, spiffs_check_cursor *c) {
+  const spiffs_page_ix pages_per_scan = SPIFFS_CFG_LOG_PAGE_SZ(fs) * 8 / 4;
+  const u32_t pages = SPIFFS_PAGES_PER_BLOCK(fs) * fs->block_count;
+  s32_t res = SPIFFS_OK;
+  u8_t *work = fs->work;
+  u32_t fixes = fs->stats_check_fixes;
+  u32_t stamp[3];
+  u8_t restart = 0;
+
+  if (c->pass > SPIFFS_CHECK_PAGE || c->block >= fs->block_count || c->pix_offset >= pages) {
+    c->pass = SPIFFS_CHECK_LOOKUP;
+    c->block = 0;
+    c->pix_offset = 0;
+    c->restart = 1;
+  }
+  c->steps++;
+  spiffs_check_stamp(fs, stamp);
+  if (!c->restart && memcmp(stamp, c->stamp, sizeof(stamp)) != 0) {
+    if (c->pass == SPIFFS_CHECK_PAGE && c->block > 0) {
+      c->rescans++;
+    }
+    c->restart = 1;
+  }
+  if (c->restart) {
+    memset(c->work, 0, SPIFFS_CFG_LOG_PAGE_SZ(fs));
+    c->log_ix = 0;
+    if (c->pass == SPIFFS_CHECK_PAGE) {
+      c->block = 0;
+    }
+    c->restart = 0;
+  }
+
+  // the passes keep their tables in fs->work, lend them the cursor's
+  fs->work = c->work;
+  if (c->pass == SPIFFS_CHECK_LOOKUP) {
+    res = spiffs_obj_lu_find_entry_visitor(fs, c->block, 0, SPIFFS_VIS_NO_WRAP, 0,
+        spiffs_lookup_check_block_v, &c->block, 0, 0, 0);
+  } else if (c->pass == SPIFFS_CHECK_INDEX) {
+    res = spiffs_obj_lu_find_entry_visitor(fs, c->block, 0, SPIFFS_VIS_NO_WRAP, 0,
+        spiffs_object_index_check_block_v, &c->block, &c->log_ix, 0, 0);
+  } else {
+    res = spiffs_page_check_block(fs, c->pix_offset, c->block, &restart);
+    if (res == SPIFFS_OK && !restart && c->block == fs->block_count - 1) {
+      res = spiffs_page_check_bitmap(fs, c->pix_offset, &restart);
+    }
+  }
+  fs->work = work;
+  if (res == SPIFFS_VIS_END) {
+    res = SPIFFS_OK;
+  }
+  if (res != SPIFFS_OK) {
+    CHECK_CB(fs, c->pass, SPIFFS_CHECK_ERROR, res, 0);
+    // carry on with the next block, or the next range of pages
+    restart = 0;
+    if (c->pass == SPIFFS_CHECK_PAGE) {
+      c->block = fs->block_count - 1;
+    }
+  }
+
+  if (fs->stats_check_fixes != fixes) {
+    c->fixes++;
+    // as in SPIFFS_check, the fixes move and delete pages behind the
+    // counters' and the indexes' back
+    s32_t scan_res = spiffs_obj_lu_scan(fs);
+#if SPIFFS_NAME_INDEX
+    spiffs_name_ix_clear();
+#endif
+#if SPIFFS_DIR_INDEX
+    spiffs_dir_ix_clear();
+#endif
+    if (res == SPIFFS_OK) {
+      res = scan_res;
+    }
+  }
+  spiffs_check_stamp(fs, c->stamp);
+
+  if (restart) {
+    // a fix in the page pass, scan this range again
+    c->restart = 1;
+    return res;
+  }
+  if (++c->block < fs->block_count) {
+    return res;
+  }
+  c->block = 0;
+  c->restart = 1;
+  if (c->pass == SPIFFS_CHECK_PAGE) {
+    c->pix_offset += pages_per_scan;
+    if (c->pix_offset < pages) {
+      return res;
+    }
+    c->pix_offset = 0;
+    c->pass = SPIFFS_CHECK_LOOKUP;
+    c->cycles++;
+    return res == SPIFFS_OK ? 1 : res;
+  }
+  c->pass++;
+  return res;
+}
+#endif // SPIFFS_INCREMENTAL_CHECK
+
 #endif // !SPIFFS_READ_ONLY
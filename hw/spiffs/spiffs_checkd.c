@@ -0,0 +1,147 @@
+/*
+ * Background consistency check.
+ *
+ * SPIFFS_check reads every page header once per 512 pages, over two
+ * minutes on the 8M partition with the lock held throughout, so it was
+ * never run.  This task runs the same checks one block per
+ * SPIFFS_check_step(), holding the lock for a few tens of
+ * milliseconds, and sleeps after each step to keep its share of the
+ * time at CHECKD_DUTY percent.  A whole check then takes about ten
+ * minutes, after which it starts over.
+ *
+ * The cursor is saved to the settings every CHECKD_SAVE_MS and after
+ * each whole check, so a reboot only repeats the last minute's work.
+ * Only the position is kept; the page range in progress starts over.
+ */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "settings.h"
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "spiffs_port.h"
+#include "spiffs_checkd.h"
+
+#define CHECKD_START_MS		30000	/* Leave the boot alone */
+#define CHECKD_PERIOD_MS	10	/* Least sleep between steps */
+#define CHECKD_DUTY		25	/* Percent of time */
+#define CHECKD_SAVE_MS		60000
+#define CHECKD_STACK		512
+
+/* In SETTING_CHECK_CURSOR */
+struct checkd_saved {
+	uint32_t	pass;
+	uint32_t	block;
+	uint32_t	pix_offset;
+	uint32_t	cycles;
+};
+
+static TaskHandle_t checkd_task;
+static spiffs_check_cursor cur;
+static uint32_t work[SPIFFS_CFG_LOG_PAGE_SZ(&spiffs_fs) / 4];
+static struct spiffs_checkd_stats stats;
+
+/* Out of range values are put back to the start by the first step */
+static void
+checkd_restore(void)
+{
+	struct checkd_saved s;
+
+	if (settings_get(SETTING_CHECK_CURSOR, SETTINGS_BLOB, &s,
+	    sizeof(s)) != sizeof(s))
+		return;
+	cur.pass = s.pass;
+	cur.block = s.block;
+	cur.pix_offset = s.pix_offset;
+	cur.cycles = s.cycles;
+}
+
+static void
+checkd_save(void)
+{
+	struct checkd_saved s;
+
+	s.pass = cur.pass;
+	s.block = cur.block;
+	s.pix_offset = cur.pix_offset;
+	s.cycles = cur.cycles;
+	settings_set(SETTING_CHECK_CURSOR, SETTINGS_BLOB, &s, sizeof(s));
+}
+
+static void
+checkd_main(void *arg)
+{
+	spiffs *fs = &spiffs_fs;
+	TickType_t saved, t0, took;
+	s32_t res;
+
+	(void)arg;
+	vTaskDelay(pdMS_TO_TICKS(CHECKD_START_MS));
+	SPIFFS_check_begin(fs, &cur, work);
+	checkd_restore();
+	saved = xTaskGetTickCount();
+	for (;;) {
+		if (!SPIFFS_mounted(fs)) {
+			vTaskDelay(pdMS_TO_TICKS(CHECKD_START_MS));
+			continue;
+		}
+		t0 = xTaskGetTickCount();
+		res = SPIFFS_check_step(fs, &cur);
+		took = (xTaskGetTickCount() - t0) * portTICK_PERIOD_MS;
+
+		taskENTER_CRITICAL();
+		stats.cycles = cur.cycles;
+		stats.steps = cur.steps;
+		stats.fixes = cur.fixes;
+		stats.rescans = cur.rescans;
+		if (res < 0)
+			stats.errors++;
+		stats.busy_ms += took;
+		if (took > stats.max_step_ms)
+			stats.max_step_ms = took;
+		stats.progress = SPIFFS_check_progress(fs, &cur);
+		taskEXIT_CRITICAL();
+
+		if (res == 1 || xTaskGetTickCount() - saved >=
+		    pdMS_TO_TICKS(CHECKD_SAVE_MS)) {
+			checkd_save();
+			saved = xTaskGetTickCount();
+		}
+		vTaskDelay(pdMS_TO_TICKS(CHECKD_PERIOD_MS +
+		    took * (100 - CHECKD_DUTY) / CHECKD_DUTY));
+	}
+}
+
+void
+spiffs_checkd_start(void)
+{
+	if (checkd_task == NULL)
+		xTaskCreate(checkd_main, "fsck", CHECKD_STACK, NULL,
+		    tskIDLE_PRIORITY, &checkd_task);
+}
+
+void
+spiffs_checkd_stats(struct spiffs_checkd_stats *st)
+{
+	taskENTER_CRITICAL();
+	*st = stats;
+	taskEXIT_CRITICAL();
+}
+
+int
+spiffs_checkd_report(char *buf, size_t len)
+{
+	struct spiffs_checkd_stats st;
+
+	spiffs_checkd_stats(&st);
+	return snprintf(buf, len, "spiffs check: %lu.%lu%% of #%lu, %lu steps "
+	    "%lu ms (max %lu), %lu fixes, %lu rescans, %lu errors\n",
+	    (unsigned long)st.progress / 10, (unsigned long)st.progress % 10,
+	    (unsigned long)st.cycles + 1, (unsigned long)st.steps,
+	    (unsigned long)st.busy_ms, (unsigned long)st.max_step_ms,
+	    (unsigned long)st.fixes, (unsigned long)st.rescans,
+	    (unsigned long)st.errors);
+}
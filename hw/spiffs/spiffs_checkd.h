@@ -0,0 +1,32 @@
+#ifndef _SPIFFS_CHECKD_H_
+#define _SPIFFS_CHECKD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Background consistency check of spiffs_fs.  An idle priority task runs
+ * SPIFFS_check_step() over and over within a duty cycle, so the whole
+ * file system is checked and mended again and again without stopping
+ * anything.  Where it is survives a reboot in the settings.
+ */
+
+struct spiffs_checkd_stats {
+	uint32_t	cycles;		/* Whole checks completed */
+	uint32_t	steps;
+	uint32_t	fixes;		/* Steps that mended something */
+	uint32_t	rescans;	/* Page ranges started over */
+	uint32_t	errors;
+	uint32_t	busy_ms;	/* Time spent in steps */
+	uint32_t	max_step_ms;	/* Longest step, the worst lock hold */
+	uint32_t	progress;	/* Of the current check, in thousandths */
+};
+
+void spiffs_checkd_start(void);
+
+void spiffs_checkd_stats(struct spiffs_checkd_stats *);
+
+/* Formats the statistics as one line of text */
+int spiffs_checkd_report(char *buf, size_t len);
+
+#endif
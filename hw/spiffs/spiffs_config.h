@@ -12,8 +12,11 @@
 // Following includes are for the linux test build of spiffs
 // These may/should/must be removed/altered/replaced in your target
 //#include "params_test.h"
+#ifndef SFLASH_EMU	/* Host builds on the flash emulator have no RTOS */
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "task.h"
+#endif
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -21,6 +24,7 @@
 #include <stddef.h>
 #include <unistd.h>
 // ----------- >8 ------------
+#include "flash_part.h"
 
 typedef uint8_t		u8_t;
 typedef int8_t		s8_t;
@@ -105,6 +109,18 @@ typedef int32_t		s32_t;
 #ifndef  SPIFFS_CACHE_STATS
 #define SPIFFS_CACHE_STATS              1
 #endif
+
+// Enables segmented LRU replacement for read cache pages. Pages are read in
+// on probation and only move to the protected segment when used again later,
+// so a large sequential read recycles the probationary pages instead of
+// flushing the lookup and index pages everything else keeps coming back to.
+#ifndef  SPIFFS_CACHE_SLRU
+#define SPIFFS_CACHE_SLRU               1
+#endif
+// Number of pages kept for probation out of a cache of n pages
+#ifndef  SPIFFS_CACHE_PROBATION
+#define SPIFFS_CACHE_PROBATION(n)       ((n) / 4 > 0 ? (n) / 4 : 1)
+#endif
 #endif
 
 // Always check header of each accessed page to ensure consistent state.
@@ -118,6 +134,12 @@ typedef int32_t		s32_t;
 #define SPIFFS_GC_MAX_RUNS              5
 #endif
 
+// Most pages SPIFFS_gc_step writes in one call, which bounds how long it
+// holds the file system lock.
+#ifndef SPIFFS_GC_STEP_MOVES
+#define SPIFFS_GC_STEP_MOVES            8
+#endif
+
 // Enable/disable statistics on gc. Debug/test purpose only.
 #ifndef SPIFFS_GC_STATS
 #define SPIFFS_GC_STATS                 1
@@ -213,7 +235,14 @@ struct MTP_MetaData {
 // SPIFFS_LOCK and SPIFFS_UNLOCK protects spiffs from reentrancy on api level
 // These should be defined on a multithreaded system
 
+#ifdef SFLASH_EMU
+#ifndef SPIFFS_LOCK
+#define SPIFFS_LOCK(fs)
+#define SPIFFS_UNLOCK(fs)
+#endif
+#else
 extern SemaphoreHandle_t SPIFFS_Mutex;
+#endif
 // define this to enter a mutex if you're running on a multithreaded system
 #ifndef SPIFFS_LOCK
 #define SPIFFS_LOCK(fs) xSemaphoreTake(SPIFFS_Mutex, portMAX_DELAY);
@@ -234,13 +263,13 @@ extern SemaphoreHandle_t SPIFFS_Mutex;
 // Instead of giving parameters in config struct, singleton build must
 // give parameters in defines below.
 #ifndef SPIFFS_CFG_PHYS_SZ
-#define SPIFFS_CFG_PHYS_SZ(ignore)        (1024*1024*15)
+#define SPIFFS_CFG_PHYS_SZ(ignore)        (FLASH_PART_SPIFFS_SIZE)
 #endif
 #ifndef SPIFFS_CFG_PHYS_ERASE_SZ
 #define SPIFFS_CFG_PHYS_ERASE_SZ(ignore)  (65536)
 #endif
 #ifndef SPIFFS_CFG_PHYS_ADDR
-#define SPIFFS_CFG_PHYS_ADDR(ignore)      (0x100000)
+#define SPIFFS_CFG_PHYS_ADDR(ignore)      (FLASH_PART_SPIFFS_ADDR)
 #endif
 #ifndef SPIFFS_CFG_LOG_PAGE_SZ
 #define SPIFFS_CFG_LOG_PAGE_SZ(ignore)    (256)
@@ -331,6 +360,121 @@ extern SemaphoreHandle_t SPIFFS_Mutex;
 #define SPIFFS_IX_MAP                         1
 #endif
 
+// Enable this to map the index of a file automatically when it is seeked
+// in and is larger than SPIFFS_IX_MAP_AUTO_MIN(fs) bytes, by default what
+// its index header covers. The maps come from a pool of
+// SPIFFS_IX_MAP_AUTO_MAPS maps of SPIFFS_IX_MAP_AUTO_ENTRIES pages each, 2
+// bytes a page; the least recently used map is taken from its file when
+// the pool runs out. A file larger than a map remaps on seeks outside
+// it, which costs a lookup scan; 4096 pages covers 1MB with 256 byte
+// pages. See spiffs_ix_auto.c.
+#if SPIFFS_IX_MAP
+#ifndef SPIFFS_IX_MAP_AUTO
+#define SPIFFS_IX_MAP_AUTO                    1
+#endif
+#ifndef SPIFFS_IX_MAP_AUTO_MAPS
+#define SPIFFS_IX_MAP_AUTO_MAPS               2
+#endif
+#ifndef SPIFFS_IX_MAP_AUTO_ENTRIES
+#define SPIFFS_IX_MAP_AUTO_ENTRIES            4096
+#endif
+#ifndef SPIFFS_IX_MAP_AUTO_MIN
+#define SPIFFS_IX_MAP_AUTO_MIN(fs) \
+  (SPIFFS_OBJ_HDR_IX_LEN(fs) * SPIFFS_DATA_PAGE_SIZE(fs))
+#endif
+#endif
+
+// Enable this to let SPIFFS_mount skip the object lookup scan when the
+// file system was cleanly unmounted or checkpointed and not written since.
+// The scan result is kept in the FLASH_PART_SPIFFS_SNAP partition, see
+// spiffs_snap.c.
+#ifndef SPIFFS_MOUNT_SNAPSHOT
+#define SPIFFS_MOUNT_SNAPSHOT                 1
+#endif
+
+// Enable this to keep a table in RAM from file names to their object index
+// header pages, so opening or stat'ing a file by name reads one header page
+// instead of searching all of them. SPIFFS_NAME_INDEX_SIZE entries of 8
+// bytes each are kept, a multiple of 4; beyond that the least recently used
+// names are dropped and found by searching again; until then a name that is
+// not in the table does not exist. See spiffs_name_ix.c.
+#ifndef SPIFFS_NAME_INDEX
+#define SPIFFS_NAME_INDEX                     1
+#endif
+#ifndef SPIFFS_NAME_INDEX_SIZE
+#define SPIFFS_NAME_INDEX_SIZE                128
+#endif
+
+// Enable this to keep the folders described by MTP_MetaData.parent in RAM,
+// so SPIFFS_dir_list reads no headers. SPIFFS_DIR_INDEX_SIZE objects of 14
+// bytes each are kept, a multiple of 4; with more files than that, listing
+// searches the flash until the next mount. See spiffs_dir_ix.c.
+#if SPIFFS_OBJ_META_LEN
+#ifndef SPIFFS_DIR_INDEX
+#define SPIFFS_DIR_INDEX                      1
+#endif
+#ifndef SPIFFS_DIR_INDEX_SIZE
+#define SPIFFS_DIR_INDEX_SIZE                 256
+#endif
+#endif
+
+// Enable this to program a new data page's header and data with one HAL
+// write instead of two. The page is finalized by a separate write as
+// before. Costs SPIFFS_COPY_BUFFER_STACK bytes of stack in
+// spiffs_page_allocate_data.
+#ifndef SPIFFS_MERGE_DATA_WRITES
+#define SPIFFS_MERGE_DATA_WRITES              1
+#endif
+
+// Enable this for SPIFFS_read_extents and SPIFFS_read_stream, which let
+// consumers read file data straight from flash instead of through the
+// cache and a copy.
+#ifndef SPIFFS_READ_EXTENTS
+#define SPIFFS_READ_EXTENTS                   1
+#endif
+// A write that needs a garbage collection while extents are pinned waits
+// up to SPIFFS_PINNED_WAIT_MS for their release, holding the file system
+// lock, and sleeps SPIFFS_PINNED_SLEEP(ms) between looks. The pin count
+// is changed inside SPIFFS_PINNED_ENTER/EXIT, as SPIFFS_release_extents
+// does without the lock.
+#ifdef SFLASH_EMU
+#ifndef SPIFFS_PINNED_WAIT_MS
+#define SPIFFS_PINNED_WAIT_MS                 0
+#define SPIFFS_PINNED_SLEEP(ms)
+#define SPIFFS_PINNED_ENTER()
+#define SPIFFS_PINNED_EXIT()
+#endif
+#endif
+#ifndef SPIFFS_PINNED_WAIT_MS
+#define SPIFFS_PINNED_WAIT_MS                 1000
+#endif
+#ifndef SPIFFS_PINNED_SLEEP
+#define SPIFFS_PINNED_SLEEP(ms)               vTaskDelay(pdMS_TO_TICKS(ms))
+#endif
+#ifndef SPIFFS_PINNED_ENTER
+#define SPIFFS_PINNED_ENTER()                 taskENTER_CRITICAL()
+#define SPIFFS_PINNED_EXIT()                  taskEXIT_CRITICAL()
+#endif
+
+// Enable this for SPIFFS_check_step, which runs the consistency checks of
+// SPIFFS_check one block at a time so a background task can keep checking
+// without holding the file system lock for long. See spiffs_check.c.
+#ifndef SPIFFS_INCREMENTAL_CHECK
+#define SPIFFS_INCREMENTAL_CHECK              1
+#endif
+
+// Enable this to count the erases of every block, kept in the
+// FLASH_PART_SPIFFS_WEAR partition, for SPIFFS_wear_stats and for
+// SPIFFS_wear_level_step, which moves static data off little worn blocks.
+// Up to SPIFFS_WEAR_BLOCKS blocks are counted, 4 bytes of RAM each; with
+// more the counts are unavailable. See spiffs_wear.c.
+#ifndef SPIFFS_WEAR_LEVEL
+#define SPIFFS_WEAR_LEVEL                     1
+#endif
+#ifndef SPIFFS_WEAR_BLOCKS
+#define SPIFFS_WEAR_BLOCKS                    128
+#endif
+
 // Set SPIFFS_TEST_VISUALISATION to non-zero to enable SPIFFS_vis function
 // in the api. This function will visualize all filesystem using given printf
 // function.
@@ -0,0 +1,479 @@
+/*
+ * Directory index: folders on top of the flat file system, as MTP keeps
+ * them.  A folder is an object of format association and every object's
+ * MTP_MetaData.parent holds the object id of its folder, 0 for the root.
+ * An object without metadata is in the root.
+ *
+ * The index keeps a node per object with its folder, its index header
+ * page and, for a folder, a list of what is in it, so listing a folder
+ * costs the number of children instead of a read of every header in the
+ * file system.  It is filled by the first listing or lookup after mount,
+ * so mounting reads no headers, and kept up to date through the object
+ * index events.  An object whose folder is gone is in no list until a
+ * folder with that id shows up again.
+ *
+ * The node table holds SPIFFS_DIR_INDEX_SIZE objects.  Past that the
+ * index stops being complete and listings search the flash until the
+ * next mount.
+ */
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+
+#if SPIFFS_DIR_INDEX
+
+#define DIR_NONE		0xffff
+#define DIR_BUCKETS		(SPIFFS_DIR_INDEX_SIZE / 4)
+#define DIR_HASH(id)		((id) % DIR_BUCKETS)
+#define DIR_LOST		SPIFFS_OBJ_ID_FREE	/* Parent no id can be */
+
+#define MTP_FMT_ASSOCIATION	0x3001
+
+struct dir_node {
+	spiffs_obj_id	obj_id;		/* Without the index flag */
+	spiffs_obj_id	parent;		/* 0 for the root */
+	spiffs_page_ix	pix;		/* Object index header page */
+	u16_t		child;		/* First object in a folder */
+	u16_t		sibling;	/* Next in the folder, or free node */
+	u16_t		hnext;		/* Next in the hash chain */
+	u8_t		folder;
+	u8_t		linked;		/* In its folder's list */
+};
+
+/* There is only the one file system */
+static struct dir_node dir_nodes[SPIFFS_DIR_INDEX_SIZE];
+static u16_t dir_hash[DIR_BUCKETS];
+static u16_t dir_root;		/* Objects in the root */
+static u16_t dir_free;
+static u8_t dir_lost;		/* An object did not fit, search instead */
+static u8_t dir_built;		/* Else filled by the next listing */
+
+struct dir_list {
+	spiffs_obj_id	parent;
+	spiffs_obj_id	*ids;
+	u32_t		max;
+	u32_t		n;
+};
+
+static void
+meta_of(const spiffs_page_object_ix_header *hdr, spiffs_obj_id *parent,
+    u8_t *folder)
+{
+	const struct MTP_MetaData *m = (const void *)hdr->meta;
+
+	if (m->parent == 0xffffffff)
+		*parent = 0;		/* No metadata */
+	else if (m->parent >= SPIFFS_OBJ_ID_IX_FLAG)
+		*parent = DIR_LOST;
+	else
+		*parent = m->parent;
+	*folder = m->obj_fmt == MTP_FMT_ASSOCIATION;
+}
+
+static int
+is_header(const spiffs_page_object_ix_header *hdr)
+{
+	return hdr->p_hdr.span_ix == 0 &&
+	    (hdr->p_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_FINAL |
+	    SPIFFS_PH_FLAG_IXDELE)) ==
+	    (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_IXDELE);
+}
+
+static u16_t
+node_find(spiffs_obj_id obj_id)
+{
+	u16_t n;
+
+	for (n = dir_hash[DIR_HASH(obj_id)]; n != DIR_NONE;
+	    n = dir_nodes[n].hnext)
+		if (dir_nodes[n].obj_id == obj_id)
+			return n;
+	return DIR_NONE;
+}
+
+/* The list of folder "parent", or 0 if it is not a folder we know. */
+static u16_t *
+list_of(spiffs_obj_id parent)
+{
+	u16_t n;
+
+	if (parent == 0)
+		return &dir_root;
+	n = node_find(parent);
+	return n != DIR_NONE && dir_nodes[n].folder ? &dir_nodes[n].child : 0;
+}
+
+static void
+node_link(u16_t n)
+{
+	u16_t *head = list_of(dir_nodes[n].parent);
+
+	if (head == 0)
+		return;
+	dir_nodes[n].sibling = *head;
+	*head = n;
+	dir_nodes[n].linked = 1;
+}
+
+static void
+node_unlink(u16_t n)
+{
+	u16_t *p;
+
+	if (!dir_nodes[n].linked)
+		return;
+	for (p = list_of(dir_nodes[n].parent); *p != n;
+	    p = &dir_nodes[*p].sibling)
+		;
+	*p = dir_nodes[n].sibling;
+	dir_nodes[n].linked = 0;
+}
+
+/* What was in folder "n" is lost until the folder comes back. */
+static void
+node_orphan(u16_t n)
+{
+	u16_t c, next;
+
+	for (c = dir_nodes[n].child; c != DIR_NONE; c = next) {
+		next = dir_nodes[c].sibling;
+		dir_nodes[c].linked = 0;
+	}
+	dir_nodes[n].child = DIR_NONE;
+}
+
+/* Takes the lost objects that belong in new folder "n". */
+static void
+node_adopt(u16_t n)
+{
+	u16_t i;
+
+	for (i = 0; i < SPIFFS_DIR_INDEX_SIZE; i++)
+		if (i != n && dir_nodes[i].obj_id != SPIFFS_OBJ_ID_DELETED &&
+		    !dir_nodes[i].linked &&
+		    dir_nodes[i].parent == dir_nodes[n].obj_id)
+			node_link(i);
+}
+
+static void
+node_set(spiffs_obj_id obj_id, spiffs_obj_id parent, u8_t folder,
+    spiffs_page_ix pix)
+{
+	u16_t n = node_find(obj_id);
+	struct dir_node *d;
+
+	if (n == DIR_NONE) {
+		if (dir_free == DIR_NONE) {
+			dir_lost = 1;
+			return;
+		}
+		n = dir_free;
+		d = &dir_nodes[n];
+		dir_free = d->sibling;
+		d->obj_id = obj_id;
+		d->hnext = dir_hash[DIR_HASH(obj_id)];
+		dir_hash[DIR_HASH(obj_id)] = n;
+		d->child = DIR_NONE;
+		d->linked = 0;
+		d->folder = 0;
+	} else {
+		d = &dir_nodes[n];
+		if (d->parent == parent && d->folder == folder && d->linked) {
+			d->pix = pix;
+			return;
+		}
+		node_unlink(n);
+		if (d->folder && !folder)
+			node_orphan(n);
+	}
+	d->pix = pix;
+	d->parent = parent;
+	node_link(n);
+	if (folder && !d->folder) {
+		d->folder = 1;
+		node_adopt(n);
+	}
+	d->folder = folder;
+}
+
+static void
+node_remove(spiffs_obj_id obj_id)
+{
+	u16_t n = node_find(obj_id), *p;
+
+	if (n == DIR_NONE)
+		return;
+	node_unlink(n);
+	if (dir_nodes[n].folder)
+		node_orphan(n);
+	for (p = &dir_hash[DIR_HASH(obj_id)]; *p != n;
+	    p = &dir_nodes[*p].hnext)
+		;
+	*p = dir_nodes[n].hnext;
+	dir_nodes[n].obj_id = SPIFFS_OBJ_ID_DELETED;
+	dir_nodes[n].sibling = dir_free;
+	dir_free = n;
+}
+
+/* Empties the index, the next listing or lookup fills it again. */
+void
+spiffs_dir_ix_clear(void)
+{
+	u16_t n;
+
+	for (n = 0; n < DIR_BUCKETS; n++)
+		dir_hash[n] = DIR_NONE;
+	for (n = 0; n < SPIFFS_DIR_INDEX_SIZE; n++) {
+		dir_nodes[n].obj_id = SPIFFS_OBJ_ID_DELETED;
+		dir_nodes[n].sibling = n + 1 < SPIFFS_DIR_INDEX_SIZE ?
+		    n + 1 : DIR_NONE;
+	}
+	dir_free = 0;
+	dir_root = DIR_NONE;
+	dir_lost = 0;
+	dir_built = 0;
+}
+
+static s32_t
+read_hdr(spiffs *fs, spiffs_page_ix pix, spiffs_page_object_ix_header *hdr)
+{
+	return _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ, 0,
+	    SPIFFS_PAGE_TO_PADDR(fs, pix), sizeof(*hdr), (u8_t *)hdr);
+}
+
+/* Reads the index header of object "obj_id", through the index if it can. */
+static s32_t
+hdr_by_id(spiffs *fs, spiffs_obj_id obj_id, spiffs_page_object_ix_header *hdr)
+{
+	spiffs_page_ix pix;
+	u16_t n = node_find(obj_id);
+	s32_t res;
+
+	if (n != DIR_NONE) {
+		res = read_hdr(fs, dir_nodes[n].pix, hdr);
+		SPIFFS_CHECK_RES(res);
+		if (hdr->p_hdr.obj_id == (obj_id | SPIFFS_OBJ_ID_IX_FLAG) &&
+		    is_header(hdr))
+			return SPIFFS_OK;
+	}
+	res = spiffs_obj_lu_find_id_and_span(fs, obj_id | SPIFFS_OBJ_ID_IX_FLAG,
+	    0, 0, &pix);
+	SPIFFS_CHECK_RES(res);
+	return read_hdr(fs, pix, hdr);
+}
+
+static s32_t
+build_v(spiffs *fs, spiffs_obj_id obj_id, spiffs_block_ix bix, int ix_entry,
+    const void *user_const_p, void *user_var_p)
+{
+	spiffs_page_object_ix_header hdr;
+	spiffs_page_ix pix = SPIFFS_OBJ_LOOKUP_ENTRY_TO_PIX(fs, bix, ix_entry);
+	spiffs_obj_id parent;
+	u8_t folder;
+	struct dir_list *l = user_var_p;
+	s32_t res;
+
+	if (obj_id == SPIFFS_OBJ_ID_FREE || obj_id == SPIFFS_OBJ_ID_DELETED ||
+	    (obj_id & SPIFFS_OBJ_ID_IX_FLAG) == 0)
+		return SPIFFS_VIS_COUNTINUE;
+	res = read_hdr(fs, pix, &hdr);
+	SPIFFS_CHECK_RES(res);
+	if (!is_header(&hdr))
+		return SPIFFS_VIS_COUNTINUE;
+	meta_of(&hdr, &parent, &folder);
+	obj_id &= ~SPIFFS_OBJ_ID_IX_FLAG;
+	if (l == 0) {
+		node_set(obj_id, parent, folder, pix);
+#if SPIFFS_NAME_INDEX
+		if (user_const_p)
+			spiffs_name_ix_add(hdr.name, obj_id, pix);
+#endif
+	} else if (parent == l->parent) {
+		if (l->n < l->max)
+			l->ids[l->n] = obj_id;
+		l->n++;
+	}
+	return SPIFFS_VIS_COUNTINUE;
+}
+
+/*
+ * Fills the index from the index headers on the flash, and the name index
+ * with it if that is empty, so the headers are read only once.
+ */
+s32_t
+spiffs_dir_ix_build(spiffs *fs)
+{
+	const void *names = 0;
+	s32_t res;
+
+	spiffs_dir_ix_clear();
+#if SPIFFS_NAME_INDEX
+	if (spiffs_name_ix_start())
+		names = &names;
+#endif
+	res = spiffs_obj_lu_find_entry_visitor(fs, 0, 0, 0, 0, build_v, names,
+	    0, 0, 0);
+	if (res != SPIFFS_VIS_END) {
+		spiffs_dir_ix_clear();
+#if SPIFFS_NAME_INDEX
+		if (names)
+			spiffs_name_ix_clear();
+#endif
+		return res;
+	}
+	dir_built = 1;
+	return SPIFFS_OK;
+}
+
+/* Follows creates, metadata updates, moves and removals of index headers. */
+void
+spiffs_dir_ix_event(spiffs_page_object_ix *objix, int ev,
+    spiffs_obj_id obj_id, spiffs_span_ix spix, spiffs_page_ix pix)
+{
+	spiffs_obj_id parent;
+	u8_t folder;
+	u16_t n;
+
+	if (!dir_built || spix != 0 || (objix == 0 &&
+	    ev != SPIFFS_EV_IX_MOV && ev != SPIFFS_EV_IX_DEL))
+		return;
+	obj_id &= ~SPIFFS_OBJ_ID_IX_FLAG;
+	switch (ev) {
+	case SPIFFS_EV_IX_NEW:
+	case SPIFFS_EV_IX_UPD:
+	case SPIFFS_EV_IX_UPD_HDR:
+		/* A header with its metadata, which may have changed */
+		meta_of((spiffs_page_object_ix_header *)objix, &parent,
+		    &folder);
+		node_set(obj_id, parent, folder, pix);
+		break;
+	case SPIFFS_EV_IX_MOV:
+		/* Only the page header is passed along */
+		if ((n = node_find(obj_id)) != DIR_NONE)
+			dir_nodes[n].pix = pix;
+		break;
+	case SPIFFS_EV_IX_DEL:
+		/* Not for a stale copy of the header that gc wipes */
+		if ((n = node_find(obj_id)) != DIR_NONE &&
+		    dir_nodes[n].pix == pix)
+			node_remove(obj_id);
+		break;
+	}
+}
+
+/*
+ * Fills "ids" with up to "max" objects in folder "parent" and returns
+ * how many there are in all.
+ */
+s32_t
+spiffs_dir_ix_list(spiffs *fs, spiffs_obj_id parent, spiffs_obj_id *ids,
+    u32_t max)
+{
+	spiffs_page_object_ix_header hdr;
+	struct dir_list l;
+	spiffs_obj_id p;
+	u8_t folder;
+	u16_t *head, n;
+	s32_t res;
+
+	if (!dir_built)
+		(void)spiffs_dir_ix_build(fs);
+	if (dir_built && !dir_lost) {
+		if ((head = list_of(parent)) == 0)
+			return node_find(parent) == DIR_NONE ?
+			    SPIFFS_ERR_NOT_FOUND : SPIFFS_ERR_NOT_A_FOLDER;
+		l.n = 0;
+		for (n = *head; n != DIR_NONE; n = dir_nodes[n].sibling) {
+			if (l.n < max)
+				ids[l.n] = dir_nodes[n].obj_id;
+			l.n++;
+		}
+		return l.n;
+	}
+
+	/* Incomplete, search the headers */
+	if (parent != 0) {
+		res = hdr_by_id(fs, parent, &hdr);
+		SPIFFS_CHECK_RES(res);
+		meta_of(&hdr, &p, &folder);
+		if (!folder)
+			return SPIFFS_ERR_NOT_A_FOLDER;
+	}
+	l.parent = parent;
+	l.ids = ids;
+	l.max = max;
+	l.n = 0;
+	res = spiffs_obj_lu_find_entry_visitor(fs, 0, 0, 0, 0, build_v, 0, &l,
+	    0, 0);
+	if (res != SPIFFS_VIS_END)
+		return res;
+	return l.n;
+}
+
+/* Start of the last name in "path" before "end", which is moved past it. */
+static const char *
+last_name(const char *path, const char **end)
+{
+	const char *s;
+
+	while (*end > path && (*end)[-1] == '/')
+		(*end)--;
+	for (s = *end; s > path && s[-1] != '/'; s--)
+		;
+	return s;
+}
+
+static int
+name_is(const spiffs_page_object_ix_header *hdr, const char *s, size_t len)
+{
+	return len < SPIFFS_OBJ_NAME_LEN && hdr->name[len] == 0 &&
+	    strncmp((const char *)hdr->name, s, len) == 0;
+}
+
+/*
+ * Finds the object at "path", folder names from the root down separated
+ * by '/'.  Names are unique in the file system, so the object is found
+ * by its own name and only the folders above it are checked.
+ */
+s32_t
+spiffs_dir_ix_lookup(spiffs *fs, const char *path, spiffs_obj_id *obj_id)
+{
+	spiffs_page_object_ix_header hdr;
+	u8_t name[SPIFFS_OBJ_NAME_LEN];
+	const char *end = path + strlen(path), *s;
+	spiffs_page_ix pix;
+	spiffs_obj_id parent;
+	u8_t folder;
+	s32_t res;
+
+	if (!dir_built)
+		(void)spiffs_dir_ix_build(fs);
+	s = last_name(path, &end);
+	if (s == end) {
+		*obj_id = 0;
+		return SPIFFS_OK;
+	}
+	if (end - s >= SPIFFS_OBJ_NAME_LEN)
+		return SPIFFS_ERR_NAME_TOO_LONG;
+	memset(name, 0, sizeof(name));
+	memcpy(name, s, end - s);
+	res = spiffs_object_find_object_index_header_by_name(fs, name, &pix);
+	SPIFFS_CHECK_RES(res);
+	res = read_hdr(fs, pix, &hdr);
+	SPIFFS_CHECK_RES(res);
+	*obj_id = hdr.p_hdr.obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
+	meta_of(&hdr, &parent, &folder);
+
+	for (end = s; (s = last_name(path, &end)) != end; end = s) {
+		if (parent == 0 || parent == DIR_LOST)
+			return SPIFFS_ERR_NOT_FOUND;
+		res = hdr_by_id(fs, parent, &hdr);
+		SPIFFS_CHECK_RES(res);
+		meta_of(&hdr, &parent, &folder);
+		if (!folder || !name_is(&hdr, s, end - s))
+			return SPIFFS_ERR_NOT_FOUND;
+	}
+	return parent == 0 ? SPIFFS_OK : SPIFFS_ERR_NOT_FOUND;
+}
+
+#endif /* SPIFFS_DIR_INDEX */
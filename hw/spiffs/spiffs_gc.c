@@ -26,6 +26,42 @@ static s32_t spiffs_gc_erase_block(
   return res;
 }
 
+// Marks an index page as the source of a move before it is copied. If
+// power loss leaves it live next to the finished copy, lookups and the
+// check take the copy.
+static s32_t spiffs_gc_mark_moving(
+    spiffs *fs,
+    spiffs_page_ix pix) {
+  u8_t flags;
+  // a cached page takes the written byte as is, so keep the other flags
+  s32_t res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+      0, SPIFFS_PAGE_TO_PADDR(fs, pix) + offsetof(spiffs_page_header, flags),
+      sizeof(u8_t), &flags);
+  SPIFFS_CHECK_RES(res);
+  flags &= ~SPIFFS_PH_FLAG_MOVING;
+  return _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+      0, SPIFFS_PAGE_TO_PADDR(fs, pix) + offsetof(spiffs_page_header, flags),
+      sizeof(u8_t), &flags);
+}
+
+#if SPIFFS_READ_EXTENTS
+// Waits up to SPIFFS_PINNED_WAIT_MS for the extents handed out to be
+// released, keeping the lock as SPIFFS_release_extents does not need it.
+// Returns SPIFFS_ERR_PINNED if they were not.
+static s32_t spiffs_gc_wait_unpinned(
+    spiffs *fs) {
+  u32_t waited = 0;
+  while (fs->pinned) {
+    if (waited >= SPIFFS_PINNED_WAIT_MS) {
+      return SPIFFS_ERR_PINNED;
+    }
+    SPIFFS_PINNED_SLEEP(10);
+    waited += 10;
+  }
+  return SPIFFS_OK;
+}
+#endif
+
 // Searches for blocks where all entries are deleted - if one is found,
 // the block is erased. Compared to the non-quick gc, the quick one ensures
 // that no updates are needed on existing objects on pages that are erased.
@@ -33,6 +69,10 @@ s32_t spiffs_gc_quick(
     spiffs *fs, u16_t max_free_pages) {
   s32_t res = SPIFFS_OK;
   u32_t blocks = fs->block_count;
+#if SPIFFS_READ_EXTENTS
+  res = spiffs_gc_wait_unpinned(fs);
+  SPIFFS_CHECK_RES(res);
+#endif
   spiffs_block_ix cur_block = 0;
   u32_t cur_block_addr = 0;
   int cur_entry = 0;
@@ -125,6 +165,11 @@ s32_t spiffs_gc_check(
 //    SPIFFS_GC_DBG("gc: full freeblk:"_SPIPRIi" needed:"_SPIPRIi" free:"_SPIPRIi" dele:"_SPIPRIi"\n", fs->free_blocks, needed_pages, free_pages, fs->stats_p_deleted);
 //    return SPIFFS_ERR_FULL;
 //  }
+#if SPIFFS_READ_EXTENTS
+  // extents handed out would be erased
+  res = spiffs_gc_wait_unpinned(fs);
+  SPIFFS_CHECK_RES(res);
+#endif
   if ((s32_t)needed_pages > (s32_t)(free_pages + fs->stats_p_deleted)) {
     SPIFFS_GC_DBG("gc_check: full freeblk:"_SPIPRIi" needed:"_SPIPRIi" free:"_SPIPRIi" dele:"_SPIPRIi"\n", fs->free_blocks, needed_pages, free_pages, fs->stats_p_deleted);
     return SPIFFS_ERR_FULL;
@@ -149,11 +194,12 @@ s32_t spiffs_gc_check(
     }
 #if SPIFFS_GC_STATS
     fs->stats_gc_runs++;
+    fs->stats_gc_sync++;
 #endif
     cand = cands[0];
     fs->cleaning = 1;
     //SPIFFS_GC_DBG("gcing: cleaning block "_SPIPRIi"\n", cand);
-    res = spiffs_gc_clean(fs, cand);
+    res = spiffs_gc_clean(fs, cand, 0);
     fs->cleaning = 0;
     if (res < 0) {
       SPIFFS_GC_DBG("gc_check: cleaning block "_SPIPRIi", result "_SPIPRIi"\n", cand, res);
@@ -195,6 +241,195 @@ s32_t spiffs_gc_check(
   return res;
 }
 
+// Counts the deleted and the free pages in a block, using the lookup work
+// buffer
+static s32_t spiffs_gc_count_pages(
+    spiffs *fs,
+    spiffs_block_ix bix,
+    u32_t *deleted,
+    u32_t *free_pages) {
+  s32_t res = SPIFFS_OK;
+  spiffs_obj_id *obj_lu_buf = (spiffs_obj_id *)fs->lu_work;
+  int entries_per_page = (SPIFFS_CFG_LOG_PAGE_SZ(fs) / sizeof(spiffs_obj_id));
+  int obj_lookup_page;
+  int cur_entry = 0;
+
+  *deleted = 0;
+  *free_pages = 0;
+  for (obj_lookup_page = 0; obj_lookup_page < (int)SPIFFS_OBJ_LOOKUP_PAGES(fs); obj_lookup_page++) {
+    int entry_offset = obj_lookup_page * entries_per_page;
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_READ,
+        0, bix * SPIFFS_CFG_LOG_BLOCK_SZ(fs) + SPIFFS_PAGE_TO_PADDR(fs, obj_lookup_page), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
+    SPIFFS_CHECK_RES(res);
+    while (cur_entry - entry_offset < entries_per_page &&
+        cur_entry < (int)(SPIFFS_PAGES_PER_BLOCK(fs)-SPIFFS_OBJ_LOOKUP_PAGES(fs))) {
+      if (obj_lu_buf[cur_entry-entry_offset] == SPIFFS_OBJ_ID_DELETED) {
+        (*deleted)++;
+      } else if (obj_lu_buf[cur_entry-entry_offset] == SPIFFS_OBJ_ID_FREE) {
+        (*free_pages)++;
+      }
+      cur_entry++;
+    }
+  }
+  return res;
+}
+
+// One bounded unit of garbage collection, for running in the background
+// between other operations. Picks a block holding only deleted pages if
+// there is one, otherwise the best candidate block that has at least
+// min_deleted deleted pages, and remembers it: each call moves at most
+// SPIFFS_GC_STEP_MOVES of its live pages elsewhere, and the call that
+// finds none left erases it. Sets *erased if this call erased a block.
+// Returns SPIFFS_ERR_NO_DELETED_BLOCKS if there was nothing worth doing.
+s32_t spiffs_gc_step(
+    spiffs *fs,
+    u32_t min_deleted,
+    u8_t *erased) {
+  s32_t res;
+  spiffs_block_ix *cands;
+  spiffs_block_ix cand = fs->gc_step_bix;
+  int count;
+  int i;
+  u32_t deleted;
+  u32_t free_pages;
+  const u32_t entries = SPIFFS_PAGES_PER_BLOCK(fs) - SPIFFS_OBJ_LOOKUP_PAGES(fs);
+
+  *erased = 0;
+#if SPIFFS_READ_EXTENTS
+  if (fs->pinned) {
+    // nothing to do now, try later
+    return SPIFFS_ERR_NO_DELETED_BLOCKS;
+  }
+#endif
+  if (cand != (spiffs_block_ix)-1) {
+    res = spiffs_gc_count_pages(fs, cand, &deleted, &free_pages);
+    SPIFFS_CHECK_RES(res);
+    if (deleted == 0) {
+      // erased meanwhile, by a collection inside a write
+      cand = fs->gc_step_bix = (spiffs_block_ix)-1;
+    }
+  }
+  if (cand == (spiffs_block_ix)-1) {
+    res = spiffs_gc_quick(fs, 0);
+    if (res != SPIFFS_ERR_NO_DELETED_BLOCKS) {
+      *erased = res == SPIFFS_OK;
+      return res;
+    }
+    if (fs->free_blocks < 2) {
+      // cleaning needs somewhere to move the live pages to
+      return SPIFFS_ERR_NO_DELETED_BLOCKS;
+    }
+
+    res = spiffs_gc_find_candidate(fs, &cands, &count, 0);
+    SPIFFS_CHECK_RES(res);
+    // only the best few candidates are kept, the count is of all blocks
+    for (i = 0; i < count && cands[i] != (spiffs_block_ix)-1; i++) {
+      res = spiffs_gc_count_pages(fs, cands[i], &deleted, &free_pages);
+      SPIFFS_CHECK_RES(res);
+      if (deleted > 0 && deleted >= min_deleted) {
+        cand = cands[i];
+        break;
+      }
+    }
+    if (cand == (spiffs_block_ix)-1) {
+      return SPIFFS_ERR_NO_DELETED_BLOCKS;
+    }
+    SPIFFS_GC_DBG("gc_step: cleaning block "_SPIPRIbl", "_SPIPRIi" deleted\n", cand, deleted);
+#if SPIFFS_GC_STATS
+    fs->stats_gc_runs++;
+#endif
+    fs->gc_step_bix = cand;
+  }
+
+  if (deleted + free_pages < entries) {
+    fs->cleaning = 1;
+    res = spiffs_gc_clean(fs, cand, SPIFFS_GC_STEP_MOVES);
+    fs->cleaning = 0;
+    return res;
+  }
+
+  SPIFFS_GC_DBG("gc_step: erasing block "_SPIPRIbl"\n", cand);
+  fs->gc_step_bix = (spiffs_block_ix)-1;
+  res = spiffs_gc_erase_page_stats(fs, cand);
+  SPIFFS_CHECK_RES(res);
+  res = spiffs_gc_erase_block(fs, cand);
+  SPIFFS_CHECK_RES(res);
+  *erased = 1;
+  return SPIFFS_OK;
+}
+
+#if SPIFFS_WEAR_LEVEL
+// Static wear levelling: blocks holding data that never changes are never
+// erased, so all the wear lands on the rest. If the most worn free block
+// has been erased more than spread times more than the least worn block
+// in use, the data of the latter is moved onto the former and the block
+// it leaves is erased, to take the writes from now on. Returns SPIFFS_OK
+// if data was moved, SPIFFS_ERR_NO_DELETED_BLOCKS if the spread is within
+// bounds.
+s32_t spiffs_gc_migrate(
+    spiffs *fs,
+    u32_t spread) {
+  s32_t res;
+  spiffs_block_ix bix;
+  spiffs_block_ix hot = (spiffs_block_ix)-1;
+  spiffs_block_ix cold = (spiffs_block_ix)-1;
+  u32_t hot_cnt = 0;
+  u32_t cold_cnt = 0;
+  u32_t cnt;
+  u32_t deleted;
+  u32_t free_pages;
+  const u32_t entries = SPIFFS_PAGES_PER_BLOCK(fs) - SPIFFS_OBJ_LOOKUP_PAGES(fs);
+
+#if SPIFFS_READ_EXTENTS
+  if (fs->pinned) {
+    return SPIFFS_ERR_NO_DELETED_BLOCKS;
+  }
+#endif
+  if (fs->free_blocks < 3) {
+    // leave gc its free blocks
+    return SPIFFS_ERR_NO_DELETED_BLOCKS;
+  }
+
+  for (bix = 0; bix < fs->block_count; bix++) {
+    res = spiffs_wear_count(fs, bix, &cnt);
+    SPIFFS_CHECK_RES(res);
+    res = spiffs_gc_count_pages(fs, bix, &deleted, &free_pages);
+    SPIFFS_CHECK_RES(res);
+    if (free_pages == entries) {
+      if (hot == (spiffs_block_ix)-1 || cnt > hot_cnt) {
+        hot = bix;
+        hot_cnt = cnt;
+      }
+    } else if (cold == (spiffs_block_ix)-1 || cnt < cold_cnt) {
+      cold = bix;
+      cold_cnt = cnt;
+    }
+  }
+  if (hot == (spiffs_block_ix)-1 || cold == (spiffs_block_ix)-1 ||
+      hot_cnt <= cold_cnt + spread) {
+    return SPIFFS_ERR_NO_DELETED_BLOCKS;
+  }
+
+  SPIFFS_GC_DBG("gc_migrate: block "_SPIPRIbl" ("_SPIPRIi" erases) to "_SPIPRIbl" ("_SPIPRIi" erases)\n", cold, cold_cnt, hot, hot_cnt);
+  fs->free_cursor_block_ix = hot;
+  fs->free_cursor_obj_lu_entry = 0;
+  fs->cleaning = 1;
+  res = spiffs_gc_clean(fs, cold, 0);
+  fs->cleaning = 0;
+  SPIFFS_CHECK_RES(res);
+
+  res = spiffs_gc_erase_page_stats(fs, cold);
+  SPIFFS_CHECK_RES(res);
+  res = spiffs_gc_erase_block(fs, cold);
+  SPIFFS_CHECK_RES(res);
+
+  fs->free_cursor_block_ix = cold;
+  fs->free_cursor_obj_lu_entry = 0;
+  fs->stats_wear_moves++;
+  return SPIFFS_OK;
+}
+#endif // SPIFFS_WEAR_LEVEL
+
 // Updates page statistics for a block that is about to be erased
 s32_t spiffs_gc_erase_page_stats(
     spiffs *fs,
@@ -347,6 +582,7 @@ s32_t spiffs_gc_find_candidate(
 typedef enum {
   FIND_OBJ_DATA,
   MOVE_OBJ_DATA,
+  DELETE_OBJ_DATA,
   MOVE_OBJ_IX,
   FINISHED
 } spiffs_gc_clean_state;
@@ -358,6 +594,8 @@ typedef struct {
   spiffs_page_ix cur_objix_pix;
   spiffs_page_ix cur_data_pix;
   int stored_scan_entry_index;
+  // entries from here on were not moved for want of moves, keep them
+  int stop_entry;
   u8_t obj_id_found;
 } spiffs_gc;
 
@@ -368,13 +606,17 @@ typedef struct {
 //   for first found id, check spix and load corresponding object index page to memory
 //   push object scan lookup entry index
 //     rescan object lookup, find data pages with same id and referenced by same object index
-//     move data page, update object index in memory
+//     copy data page, update object index in memory
 //     when reached end of lookup, store updated object index
+//     rescan object lookup, delete the data pages copied
 //   pop object scan lookup entry index
 //   repeat loop until end of object lookup
 //   scan object lookup again for remaining object index pages, move to new page in other block
 //
-s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
+// With max_moves non-zero, stops once that many pages have been written,
+// counting stored object indices; calling again carries on where it left
+// off, as what was moved is deleted from the block.
+s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix, u32_t max_moves) {
   s32_t res = SPIFFS_OK;
   const int entries_per_page = (SPIFFS_CFG_LOG_PAGE_SZ(fs) / sizeof(spiffs_obj_id));
   // this is the global localizer being pushed and popped
@@ -384,6 +626,7 @@ s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
   spiffs_page_ix cur_pix = 0;
   spiffs_page_object_ix_header *objix_hdr = (spiffs_page_object_ix_header *)fs->work;
   spiffs_page_object_ix *objix = (spiffs_page_object_ix *)fs->work;
+  u32_t moves = 0;
 
   SPIFFS_GC_DBG("gc_clean: cleaning block "_SPIPRIbl"\n", bix);
 
@@ -441,40 +684,79 @@ s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
             SPIFFS_GC_DBG("gc_clean: MOVE_DATA found data page "_SPIPRIid":"_SPIPRIsp" @ "_SPIPRIpg"\n", gc.cur_obj_id, p_hdr.span_ix, cur_pix);
             if (SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, p_hdr.span_ix) != gc.cur_objix_spix) {
               SPIFFS_GC_DBG("gc_clean: MOVE_DATA no objix spix match, take in another run\n");
+            } else if (max_moves && moves >= max_moves) {
+              SPIFFS_GC_DBG("gc_clean: MOVE_DATA out of moves, leave the rest\n");
+              gc.stop_entry = cur_entry;
+              scan = 0;
             } else {
               spiffs_page_ix new_data_pix;
+              spiffs_page_ix *ref;
+              if (gc.cur_objix_spix == 0) {
+                ref = &((spiffs_page_ix*)((u8_t *)objix_hdr + sizeof(spiffs_page_object_ix_header)))[p_hdr.span_ix];
+              } else {
+                ref = &((spiffs_page_ix*)((u8_t *)objix + sizeof(spiffs_page_object_ix)))[SPIFFS_OBJ_IX_ENTRY(fs, p_hdr.span_ix)];
+              }
+              if ((p_hdr.flags & SPIFFS_PH_FLAG_DELET) && *ref != cur_pix &&
+                  *ref < SPIFFS_MAX_PAGES(fs)) {
+                // a copy left by power loss, keep whichever the index refers
+                // to unless that one is gone
+                spiffs_page_header ref_hdr;
+                res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+                    0, SPIFFS_PAGE_TO_PADDR(fs, *ref), sizeof(spiffs_page_header), (u8_t*)&ref_hdr);
+                SPIFFS_CHECK_RES(res);
+                if (ref_hdr.obj_id == obj_id && ref_hdr.span_ix == p_hdr.span_ix &&
+                    (ref_hdr.flags & (SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_DELET)) ==
+                    (SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_DELET)) {
+                  p_hdr.flags &= ~SPIFFS_PH_FLAG_DELET;
+                }
+              }
               if (p_hdr.flags & SPIFFS_PH_FLAG_DELET) {
-                // move page
-                res = spiffs_page_move(fs, 0, 0, obj_id, &p_hdr, cur_pix, &new_data_pix);
-                SPIFFS_GC_DBG("gc_clean: MOVE_DATA move objix "_SPIPRIid":"_SPIPRIsp" page "_SPIPRIpg" to "_SPIPRIpg"\n", gc.cur_obj_id, p_hdr.span_ix, cur_pix, new_data_pix);
+                // copy page, the original goes once the index is stored
+                res = spiffs_page_copy(fs, 0, 0, obj_id, &p_hdr, cur_pix, &new_data_pix);
+                SPIFFS_GC_DBG("gc_clean: MOVE_DATA copy objix "_SPIPRIid":"_SPIPRIsp" page "_SPIPRIpg" to "_SPIPRIpg"\n", gc.cur_obj_id, p_hdr.span_ix, cur_pix, new_data_pix);
                 SPIFFS_CHECK_RES(res);
-                // move wipes obj_lu, reload it
+                moves++;
+                // copy wipes obj_lu, reload it
                 res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_READ,
                     0, bix * SPIFFS_CFG_LOG_BLOCK_SZ(fs) + SPIFFS_PAGE_TO_PADDR(fs, obj_lookup_page),
                     SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
                 SPIFFS_CHECK_RES(res);
+                // update memory representation of object index page with new data page
+                *ref = new_data_pix;
+                SPIFFS_GC_DBG("gc_clean: MOVE_DATA wrote page "_SPIPRIpg" to objix entry "_SPIPRIsp" in mem\n", new_data_pix, (spiffs_span_ix)SPIFFS_OBJ_IX_ENTRY(fs, p_hdr.span_ix));
               } else {
-                // page is deleted but not deleted in lookup, scrap it -
-                // might seem unnecessary as we will erase this block, but
-                // we might get aborted
+                // page is deleted but not deleted in lookup, or a stale copy,
+                // scrap it - might seem unnecessary as we will erase this
+                // block, but we might get aborted
                 SPIFFS_GC_DBG("gc_clean: MOVE_DATA wipe objix "_SPIPRIid":"_SPIPRIsp" page "_SPIPRIpg"\n", obj_id, p_hdr.span_ix, cur_pix);
                 res = spiffs_page_delete(fs, cur_pix);
                 SPIFFS_CHECK_RES(res);
-                new_data_pix = SPIFFS_OBJ_ID_FREE;
-              }
-              // update memory representation of object index page with new data page
-              if (gc.cur_objix_spix == 0) {
-                // update object index header page
-                ((spiffs_page_ix*)((u8_t *)objix_hdr + sizeof(spiffs_page_object_ix_header)))[p_hdr.span_ix] = new_data_pix;
-                SPIFFS_GC_DBG("gc_clean: MOVE_DATA wrote page "_SPIPRIpg" to objix_hdr entry "_SPIPRIsp" in mem\n", new_data_pix, (spiffs_span_ix)SPIFFS_OBJ_IX_ENTRY(fs, p_hdr.span_ix));
-              } else {
-                // update object index page
-                ((spiffs_page_ix*)((u8_t *)objix + sizeof(spiffs_page_object_ix)))[SPIFFS_OBJ_IX_ENTRY(fs, p_hdr.span_ix)] = new_data_pix;
-                SPIFFS_GC_DBG("gc_clean: MOVE_DATA wrote page "_SPIPRIpg" to objix entry "_SPIPRIsp" in mem\n", new_data_pix, (spiffs_span_ix)SPIFFS_OBJ_IX_ENTRY(fs, p_hdr.span_ix));
+                if (*ref == cur_pix) {
+                  *ref = SPIFFS_OBJ_ID_FREE;
+                }
               }
             }
           }
           break;
+        case DELETE_OBJ_DATA:
+          // delete the data pages copied, now that the stored object index
+          // refers to the copies
+          if (obj_id == gc.cur_obj_id && cur_entry < gc.stop_entry) {
+            spiffs_page_header p_hdr;
+            res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+                0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
+            SPIFFS_CHECK_RES(res);
+            if (SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, p_hdr.span_ix) == gc.cur_objix_spix) {
+              SPIFFS_GC_DBG("gc_clean: DELETE_DATA delete objix "_SPIPRIid":"_SPIPRIsp" page "_SPIPRIpg"\n", obj_id, p_hdr.span_ix, cur_pix);
+              res = spiffs_page_delete(fs, cur_pix);
+              SPIFFS_CHECK_RES(res);
+              res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_READ,
+                  0, bix * SPIFFS_CFG_LOG_BLOCK_SZ(fs) + SPIFFS_PAGE_TO_PADDR(fs, obj_lookup_page),
+                  SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
+              SPIFFS_CHECK_RES(res);
+            }
+          }
+          break;
         case MOVE_OBJ_IX:
           // find and evacuate object index pages
           if (obj_id != SPIFFS_OBJ_ID_DELETED && obj_id != SPIFFS_OBJ_ID_FREE &&
@@ -486,13 +768,22 @@ s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
             res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
                 0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
             SPIFFS_CHECK_RES(res);
-            if (p_hdr.flags & SPIFFS_PH_FLAG_DELET) {
-              // move page
-              res = spiffs_page_move(fs, 0, 0, obj_id, &p_hdr, cur_pix, &new_pix);
+            if (max_moves && moves >= max_moves) {
+              SPIFFS_GC_DBG("gc_clean: MOVE_OBJIX out of moves, leave the rest\n");
+              scan = 0;
+            } else if (p_hdr.flags & SPIFFS_PH_FLAG_DELET) {
+              // move page, through fs->work so the copy is not marked
+              res = spiffs_gc_mark_moving(fs, cur_pix);
+              SPIFFS_CHECK_RES(res);
+              res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+                  0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+              SPIFFS_CHECK_RES(res);
+              res = spiffs_page_move(fs, 0, fs->work, obj_id, 0, cur_pix, &new_pix);
               SPIFFS_GC_DBG("gc_clean: MOVE_OBJIX move objix "_SPIPRIid":"_SPIPRIsp" page "_SPIPRIpg" to "_SPIPRIpg"\n", obj_id, p_hdr.span_ix, cur_pix, new_pix);
               SPIFFS_CHECK_RES(res);
               spiffs_cb_object_event(fs, (spiffs_page_object_ix *)&p_hdr,
                   SPIFFS_EV_IX_MOV, obj_id, p_hdr.span_ix, new_pix, 0);
+              moves++;
               // move wipes obj_lu, reload it
               res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_READ,
                   0, bix * SPIFFS_CFG_LOG_BLOCK_SZ(fs) + SPIFFS_PAGE_TO_PADDR(fs, obj_lookup_page),
@@ -532,6 +823,7 @@ s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
         spiffs_page_ix objix_pix;
         gc.stored_scan_entry_index = cur_entry; // push cursor
         cur_entry = 0; // restart scan from start
+        gc.stop_entry = SPIFFS_PAGES_PER_BLOCK(fs) - SPIFFS_OBJ_LOOKUP_PAGES(fs);
         gc.state = MOVE_OBJ_DATA;
         res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
             0, SPIFFS_PAGE_TO_PADDR(fs, cur_pix), sizeof(spiffs_page_header), (u8_t*)&p_hdr);
@@ -571,8 +863,13 @@ s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
       // data pages belonging to this object index and residing in the block
       // we want to evacuate
       spiffs_page_ix new_objix_pix;
-      gc.state = FIND_OBJ_DATA;
-      cur_entry = gc.stored_scan_entry_index; // pop cursor
+      gc.state = DELETE_OBJ_DATA;
+      cur_entry = 0; // restart entry scan index
+      // the stored copy supersedes the index page, say so before writing
+      // it in case power goes before the old page is deleted
+      res = spiffs_gc_mark_moving(fs, gc.cur_objix_pix);
+      SPIFFS_CHECK_RES(res);
+      moves++;
       if (gc.cur_objix_spix == 0) {
         // store object index header page
         res = spiffs_object_update_index_hdr(fs, 0, gc.cur_obj_id | SPIFFS_OBJ_ID_IX_FLAG, gc.cur_objix_pix, fs->work, 0, 0, 0, &new_objix_pix);
@@ -588,6 +885,10 @@ s32_t spiffs_gc_clean(spiffs *fs, spiffs_block_ix bix) {
       }
     }
     break;
+    case DELETE_OBJ_DATA:
+      gc.state = max_moves && moves >= max_moves ? FINISHED : FIND_OBJ_DATA;
+      cur_entry = gc.stored_scan_entry_index; // pop cursor
+      break;
     case MOVE_OBJ_IX:
       // scanned thru all block, no more object indices found - our work here is done
       gc.state = FINISHED;
@@ -0,0 +1,176 @@
+/*
+ * Background garbage collection.
+ *
+ * Writes collect inline once fewer than four blocks are free, which
+ * can mean several 64K erases inside one SPIFFS_write.  This task wakes
+ * periodically and, while fewer than GCD_FREE_BLOCKS blocks are free,
+ * reclaims blocks with SPIFFS_gc_step() until it is ahead again.
+ * When plenty of blocks are free it still erases blocks that hold only
+ * deleted pages, which costs no page moves, once deleted pages make up
+ * most of the reclaimable space.
+ *
+ * Each step holds the file system lock for one erase, or for moving at
+ * most SPIFFS_GC_STEP_MOVES pages out of the block it is emptying.
+ * After a step the task sleeps long enough to keep its share of the
+ * time at GCD_DUTY percent, and erases are rationed to
+ * GCD_ERASES_PER_MIN with a small burst allowance.
+ *
+ * With nothing to collect the task looks at the wear every
+ * GCD_WEAR_PERIOD_MS, and moves static data off the least worn block
+ * once the erase counts spread further than GCD_WEAR_SPREAD.  A move
+ * costs two erases from the same budget.
+ */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "spiffs_port.h"
+#include "spiffs_gcd.h"
+
+#define GCD_PERIOD_MS		1000
+#define GCD_FREE_BLOCKS		6	/* Writes collect inline below 4 */
+#define GCD_DUTY		25	/* Percent of time while catching up */
+#define GCD_ERASES_PER_MIN	30
+#define GCD_ERASE_BURST		4
+#define GCD_STACK		512
+#define GCD_WEAR_PERIOD_MS	600000
+#define GCD_WEAR_SPREAD		32
+/* A partly deleted block is only worth moving if this much goes away */
+#define GCD_MIN_DELETED		(SPIFFS_PAGES_PER_BLOCK(&spiffs_fs) / 8)
+
+static TaskHandle_t gcd_task;
+static struct spiffs_gcd_stats stats;
+
+static uint32_t
+data_pages(spiffs *fs)
+{
+	return (SPIFFS_PAGES_PER_BLOCK(fs) - SPIFFS_OBJ_LOOKUP_PAGES(fs)) *
+	    (fs->block_count - 2);
+}
+
+/*
+ * Returns the fewest deleted pages a block must have to be collected
+ * now, or 0 if nothing needs collecting.  The counters are read
+ * without the lock; a stale value only shifts the decision one period.
+ */
+static uint32_t
+gcd_need(spiffs *fs)
+{
+	uint32_t deleted = fs->stats_p_deleted;
+	uint32_t used = fs->stats_p_allocated + deleted;
+	uint32_t free = data_pages(fs) > used ? data_pages(fs) - used : 0;
+
+	if (deleted == 0)
+		return 0;
+	if (fs->free_blocks < GCD_FREE_BLOCKS)
+		return GCD_MIN_DELETED;
+	if (deleted > free)
+		/* Only blocks that need no page moves */
+		return SPIFFS_PAGES_PER_BLOCK(fs) - SPIFFS_OBJ_LOOKUP_PAGES(fs);
+	return 0;
+}
+
+static void
+gcd_main(void *arg)
+{
+	spiffs *fs = &spiffs_fs;
+	TickType_t last = xTaskGetTickCount(), now, t0, took;
+	TickType_t wear = last;
+	uint32_t tokens = GCD_ERASE_BURST * 60000, min_deleted;
+	s32_t res;
+
+	(void)arg;
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(GCD_PERIOD_MS));
+		/* Erase tokens, in 1/60000ths to refill every tick */
+		now = xTaskGetTickCount();
+		tokens += (now - last) * portTICK_PERIOD_MS * GCD_ERASES_PER_MIN;
+		if (tokens > GCD_ERASE_BURST * 60000)
+			tokens = GCD_ERASE_BURST * 60000;
+		last = now;
+		if (!SPIFFS_mounted(fs))
+			continue;
+#if SPIFFS_GC_STATS
+		stats.sync_gcs = fs->stats_gc_sync;
+#endif
+		min_deleted = gcd_need(fs);
+		if (min_deleted == 0 && (tokens < 2 * 60000 ||
+		    now - wear < pdMS_TO_TICKS(GCD_WEAR_PERIOD_MS))) {
+			stats.idle_checks++;
+			continue;
+		}
+		if (tokens < 60000) {
+			stats.deferred++;
+			continue;
+		}
+		t0 = xTaskGetTickCount();
+		if (min_deleted == 0) {
+			wear = now;
+			res = SPIFFS_wear_level_step(fs, GCD_WEAR_SPREAD);
+			if (res > 0) {
+				tokens -= 60000;
+				stats.moves++;
+			}
+		} else
+			res = SPIFFS_gc_step(fs, min_deleted);
+		took = (xTaskGetTickCount() - t0) * portTICK_PERIOD_MS;
+		if (res < 0) {
+			stats.errors++;
+			continue;
+		}
+		if (res == 0) {
+			stats.idle_checks++;
+			continue;
+		}
+		if (res == 1 || min_deleted == 0)
+			tokens -= 60000;
+		stats.steps++;
+		stats.busy_ms += took;
+		if (took > stats.max_step_ms)
+			stats.max_step_ms = took;
+		/* Keep to the duty cycle, then look again without waiting */
+		vTaskDelay(pdMS_TO_TICKS(took * (100 - GCD_DUTY) / GCD_DUTY));
+		xTaskNotifyGive(gcd_task);
+	}
+}
+
+void
+spiffs_gcd_start(void)
+{
+	if (gcd_task == NULL)
+		xTaskCreate(gcd_main, "gc", GCD_STACK, NULL, tskIDLE_PRIORITY,
+		    &gcd_task);
+}
+
+void
+spiffs_gcd_kick(void)
+{
+	if (gcd_task != NULL)
+		xTaskNotifyGive(gcd_task);
+}
+
+void
+spiffs_gcd_stats(struct spiffs_gcd_stats *st)
+{
+	taskENTER_CRITICAL();
+	*st = stats;
+	taskEXIT_CRITICAL();
+}
+
+int
+spiffs_gcd_report(char *buf, size_t len)
+{
+	struct spiffs_gcd_stats st;
+
+	spiffs_gcd_stats(&st);
+	return snprintf(buf, len, "spiffs gc: %lu steps %lu ms (max %lu), "
+	    "%lu deferred, %lu errors, %lu inline, %lu wear moves\n",
+	    (unsigned long)st.steps, (unsigned long)st.busy_ms,
+	    (unsigned long)st.max_step_ms, (unsigned long)st.deferred,
+	    (unsigned long)st.errors, (unsigned long)st.sync_gcs,
+	    (unsigned long)st.moves);
+}
@@ -0,0 +1,35 @@
+#ifndef _SPIFFS_GCD_H_
+#define _SPIFFS_GCD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Background garbage collection for spiffs_fs.  An idle priority task
+ * keeps enough blocks free that writes rarely have to collect inline,
+ * within a duty cycle and an erase rate budget.  When idle it also
+ * evens out the wear.
+ */
+
+struct spiffs_gcd_stats {
+	uint32_t	steps;		/* Blocks erased in the background */
+	uint32_t	idle_checks;	/* Wakeups with nothing to do */
+	uint32_t	deferred;	/* Wakeups held back by the erase budget */
+	uint32_t	errors;
+	uint32_t	busy_ms;	/* Time spent in steps */
+	uint32_t	max_step_ms;	/* Longest step, the worst lock hold */
+	uint32_t	sync_gcs;	/* Collections still done inside writes */
+	uint32_t	moves;		/* Static data moved onto worn blocks */
+};
+
+void spiffs_gcd_start(void);
+
+/* Wakes the task early, e.g. after deleting a lot */
+void spiffs_gcd_kick(void);
+
+void spiffs_gcd_stats(struct spiffs_gcd_stats *);
+
+/* Formats the statistics as one line of text */
+int spiffs_gcd_report(char *buf, size_t len);
+
+#endif
@@ -86,6 +86,7 @@ s32_t SPIFFS_mount(spiffs *fs, spiffs_config *config, u8_t *work,
   memcpy(&fs->cfg, config, sizeof(spiffs_config));
   fs->user_data = user_data;
   fs->block_count = SPIFFS_CFG_PHYS_SZ(fs) / SPIFFS_CFG_LOG_BLOCK_SZ(fs);
+  fs->gc_step_bix = (spiffs_block_ix)-1;
   fs->work = &work[0];
   fs->lu_work = &work[SPIFFS_CFG_LOG_PAGE_SZ(fs)];
   memset(fd_space, 0, fd_space_size);
@@ -126,9 +127,29 @@ s32_t SPIFFS_mount(spiffs *fs, spiffs_config *config, u8_t *work,
 
   fs->config_magic = SPIFFS_CONFIG_MAGIC;
 
+#if SPIFFS_MOUNT_SNAPSHOT
+  // a clean snapshot from the last unmount or checkpoint saves the scan
+  res = spiffs_snap_load(fs);
+  if (res != SPIFFS_OK)
+#endif
   res = spiffs_obj_lu_scan(fs);
   SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
 
+#if SPIFFS_WEAR_LEVEL
+  // without the counts only wear levelling is off
+  fs->stats_wear_moves = 0;
+  (void)spiffs_wear_load(fs);
+#endif
+
+  // the indexes are filled by the first lookup, not here, so mounting
+  // reads no headers; they may still hold a file system mounted before
+#if SPIFFS_NAME_INDEX
+  spiffs_name_ix_clear();
+#endif
+#if SPIFFS_DIR_INDEX
+  spiffs_dir_ix_clear();
+#endif
+
   SPIFFS_DBG("page index byte len:         "_SPIPRIi"\n", (u32_t)SPIFFS_CFG_LOG_PAGE_SZ(fs));
   SPIFFS_DBG("object lookup pages:         "_SPIPRIi"\n", (u32_t)SPIFFS_OBJ_LOOKUP_PAGES(fs));
   SPIFFS_DBG("page pages per block:        "_SPIPRIi"\n", (u32_t)SPIFFS_PAGES_PER_BLOCK(fs));
@@ -161,11 +182,123 @@ void SPIFFS_unmount(spiffs *fs) {
       spiffs_fd_return(fs, cur_fd->file_nbr);
     }
   }
+#if SPIFFS_MOUNT_SNAPSHOT
+  (void)spiffs_snap_save(fs);
+#endif
+#if SPIFFS_NAME_INDEX
+  spiffs_name_ix_clear();
+#endif
+#if SPIFFS_DIR_INDEX
+  spiffs_dir_ix_clear();
+#endif
   fs->mounted = 0;
 
   SPIFFS_UNLOCK(fs);
 }
 
+#if SPIFFS_MOUNT_SNAPSHOT
+s32_t SPIFFS_checkpoint(spiffs *fs) {
+  s32_t res;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+#if SPIFFS_CACHE
+  u32_t i;
+  spiffs_fd *fds = (spiffs_fd *)fs->fd_space;
+  for (i = 0; i < fs->fd_count; i++) {
+    spiffs_fd *cur_fd = &fds[i];
+    if (cur_fd->file_nbr != 0) {
+      (void)spiffs_fflush_cache(fs, cur_fd->file_nbr);
+    }
+  }
+#endif
+  res = spiffs_snap_save(fs);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+  SPIFFS_UNLOCK(fs);
+  return res;
+}
+#endif
+
+#if SPIFFS_CACHE
+s32_t SPIFFS_set_cache(spiffs *fs, void *cache, u32_t cache_size) {
+  s32_t res;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+
+  // align cache pointer to 4 byte boundary, as in SPIFFS_mount
+  u8_t ptr_size = sizeof(void*);
+  u8_t addr_lsb = ((u8_t)(intptr_t)cache) & (ptr_size-1);
+  if (addr_lsb) {
+    u8_t *cache_8 = (u8_t *)cache;
+    cache_8 += (ptr_size-addr_lsb);
+    cache = cache_8;
+    cache_size -= (ptr_size-addr_lsb);
+  }
+  if (cache_size & (ptr_size-1)) {
+    cache_size -= (cache_size & (ptr_size-1));
+  }
+  if (cache == 0 ||
+      cache_size < sizeof(spiffs_cache) + SPIFFS_CACHE_PAGE_SIZE(fs)) {
+    SPIFFS_API_CHECK_RES(fs, SPIFFS_ERR_CACHE_TOO_SMALL);
+  }
+
+  SPIFFS_LOCK(fs);
+#if SPIFFS_CACHE_WR
+  u32_t i;
+  spiffs_fd *fds = (spiffs_fd *)fs->fd_space;
+  for (i = 0; i < fs->fd_count; i++) {
+    spiffs_fd *cur_fd = &fds[i];
+    if (cur_fd->file_nbr != 0) {
+      (void)spiffs_fflush_cache(fs, cur_fd->file_nbr);
+    }
+  }
+#endif
+  res = spiffs_cache_drop_all(fs);
+  fs->cache = cache;
+  fs->cache_size = (cache_size > (SPIFFS_CFG_LOG_PAGE_SZ(fs)*32)) ? SPIFFS_CFG_LOG_PAGE_SZ(fs)*32 : cache_size;
+  spiffs_cache_init(fs);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+  SPIFFS_UNLOCK(fs);
+  return res;
+}
+
+#if SPIFFS_CACHE_STATS
+s32_t SPIFFS_cache_stats(spiffs *fs, spiffs_cache_stats *stats, u8_t clear) {
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+  spiffs_cache *cache = spiffs_get_cache(fs);
+  stats->hits = fs->cache_hits;
+  stats->misses = fs->cache_misses;
+  stats->evictions = fs->cache_evictions;
+  stats->write_backs = fs->cache_write_backs;
+  stats->promotions = fs->cache_promotions;
+  stats->pages = cache->cpage_count;
+  stats->pages_used = 0;
+  int i;
+  for (i = 0; i < cache->cpage_count; i++) {
+    if (cache->cpage_use_map & (1<<i)) {
+      stats->pages_used++;
+    }
+  }
+#if SPIFFS_CACHE_SLRU
+  stats->pages_protected = cache->cpage_prot;
+#else
+  stats->pages_protected = 0;
+#endif
+  if (clear) {
+    fs->cache_hits = 0;
+    fs->cache_misses = 0;
+    fs->cache_evictions = 0;
+    fs->cache_write_backs = 0;
+    fs->cache_promotions = 0;
+  }
+  SPIFFS_UNLOCK(fs);
+  return SPIFFS_OK;
+}
+#endif
+#endif
+
 s32_t SPIFFS_errno(spiffs *fs) {
   return fs->err_code;
 }
@@ -418,6 +551,133 @@ s32_t SPIFFS_read(spiffs *fs, spiffs_file fh, void *buf, s32_t len) {
   return res;
 }
 
+#if SPIFFS_READ_EXTENTS
+static s32_t spiffs_read_extents_i(spiffs *fs, spiffs_file fh, s32_t len, spiffs_extent *ext, u32_t n,
+    u8_t check) {
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  spiffs_fd *fd;
+  s32_t res;
+  u32_t filled = 0;
+  u32_t i;
+
+  fh = SPIFFS_FH_UNOFFS(fs, fh);
+  res = spiffs_fd_get(fs, fh, &fd);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+
+  if ((fd->flags & SPIFFS_O_RDONLY) == 0) {
+    res = SPIFFS_ERR_NOT_READABLE;
+    SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+  }
+
+#if SPIFFS_CACHE_WR
+  spiffs_fflush_cache(fs, fh);
+#endif
+
+  if (fd->size == SPIFFS_UNDEFINED_LEN || fd->fdoffset >= fd->size || len <= 0 || n == 0) {
+    SPIFFS_UNLOCK(fs);
+    return 0;
+  }
+  len = MIN(len, (s32_t)(fd->size - fd->fdoffset));
+  res = spiffs_object_read_extents(fd, fd->fdoffset, len, ext, n, &filled, check);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+  for (i = 0; i < filled; i++) {
+    fd->fdoffset += ext[i].len;
+  }
+  if (filled > 0) {
+    SPIFFS_PINNED_ENTER();
+    fs->pinned++;
+    SPIFFS_PINNED_EXIT();
+  }
+
+  SPIFFS_UNLOCK(fs);
+  return filled;
+}
+
+s32_t SPIFFS_read_extents(spiffs *fs, spiffs_file fh, s32_t len, spiffs_extent *ext, u32_t n) {
+  return spiffs_read_extents_i(fs, fh, len, ext, n, 1);
+}
+
+void SPIFFS_release_extents(spiffs *fs) {
+  // without the lock, a write waiting for this may hold it
+  SPIFFS_PINNED_ENTER();
+  if (fs->pinned > 0) {
+    fs->pinned--;
+  }
+  SPIFFS_PINNED_EXIT();
+}
+
+#if SPIFFS_PAGE_CHECK
+static s32_t spiffs_stream_check(const u8_t *hdr, spiffs_span_ix spix) {
+  spiffs_page_header ph;
+  memcpy(&ph, hdr, sizeof(ph));
+  SPIFFS_VALIDATE_DATA(ph, ph.obj_id, spix);
+  return SPIFFS_OK;
+}
+#endif
+
+s32_t SPIFFS_read_stream(spiffs *fs, spiffs_file fh, s32_t len, u8_t *buf, u32_t buf_size,
+    spiffs_sink sink, void *arg) {
+  spiffs_extent ext[8];
+  s32_t res = SPIFFS_OK;
+  s32_t done = 0;
+  s32_t start;
+  s32_t n;
+  s32_t i, j, k;
+
+  if (buf_size < SPIFFS_CFG_LOG_PAGE_SZ(fs)) {
+    return SPIFFS_ERR_INTERNAL;
+  }
+  start = SPIFFS_tell(fs, fh);
+  if (start < SPIFFS_OK) {
+    return start;
+  }
+  while (res == SPIFFS_OK && done < len) {
+    // the page headers come in the same reads as the data and are checked
+    // here, reading them one by one would read every page twice
+    n = spiffs_read_extents_i(fs, fh, len - done, ext, sizeof(ext) / sizeof(ext[0]), 0);
+    if (n <= 0) {
+      res = n;
+      break;
+    }
+    for (i = 0; res == SPIFFS_OK && i < n; i = j) {
+      // take in the following pages while they are next in flash
+      u32_t start = SPIFFS_PAGE_TO_PADDR(fs, SPIFFS_PADDR_TO_PAGE(fs, ext[i].addr));
+      for (j = i + 1; j < n &&
+          ext[j].addr == ext[j - 1].addr + ext[j - 1].len + sizeof(spiffs_page_header) &&
+          ext[j].addr + ext[j].len - start <= buf_size; j++)
+        ;
+      res = SPIFFS_HAL_STREAM_READ(fs, start, ext[j - 1].addr + ext[j - 1].len - start, buf);
+      for (k = i; res == SPIFFS_OK && k < j; k++) {
+#if SPIFFS_PAGE_CHECK
+        res = spiffs_stream_check(buf + SPIFFS_PAGE_TO_PADDR(fs, SPIFFS_PADDR_TO_PAGE(fs, ext[k].addr)) - start,
+            ext[k].span_ix);
+        if (res != SPIFFS_OK) {
+          break;
+        }
+#endif
+        res = sink(arg, buf + ext[k].addr - start, ext[k].len);
+        if (res >= SPIFFS_OK) {
+          done += ext[k].len;
+          res = SPIFFS_OK;
+        }
+      }
+    }
+    SPIFFS_release_extents(fs);
+  }
+  if (res < SPIFFS_OK) {
+    // the offset moved past every extent taken, put it back after the
+    // last one sink accepted so that a retry carries on from there
+    (void)SPIFFS_lseek(fs, fh, start + done, SPIFFS_SEEK_SET);
+    fs->err_code = res;
+    return res;
+  }
+  return done;
+}
+#endif
+
 
 #if !SPIFFS_READ_ONLY
 static s32_t spiffs_hydro_write(spiffs *fs, spiffs_fd *fd, void *buf, u32_t offset, s32_t len) {
@@ -507,6 +767,9 @@ s32_t SPIFFS_write(spiffs *fs, spiffs_file fh, void *buf, s32_t len) {
           res = spiffs_hydro_write(fs, fd,
               spiffs_get_cache_page(fs, spiffs_get_cache(fs), fd->cache_page->ix),
               fd->cache_page->offset, fd->cache_page->size);
+#if SPIFFS_CACHE_STATS
+          fs->cache_write_backs++;
+#endif
           spiffs_cache_fd_release(fs, fd->cache_page);
           SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
         } else {
@@ -553,6 +816,9 @@ s32_t SPIFFS_write(spiffs *fs, spiffs_file fh, void *buf, s32_t len) {
         res = spiffs_hydro_write(fs, fd,
             spiffs_get_cache_page(fs, spiffs_get_cache(fs), fd->cache_page->ix),
             fd->cache_page->offset, fd->cache_page->size);
+#if SPIFFS_CACHE_STATS
+        fs->cache_write_backs++;
+#endif
         spiffs_cache_fd_release(fs, fd->cache_page);
         SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
         // data written below
@@ -605,6 +871,17 @@ s32_t SPIFFS_lseek(spiffs *fs, spiffs_file fh, s32_t offs, int whence) {
 
   spiffs_span_ix data_spix = (offs > 0 ? (offs-1) : 0) / SPIFFS_DATA_PAGE_SIZE(fs);
   spiffs_span_ix objix_spix = SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, data_spix);
+#if SPIFFS_IX_MAP_AUTO
+  // seeking in a large file, map its index around the new offset
+  (void)spiffs_ix_auto(fs, fd, offs);
+#endif
+#if SPIFFS_IX_MAP
+  // reads inside the map need no index page, writes find it if they must
+  if (fd->ix_map && data_spix >= fd->ix_map->start_spix &&
+      data_spix <= fd->ix_map->end_spix) {
+    objix_spix = fd->cursor_objix_spix;
+  }
+#endif
   if (fd->cursor_objix_spix != objix_spix) {
     spiffs_page_ix pix;
     res = spiffs_obj_lu_find_id_and_span(
@@ -790,6 +1067,9 @@ static s32_t spiffs_fflush_cache(spiffs *fs, spiffs_file fh) {
       res = spiffs_hydro_write(fs, fd,
           spiffs_get_cache_page(fs, spiffs_get_cache(fs), fd->cache_page->ix),
           fd->cache_page->offset, fd->cache_page->size);
+#if SPIFFS_CACHE_STATS
+      fs->cache_write_backs++;
+#endif
       if (res < SPIFFS_OK) {
         fs->err_code = res;
       }
@@ -1060,6 +1340,34 @@ s32_t SPIFFS_closedir(spiffs_DIR *d) {
   return 0;
 }
 
+#if SPIFFS_DIR_INDEX
+s32_t SPIFFS_dir_list(spiffs *fs, spiffs_obj_id parent, spiffs_obj_id *ids, u32_t max) {
+  s32_t res;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  res = spiffs_dir_ix_list(fs, parent, ids, max);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+
+  SPIFFS_UNLOCK(fs);
+  return res;
+}
+
+s32_t SPIFFS_dir_lookup(spiffs *fs, const char *path, spiffs_obj_id *obj_id) {
+  s32_t res;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  res = spiffs_dir_ix_lookup(fs, path, obj_id);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+
+  SPIFFS_UNLOCK(fs);
+  return res;
+}
+#endif
+
 s32_t SPIFFS_check(spiffs *fs) {
 #if SPIFFS_READ_ONLY
   (void)fs;
@@ -1078,11 +1386,58 @@ s32_t SPIFFS_check(spiffs *fs) {
 
   res = spiffs_obj_lu_scan(fs);
 
+  // the checks move and delete pages behind the indexes' back
+#if SPIFFS_NAME_INDEX
+  spiffs_name_ix_clear();
+#endif
+#if SPIFFS_DIR_INDEX
+  spiffs_dir_ix_clear();
+#endif
+
+  SPIFFS_UNLOCK(fs);
+  return res;
+#endif // SPIFFS_READ_ONLY
+}
+
+#if SPIFFS_INCREMENTAL_CHECK
+void SPIFFS_check_begin(spiffs *fs, spiffs_check_cursor *c, void *work) {
+  (void)fs;
+  memset(c, 0, sizeof(*c));
+  c->work = (u8_t *)work;
+  c->restart = 1;
+}
+
+s32_t SPIFFS_check_step(spiffs *fs, spiffs_check_cursor *c) {
+#if SPIFFS_READ_ONLY
+  (void)fs; (void)c;
+  return SPIFFS_ERR_RO_NOT_IMPL;
+#else
+  s32_t res;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+  res = spiffs_check_slice(fs, c);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
   SPIFFS_UNLOCK(fs);
   return res;
 #endif // SPIFFS_READ_ONLY
 }
 
+u32_t SPIFFS_check_progress(spiffs *fs, const spiffs_check_cursor *c) {
+  // the page pass takes a step per block for each range of pages
+  u32_t blocks = fs->block_count;
+  u32_t pages_per_scan = SPIFFS_CFG_LOG_PAGE_SZ(fs) * 8 / 4;
+  u32_t ranges = (SPIFFS_PAGES_PER_BLOCK(fs) * blocks + pages_per_scan - 1) / pages_per_scan;
+  u32_t done = c->block;
+  if (c->pass == SPIFFS_CHECK_INDEX) {
+    done += blocks;
+  } else if (c->pass == SPIFFS_CHECK_PAGE) {
+    done += blocks * (2 + c->pix_offset / pages_per_scan);
+  }
+  return done * 1000 / (blocks * (2 + ranges));
+}
+#endif
+
 s32_t SPIFFS_info(spiffs *fs, u32_t *total, u32_t *used) {
   s32_t res = SPIFFS_OK;
   SPIFFS_API_CHECK_CFG(fs);
@@ -1144,6 +1499,96 @@ s32_t SPIFFS_gc(spiffs *fs, u32_t size) {
 #endif // SPIFFS_READ_ONLY
 }
 
+s32_t SPIFFS_gc_step(spiffs *fs, u32_t min_deleted) {
+#if SPIFFS_READ_ONLY
+  (void)fs; (void)min_deleted;
+  return SPIFFS_ERR_RO_NOT_IMPL;
+#else
+  s32_t res;
+  u8_t erased;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  res = spiffs_gc_step(fs, min_deleted, &erased);
+  if (res == SPIFFS_ERR_NO_DELETED_BLOCKS) {
+    SPIFFS_UNLOCK(fs);
+    return 0;
+  }
+
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+  SPIFFS_UNLOCK(fs);
+  return erased ? 1 : 2;
+#endif // SPIFFS_READ_ONLY
+}
+
+#if SPIFFS_WEAR_LEVEL
+s32_t SPIFFS_wear_counts(spiffs *fs, u32_t *counts, u32_t n) {
+  s32_t res = SPIFFS_OK;
+  spiffs_block_ix bix;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  for (bix = 0; res == SPIFFS_OK && bix < fs->block_count && bix < n; bix++) {
+    res = spiffs_wear_count(fs, bix, &counts[bix]);
+  }
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+
+  SPIFFS_UNLOCK(fs);
+  return bix;
+}
+
+s32_t SPIFFS_wear_stats(spiffs *fs, spiffs_wear_stats *st) {
+  s32_t res = SPIFFS_OK;
+  spiffs_block_ix bix;
+  u32_t count;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  memset(st, 0, sizeof(*st));
+  st->blocks = fs->block_count;
+  st->min = (u32_t)-1;
+  st->moves = fs->stats_wear_moves;
+  for (bix = 0; res == SPIFFS_OK && bix < fs->block_count; bix++) {
+    res = spiffs_wear_count(fs, bix, &count);
+    if (res != SPIFFS_OK) {
+      break;
+    }
+    st->min = MIN(st->min, count);
+    st->max = MAX(st->max, count);
+    st->total += count;
+  }
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+
+  SPIFFS_UNLOCK(fs);
+  return res;
+}
+
+s32_t SPIFFS_wear_level_step(spiffs *fs, u32_t spread) {
+#if SPIFFS_READ_ONLY
+  (void)fs; (void)spread;
+  return SPIFFS_ERR_RO_NOT_IMPL;
+#else
+  s32_t res;
+  SPIFFS_API_CHECK_CFG(fs);
+  SPIFFS_API_CHECK_MOUNT(fs);
+  SPIFFS_LOCK(fs);
+
+  res = spiffs_gc_migrate(fs, spread);
+  if (res == SPIFFS_ERR_NO_DELETED_BLOCKS) {
+    SPIFFS_UNLOCK(fs);
+    return 0;
+  }
+
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
+  SPIFFS_UNLOCK(fs);
+  return 1;
+#endif // SPIFFS_READ_ONLY
+}
+#endif
+
 s32_t SPIFFS_eof(spiffs *fs, spiffs_file fh) {
   s32_t res;
   SPIFFS_API_CHECK_CFG(fs);
@@ -1213,19 +1658,14 @@ s32_t SPIFFS_ix_map(spiffs *fs,  spiffs_file fh, spiffs_ix_map *map,
   SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
 
   if (fd->ix_map) {
+#if SPIFFS_IX_MAP_AUTO
+    // an automatic map gives way to the caller's
+    if (!spiffs_ix_auto_owns(fd->ix_map))
+#endif
     SPIFFS_API_CHECK_RES_UNLOCK(fs, SPIFFS_ERR_IX_MAP_MAPPED);
   }
 
-  map->map_buf = map_buf;
-  map->offset = offset;
-  // nb: spix range includes last
-  map->start_spix = offset / SPIFFS_DATA_PAGE_SIZE(fs);
-  map->end_spix = (offset + len) / SPIFFS_DATA_PAGE_SIZE(fs);
-  memset(map_buf, 0, sizeof(spiffs_page_ix) * (map->end_spix - map->start_spix + 1));
-  fd->ix_map = map;
-
-  // scan for pixes
-  res = spiffs_populate_ix_map(fs, fd, 0, map->end_spix - map->start_spix + 1);
+  res = spiffs_ix_map_fd(fs, fd, map, offset, len, map_buf);
   SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
 
   SPIFFS_UNLOCK(fs);
@@ -1270,47 +1710,8 @@ s32_t SPIFFS_ix_remap(spiffs *fs, spiffs_file fh, u32_t offset) {
     SPIFFS_API_CHECK_RES_UNLOCK(fs, SPIFFS_ERR_IX_MAP_UNMAPPED);
   }
 
-  spiffs_ix_map *map = fd->ix_map;
-
-  s32_t spix_diff = offset / SPIFFS_DATA_PAGE_SIZE(fs) - map->start_spix;
-  map->offset = offset;
-
-  // move existing pixes if within map offs
-  if (spix_diff != 0) {
-    // move vector
-    int i;
-    const s32_t vec_len = map->end_spix - map->start_spix + 1; // spix range includes last
-    map->start_spix += spix_diff;
-    map->end_spix += spix_diff;
-    if (spix_diff >= vec_len) {
-      // moving beyond range
-      memset(&map->map_buf, 0, vec_len * sizeof(spiffs_page_ix));
-      // populate_ix_map is inclusive
-      res = spiffs_populate_ix_map(fs, fd, 0, vec_len-1);
-      SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
-    } else if (spix_diff > 0) {
-      // diff positive
-      for (i = 0; i < vec_len - spix_diff; i++) {
-        map->map_buf[i] = map->map_buf[i + spix_diff];
-      }
-      // memset is non-inclusive
-      memset(&map->map_buf[vec_len - spix_diff], 0, spix_diff * sizeof(spiffs_page_ix));
-      // populate_ix_map is inclusive
-      res = spiffs_populate_ix_map(fs, fd, vec_len - spix_diff, vec_len-1);
-      SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
-    } else {
-      // diff negative
-      for (i = vec_len - 1; i >= -spix_diff; i--) {
-        map->map_buf[i] = map->map_buf[i + spix_diff];
-      }
-      // memset is non-inclusive
-      memset(&map->map_buf[0], 0, -spix_diff * sizeof(spiffs_page_ix));
-      // populate_ix_map is inclusive
-      res = spiffs_populate_ix_map(fs, fd, 0, -spix_diff - 1);
-      SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
-    }
-
-  }
+  res = spiffs_ix_remap_fd(fs, fd, offset);
+  SPIFFS_API_CHECK_RES_UNLOCK(fs, res);
 
   SPIFFS_UNLOCK(fs);
   return res;
@@ -1397,7 +1798,7 @@ s32_t SPIFFS_vis(spiffs *fs) {
   spiffs_printf("page_alloc:  "_SPIPRIi"\n", fs->stats_p_allocated);
   spiffs_printf("page_delet:  "_SPIPRIi"\n", fs->stats_p_deleted);
   SPIFFS_UNLOCK(fs);
-  u32_t total, used;
+  u32_t total = 0, used = 0;
   SPIFFS_info(fs, &total, &used);
   spiffs_printf("used:        "_SPIPRIi" of "_SPIPRIi"\n", used, total);
   return res;
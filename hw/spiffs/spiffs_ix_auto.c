@@ -0,0 +1,221 @@
+/*
+ * Automatic index maps: a file that is seeked in and is too large for its
+ * index header to cover gets an index map from a small pool, so reads
+ * find their data page in RAM instead of searching the lookup pages for
+ * the index page that has it.
+ *
+ * A map covers a window of SPIFFS_IX_MAP_AUTO_ENTRIES data pages.  A seek
+ * outside the window moves it, reading only the index pages for the part
+ * that is new.  The pages of those index pages are kept too, so a write
+ * after a seek finds the index page it has to change without a search.
+ * When every map is in use the least recently seeked one is taken from
+ * its file, which just goes back to searching.  A map
+ * belongs to a file descriptor as long as the descriptor points to it,
+ * so closing a file or mapping it by hand frees its map.
+ */
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+
+#if SPIFFS_IX_MAP_AUTO
+
+/* Index pages remembered per map, enough for the window with 256 byte pages */
+#define IX_OBJIX	(SPIFFS_IX_MAP_AUTO_ENTRIES / 64 + 2)
+
+struct ix_auto {
+	spiffs_ix_map	map;
+	spiffs_fd	*fd;		/* Last owner */
+	u32_t		used;		/* Stamp of the last seek */
+	spiffs_page_ix	buf[SPIFFS_IX_MAP_AUTO_ENTRIES];
+	/* Index pages of the window, from the first one on, 0 if unknown */
+	spiffs_page_ix	objix[IX_OBJIX];
+};
+
+/* There is only the one file system */
+static struct ix_auto ix_pool[SPIFFS_IX_MAP_AUTO_MAPS];
+static u32_t ix_clock;
+
+static s32_t ix_auto_map(spiffs *, spiffs_fd *, u32_t);
+
+static int
+owned(const struct ix_auto *a)
+{
+	return a->fd != 0 && a->fd->file_nbr != 0 && a->fd->ix_map == &a->map;
+}
+
+u8_t
+spiffs_ix_auto_owns(spiffs_ix_map *map)
+{
+	int i;
+
+	for (i = 0; i < SPIFFS_IX_MAP_AUTO_MAPS; i++)
+		if (map == &ix_pool[i].map)
+			return 1;
+	return 0;
+}
+
+static struct ix_auto *
+pool_map(spiffs_fd *fd)
+{
+	if (fd->ix_map == 0 || !spiffs_ix_auto_owns(fd->ix_map))
+		return 0;
+	return (struct ix_auto *)fd->ix_map;
+}
+
+/* Moves the index page table for a window starting at data page "start". */
+static void
+shift_objix(spiffs *fs, struct ix_auto *a, u32_t start)
+{
+	s32_t d = (s32_t)SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, start) -
+	    (s32_t)SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, a->map.start_spix);
+	int i;
+
+	(void)fs;
+	if (d >= IX_OBJIX || -d >= IX_OBJIX) {
+		memset(a->objix, 0, sizeof(a->objix));
+	} else if (d > 0) {
+		for (i = 0; i < IX_OBJIX - d; i++)
+			a->objix[i] = a->objix[i + d];
+		memset(&a->objix[IX_OBJIX - d], 0, d * sizeof(a->objix[0]));
+	} else if (d < 0) {
+		for (i = IX_OBJIX - 1; i >= -d; i--)
+			a->objix[i] = a->objix[i + d];
+		memset(a->objix, 0, -d * sizeof(a->objix[0]));
+	}
+}
+
+/*
+ * Notes where index page "objix_spix" of the file open on "fd" is, or
+ * that it is gone if "pix" is 0.  Called as index pages are read into
+ * the map and as they are written.
+ */
+void
+spiffs_ix_auto_objix(spiffs *fs, spiffs_fd *fd, spiffs_span_ix objix_spix,
+    spiffs_page_ix pix)
+{
+	struct ix_auto *a = pool_map(fd);
+	s32_t i;
+
+	(void)fs;
+	if (a == 0)
+		return;
+	i = (s32_t)objix_spix -
+	    (s32_t)SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, a->map.start_spix);
+	if (i >= 0 && i < IX_OBJIX)
+		a->objix[i] = pix;
+}
+
+/* Where index page "objix_spix" is, if the map of "fd" knows, else 0. */
+static spiffs_page_ix
+find_objix(spiffs *fs, spiffs_fd *fd, spiffs_span_ix objix_spix)
+{
+	struct ix_auto *a = pool_map(fd);
+	s32_t i;
+
+	(void)fs;
+	if (a == 0)
+		return 0;
+	i = (s32_t)objix_spix -
+	    (s32_t)SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, a->map.start_spix);
+	return i >= 0 && i < IX_OBJIX ? a->objix[i] : 0;
+}
+
+/*
+ * First data page of the window for a seek to "spix" in a file of "pages"
+ * data pages.  A quarter of the window is kept behind the seek.
+ */
+static u32_t
+window(u32_t spix, u32_t pages)
+{
+	u32_t start = spix > SPIFFS_IX_MAP_AUTO_ENTRIES / 4 ?
+	    spix - SPIFFS_IX_MAP_AUTO_ENTRIES / 4 : 0;
+
+	if (pages <= SPIFFS_IX_MAP_AUTO_ENTRIES)
+		return 0;
+	if (start > pages - SPIFFS_IX_MAP_AUTO_ENTRIES)
+		start = pages - SPIFFS_IX_MAP_AUTO_ENTRIES;
+	return start;
+}
+
+/*
+ * Called on a seek to "offset".  Maps the file if it is large enough, or
+ * moves its map to cover the offset, and points the descriptor's index
+ * cursor at the index page for the offset if the map knows it.  The map
+ * is only a hint: on an error it is dropped and reads search as before.
+ */
+s32_t
+spiffs_ix_auto(spiffs *fs, spiffs_fd *fd, u32_t offset)
+{
+	s32_t res = ix_auto_map(fs, fd, offset);
+	spiffs_span_ix objix_spix;
+	spiffs_page_ix pix;
+
+	if (res != SPIFFS_OK || fd->ix_map == 0)
+		return res;
+	objix_spix = SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs,
+	    (offset > 0 ? offset - 1 : 0) / SPIFFS_DATA_PAGE_SIZE(fs));
+	if (objix_spix != 0 && fd->cursor_objix_spix != objix_spix &&
+	    (pix = find_objix(fs, fd, objix_spix)) != 0) {
+		fd->cursor_objix_spix = objix_spix;
+		fd->cursor_objix_pix = pix;
+	}
+	return SPIFFS_OK;
+}
+
+static s32_t
+ix_auto_map(spiffs *fs, spiffs_fd *fd, u32_t offset)
+{
+	struct ix_auto *a, *lru;
+	u32_t spix, pages, start;
+	s32_t res;
+	int i;
+
+	if (fd->size == SPIFFS_UNDEFINED_LEN ||
+	    fd->size <= SPIFFS_IX_MAP_AUTO_MIN(fs))
+		return SPIFFS_OK;
+	if (fd->ix_map != 0 && !spiffs_ix_auto_owns(fd->ix_map))
+		return SPIFFS_OK;	/* Mapped by hand */
+	spix = offset / SPIFFS_DATA_PAGE_SIZE(fs);
+	pages = (fd->size + SPIFFS_DATA_PAGE_SIZE(fs) - 1) /
+	    SPIFFS_DATA_PAGE_SIZE(fs);
+
+	if (fd->ix_map != 0) {
+		a = (struct ix_auto *)fd->ix_map;
+		a->used = ++ix_clock;
+		if (spix >= a->map.start_spix && spix <= a->map.end_spix)
+			return SPIFFS_OK;
+		start = window(spix, pages);
+		shift_objix(fs, a, start);
+		res = spiffs_ix_remap_fd(fs, fd,
+		    start * SPIFFS_DATA_PAGE_SIZE(fs));
+		if (res != SPIFFS_OK)
+			fd->ix_map = 0;
+		return res;
+	}
+
+	/* A free map, else the least recently used */
+	lru = &ix_pool[0];
+	for (i = 0; i < SPIFFS_IX_MAP_AUTO_MAPS; i++) {
+		a = &ix_pool[i];
+		if (!owned(a)) {
+			lru = a;
+			break;
+		}
+		if (a->used - lru->used > 0x80000000u)
+			lru = a;
+	}
+	if (owned(lru))
+		lru->fd->ix_map = 0;
+	lru->fd = fd;
+	lru->used = ++ix_clock;
+	memset(lru->objix, 0, sizeof(lru->objix));
+	res = spiffs_ix_map_fd(fs, fd, &lru->map,
+	    window(spix, pages) * SPIFFS_DATA_PAGE_SIZE(fs),
+	    (SPIFFS_IX_MAP_AUTO_ENTRIES - 1) * SPIFFS_DATA_PAGE_SIZE(fs),
+	    lru->buf);
+	if (res != SPIFFS_OK)
+		fd->ix_map = 0;
+	return res;
+}
+
+#endif /* SPIFFS_IX_MAP_AUTO */
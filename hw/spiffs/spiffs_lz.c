@@ -0,0 +1,490 @@
+/*
+ * Compressed files, see spiffs_lz.h.
+ *
+ * The codec is LZ77 with LZ4 style sequences: a token byte with the
+ * literal count in the high nibble and the match length less 4 in the
+ * low one, 15 meaning more length bytes follow, then the literals, then
+ * a two byte offset back into the block.  The last sequence of a block
+ * has literals only.  Matches are found through a hash of the next four
+ * bytes, keeping only the latest position for each hash.
+ *
+ * Blocks are written as they fill.  The block table is only known at
+ * the end, so close reads the block lengths back and writes the table
+ * and the trailer after the last block.
+ *
+ * The first block decides whether the file is compressed at all: unless
+ * it comes out smaller by more than the header, its table entry and the
+ * trailer, the file is written through as it is and not flagged.  So a
+ * file that fits in one block is only compressed if that saves space.
+ */
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "spiffs_lz.h"
+
+#define MIN_MATCH	4
+#define TABLE_CHUNK	32	/* Table entries written at a time */
+/* What a compressed file of one block stores besides the block itself */
+#define LZ_OVERHEAD	(sizeof(struct spiffs_lz_hdr) + sizeof(u16_t) + 4 + \
+			    sizeof(struct spiffs_lz_trailer))
+
+static u32_t
+hash4(const u8_t *p)
+{
+	u32_t v = p[0] | p[1] << 8 | p[2] << 16 | (u32_t)p[3] << 24;
+
+	return (v * 2654435761u) >> 23 & (SPIFFS_LZ_HASH - 1);
+}
+
+/* Appends a length's extension bytes, "len" already less 15. */
+static int
+put_len(u8_t *out, u32_t *o, u32_t max, u32_t len)
+{
+	for (; len >= 255; len -= 255) {
+		if (*o >= max)
+			return -1;
+		out[(*o)++] = 255;
+	}
+	if (*o >= max)
+		return -1;
+	out[(*o)++] = len;
+	return 0;
+}
+
+/* Appends "nlit" literals and a match of "len" at "off", if any. */
+static int
+put_seq(u8_t *out, u32_t *o, u32_t max, const u8_t *lit, u32_t nlit,
+    u32_t off, u32_t len)
+{
+	u32_t ml = len ? len - MIN_MATCH : 0;
+
+	if (*o >= max)
+		return -1;
+	out[(*o)++] = (nlit < 15 ? nlit : 15) << 4 | (ml < 15 ? ml : 15);
+	if (nlit >= 15 && put_len(out, o, max, nlit - 15) < 0)
+		return -1;
+	if (nlit > max - *o)
+		return -1;
+	memcpy(out + *o, lit, nlit);
+	*o += nlit;
+	if (len == 0)
+		return 0;
+	if (max - *o < 2)
+		return -1;
+	out[(*o)++] = off;
+	out[(*o)++] = off >> 8;
+	if (ml >= 15 && put_len(out, o, max, ml - 15) < 0)
+		return -1;
+	return 0;
+}
+
+/*
+ * Compresses "n" bytes into at most "max", with "hash" SPIFFS_LZ_HASH
+ * entries of scratch.  Returns 0 if the output would not fit.
+ */
+u32_t
+spiffs_lz_compress(const u8_t *in, u32_t n, u8_t *out, u32_t max,
+    u16_t *hash)
+{
+	u32_t i = 0, anchor = 0, o = 0, h, ref, len;
+
+	memset(hash, 0xff, SPIFFS_LZ_HASH * sizeof(*hash));
+	while (i + MIN_MATCH <= n) {
+		h = hash4(in + i);
+		ref = hash[h];
+		hash[h] = i;
+		if (ref == 0xffff || memcmp(in + ref, in + i, MIN_MATCH) != 0) {
+			i++;
+			continue;
+		}
+		for (len = MIN_MATCH; i + len < n && in[ref + len] == in[i + len];
+		    len++)
+			;
+		if (put_seq(out, &o, max, in + anchor, i - anchor, i - ref,
+		    len) < 0)
+			return 0;
+		/* Keep the end of the match findable */
+		if (i + len + 2 <= n)
+			hash[hash4(in + i + len - 2)] = i + len - 2;
+		i += len;
+		anchor = i;
+	}
+	if (anchor < n &&
+	    put_seq(out, &o, max, in + anchor, n - anchor, 0, 0) < 0)
+		return 0;
+	return o;
+}
+
+static int
+get_len(const u8_t *in, u32_t *i, u32_t n, u32_t *len)
+{
+	u8_t b;
+
+	do {
+		if (*i >= n)
+			return -1;
+		b = in[(*i)++];
+		*len += b;
+	} while (b == 255);
+	return 0;
+}
+
+/* Returns the decompressed length, or -1 if the input is corrupt. */
+s32_t
+spiffs_lz_decompress(const u8_t *in, u32_t n, u8_t *out, u32_t max)
+{
+	u32_t i = 0, o = 0, lit, len, off;
+	u8_t t;
+
+	while (i < n) {
+		t = in[i++];
+		lit = t >> 4;
+		if (lit == 15 && get_len(in, &i, n, &lit) < 0)
+			return -1;
+		if (lit > n - i || lit > max - o)
+			return -1;
+		memcpy(out + o, in + i, lit);
+		i += lit;
+		o += lit;
+		if (i == n)
+			break;
+		if (n - i < 2)
+			return -1;
+		off = in[i] | in[i + 1] << 8;
+		i += 2;
+		len = t & 15;
+		if (len == 15 && get_len(in, &i, n, &len) < 0)
+			return -1;
+		len += MIN_MATCH;
+		if (off == 0 || off > o || len > max - o)
+			return -1;
+		for (; len > 0; len--, o++)
+			out[o] = out[o - off];
+	}
+	return o;
+}
+
+/*
+ * {Files}
+ */
+
+static int
+is_lz(const spiffs_stat *st)
+{
+	const struct MTP_MetaData *m = (const void *)st->meta;
+
+	return m->str_id != 0xffffffff && (m->perm & MTP_PERM_LZ) != 0;
+}
+
+static s32_t
+rd(spiffs_lz *z, u32_t off, void *buf, u32_t len)
+{
+	s32_t res;
+
+	if ((res = SPIFFS_lseek(z->fs, z->fh, off, SPIFFS_SEEK_SET)) < 0)
+		return res;
+	res = SPIFFS_read(z->fs, z->fh, buf, len);
+	if (res >= 0 && (u32_t)res != len)
+		return SPIFFS_ERR_LZ_CORRUPT;
+	return res < 0 ? res : SPIFFS_OK;
+}
+
+s32_t
+spiffs_lz_create(spiffs_lz *z, spiffs *fs, const char *name,
+    const struct MTP_MetaData *meta)
+{
+	struct MTP_MetaData m;
+	s32_t res;
+
+	memset(z, 0, offsetof(spiffs_lz, buf));
+	z->fs = fs;
+	z->lz = 1;
+	z->writing = 1;
+	if (meta)
+		memcpy(&m, meta, sizeof(m));
+	else
+		memset(&m, 0, sizeof(m));
+	/* Flagged with the header, once the first block compresses */
+	m.perm &= ~MTP_PERM_LZ;
+	m.csize = 0;
+	z->fh = SPIFFS_open(fs, name, SPIFFS_O_CREAT | SPIFFS_O_TRUNC |
+	    SPIFFS_O_RDWR, 0);
+	if (z->fh < 0)
+		return z->fh;
+	if ((res = SPIFFS_fupdate_meta(fs, z->fh, &m)) < 0) {
+		SPIFFS_close(fs, z->fh);
+		return res;
+	}
+	return SPIFFS_OK;
+}
+
+s32_t
+spiffs_lz_open(spiffs_lz *z, spiffs *fs, const char *name)
+{
+	struct spiffs_lz_trailer t;
+	struct spiffs_lz_hdr h;
+	spiffs_stat st;
+	u32_t blocks;
+	s32_t res;
+
+	memset(z, 0, offsetof(spiffs_lz, buf));
+	z->fs = fs;
+	z->block = ~0u;
+	z->fh = SPIFFS_open(fs, name, SPIFFS_O_RDONLY, 0);
+	if (z->fh < 0)
+		return z->fh;
+	if ((res = SPIFFS_fstat(fs, z->fh, &st)) < 0)
+		goto fail;
+	z->size = st.size;
+	if (!is_lz(&st))
+		return SPIFFS_OK;
+
+	/* Header and trailer must agree with the file's length */
+	z->lz = 1;
+	res = SPIFFS_ERR_LZ_CORRUPT;
+	if (st.size < sizeof(h) + sizeof(t) ||
+	    rd(z, 0, &h, sizeof(h)) != SPIFFS_OK ||
+	    rd(z, st.size - sizeof(t), &t, sizeof(t)) != SPIFFS_OK)
+		goto fail;
+	blocks = (t.size + SPIFFS_LZ_BLOCK - 1) / SPIFFS_LZ_BLOCK;
+	if (h.magic != SPIFFS_LZ_MAGIC || t.magic != SPIFFS_LZ_MAGIC ||
+	    h.block_size != SPIFFS_LZ_BLOCK || t.table < sizeof(h) ||
+	    t.table > st.size - sizeof(t) ||
+	    (st.size - sizeof(t) - t.table) / 4 != blocks)
+		goto fail;
+	z->size = t.size;
+	z->table = t.table;
+	return SPIFFS_OK;
+fail:
+	SPIFFS_close(fs, z->fh);
+	return res;
+}
+
+u32_t
+spiffs_lz_size(spiffs_lz *z)
+{
+	return z->size;
+}
+
+/* Decompresses block "b" into buf. */
+static s32_t
+load(spiffs_lz *z, u32_t b)
+{
+	u32_t off, want;
+	u16_t len;
+	s32_t res;
+
+	want = MIN(SPIFFS_LZ_BLOCK, z->size - b * SPIFFS_LZ_BLOCK);
+	if ((res = rd(z, z->table + b * 4, &off, sizeof(off))) != SPIFFS_OK ||
+	    (res = rd(z, off, &len, sizeof(len))) != SPIFFS_OK)
+		return res;
+	z->block = ~0u;
+	if (len & SPIFFS_LZ_RAW) {
+		if ((len & ~SPIFFS_LZ_RAW) != want)
+			return SPIFFS_ERR_LZ_CORRUPT;
+		res = rd(z, off + sizeof(len), z->buf, want);
+	} else {
+		if (len > SPIFFS_LZ_BLOCK)
+			return SPIFFS_ERR_LZ_CORRUPT;
+		res = rd(z, off + sizeof(len), z->out, len);
+		if (res == SPIFFS_OK &&
+		    spiffs_lz_decompress(z->out, len, z->buf, want) != (s32_t)want)
+			res = SPIFFS_ERR_LZ_CORRUPT;
+	}
+	if (res == SPIFFS_OK)
+		z->block = b;
+	return res;
+}
+
+s32_t
+spiffs_lz_read(spiffs_lz *z, void *buf, u32_t len)
+{
+	u8_t *p = buf;
+	u32_t n, done = 0;
+	s32_t res;
+
+	if (!z->lz)
+		return SPIFFS_read(z->fs, z->fh, buf, len);
+	if (z->writing)
+		return SPIFFS_ERR_NOT_READABLE;
+	if (z->pos >= z->size)
+		return SPIFFS_ERR_END_OF_OBJECT;
+	len = MIN(len, z->size - z->pos);
+	while (done < len) {
+		if (z->pos / SPIFFS_LZ_BLOCK != z->block &&
+		    (res = load(z, z->pos / SPIFFS_LZ_BLOCK)) != SPIFFS_OK)
+			return res;
+		n = MIN(len - done, SPIFFS_LZ_BLOCK - z->pos % SPIFFS_LZ_BLOCK);
+		memcpy(p + done, z->buf + z->pos % SPIFFS_LZ_BLOCK, n);
+		done += n;
+		z->pos += n;
+	}
+	return done;
+}
+
+s32_t
+spiffs_lz_lseek(spiffs_lz *z, s32_t offs, int whence)
+{
+	s32_t pos;
+
+	if (!z->lz)
+		return SPIFFS_lseek(z->fs, z->fh, offs, whence);
+	if (z->writing)
+		return SPIFFS_ERR_NOT_READABLE;
+	switch (whence) {
+	case SPIFFS_SEEK_CUR:
+		pos = z->pos + offs;
+		break;
+	case SPIFFS_SEEK_END:
+		pos = z->size + offs;
+		break;
+	default:
+		pos = offs;
+	}
+	if (pos < 0 || (u32_t)pos > z->size)
+		return SPIFFS_ERR_END_OF_OBJECT;
+	z->pos = pos;
+	return pos;
+}
+
+/* Sets csize to "size", and flags the file if it is compressed. */
+static s32_t
+set_meta(spiffs_lz *z, u32_t size)
+{
+	struct MTP_MetaData m;
+	spiffs_stat st;
+	s32_t res;
+
+	if ((res = SPIFFS_fstat(z->fs, z->fh, &st)) < 0)
+		return res;
+	memcpy(&m, st.meta, sizeof(m));
+	if (z->lz)
+		m.perm |= MTP_PERM_LZ;
+	m.csize = size;
+	return SPIFFS_fupdate_meta(z->fs, z->fh, &m);
+}
+
+/*
+ * Starts the file with the first block, "n" bytes compressed or 0: with
+ * the flag and the header if that saves space, else as it is.
+ */
+static s32_t
+start(spiffs_lz *z, u32_t n)
+{
+	struct spiffs_lz_hdr h;
+	s32_t res;
+
+	if (n == 0 || n + LZ_OVERHEAD >= z->fill) {
+		z->lz = 0;
+		res = SPIFFS_write(z->fs, z->fh, z->buf, z->fill);
+		z->fill = 0;
+		return res < 0 ? res : SPIFFS_OK;
+	}
+	h.magic = SPIFFS_LZ_MAGIC;
+	h.block_size = SPIFFS_LZ_BLOCK;
+	h.reserved = 0xffff;
+	if ((res = set_meta(z, 0)) < 0 ||
+	    (res = SPIFFS_write(z->fs, z->fh, &h, sizeof(h))) < 0)
+		return res;
+	return SPIFFS_OK;
+}
+
+/* Compresses and appends the block in buf. */
+static s32_t
+flush(spiffs_lz *z)
+{
+	u32_t n;
+	u16_t len;
+	s32_t res;
+
+	if (z->fill == 0)
+		return SPIFFS_OK;
+	n = spiffs_lz_compress(z->buf, z->fill, z->out, z->fill - 1, z->hash);
+	if (z->size == z->fill && ((res = start(z, n)) != SPIFFS_OK || !z->lz))
+		return res;
+	len = n ? n : z->fill | SPIFFS_LZ_RAW;
+	if ((res = SPIFFS_write(z->fs, z->fh, &len, sizeof(len))) >= 0)
+		res = SPIFFS_write(z->fs, z->fh, n ? z->out : z->buf,
+		    n ? n : z->fill);
+	z->fill = 0;
+	return res < 0 ? res : SPIFFS_OK;
+}
+
+s32_t
+spiffs_lz_write(spiffs_lz *z, const void *buf, u32_t len)
+{
+	const u8_t *p = buf;
+	u32_t n, done = 0;
+	s32_t res;
+
+	if (!z->lz)
+		return SPIFFS_write(z->fs, z->fh, (void *)buf, len);
+	if (!z->writing)
+		return SPIFFS_ERR_NOT_WRITABLE;
+	while (done < len) {
+		n = MIN(len - done, SPIFFS_LZ_BLOCK - z->fill);
+		memcpy(z->buf + z->fill, p + done, n);
+		z->fill += n;
+		done += n;
+		z->size += n;
+		if (z->fill == SPIFFS_LZ_BLOCK && (res = flush(z)) != SPIFFS_OK)
+			return res;
+		if (!z->lz && done < len) {
+			/* The first block did not compress, pass the rest */
+			res = SPIFFS_write(z->fs, z->fh, (void *)(p + done),
+			    len - done);
+			return res < 0 ? res : (s32_t)len;
+		}
+	}
+	return done;
+}
+
+/* Writes the block table and the trailer after the last block. */
+static s32_t
+finish(spiffs_lz *z)
+{
+	struct spiffs_lz_trailer t;
+	u32_t table[TABLE_CHUNK], off, b, n, blocks;
+	spiffs_stat st;
+	u16_t len;
+	s32_t res;
+
+	if (z->size == 0)
+		z->lz = 0;	/* Empty, nothing to compress */
+	if ((res = flush(z)) != SPIFFS_OK ||
+	    (res = SPIFFS_fstat(z->fs, z->fh, &st)) < 0)
+		return res;
+	if (!z->lz)
+		return set_meta(z, st.size);
+	t.table = st.size;
+	t.size = z->size;
+	t.magic = SPIFFS_LZ_MAGIC;
+	blocks = (z->size + SPIFFS_LZ_BLOCK - 1) / SPIFFS_LZ_BLOCK;
+	off = sizeof(struct spiffs_lz_hdr);
+	for (b = 0; b < blocks; b += n) {
+		for (n = 0; n < TABLE_CHUNK && b + n < blocks; n++) {
+			table[n] = off;
+			if ((res = rd(z, off, &len, sizeof(len))) != SPIFFS_OK)
+				return res;
+			off += sizeof(len) + (len & ~SPIFFS_LZ_RAW);
+		}
+		if ((res = SPIFFS_lseek(z->fs, z->fh, 0, SPIFFS_SEEK_END)) < 0 ||
+		    (res = SPIFFS_write(z->fs, z->fh, table, n * 4)) < 0)
+			return res;
+	}
+	if ((res = SPIFFS_lseek(z->fs, z->fh, 0, SPIFFS_SEEK_END)) < 0 ||
+	    (res = SPIFFS_write(z->fs, z->fh, &t, sizeof(t))) < 0)
+		return res;
+	return set_meta(z, z->size);
+}
+
+s32_t
+spiffs_lz_close(spiffs_lz *z)
+{
+	s32_t res = SPIFFS_OK, res2;
+
+	if (z->writing)
+		res = finish(z);
+	res2 = SPIFFS_close(z->fs, z->fh);
+	return res != SPIFFS_OK ? res : res2;
+}
@@ -0,0 +1,85 @@
+#ifndef _SPIFFS_LZ_H_
+#define _SPIFFS_LZ_H_
+
+#include "spiffs.h"
+
+/*
+ * Compressed files: a file layer over SPIFFS that compresses what is
+ * written in blocks of SPIFFS_LZ_BLOCK bytes and decompresses on read.
+ * Each block is compressed on its own, so a seek decompresses at most
+ * one block.  Files are flagged in their MTP_MetaData; files without the
+ * flag are read and written through unchanged, so callers can use this
+ * layer for every file.  A compressed file is written once, front to
+ * back, and becomes readable once closed.
+ */
+
+#ifndef SPIFFS_LZ_BLOCK
+#define SPIFFS_LZ_BLOCK		2048	/* Up to 32k */
+#endif
+#define SPIFFS_LZ_HASH		512	/* Match finder entries, a power of 2 */
+
+/* MTP_MetaData.perm bit of a compressed file, not an MTP value */
+#define MTP_PERM_LZ		0x4000
+
+#define SPIFFS_LZ_MAGIC		0x315a4c53	/* "SLZ1" */
+
+/*
+ * On flash: a header, the blocks, a table of the offset of every block
+ * and a trailer.  Each block starts with its stored length, with
+ * SPIFFS_LZ_RAW set if it did not compress.  All fields little endian.
+ */
+struct spiffs_lz_hdr {
+	u32_t	magic;
+	u16_t	block_size;
+	u16_t	reserved;
+} __attribute__((packed));
+
+#define SPIFFS_LZ_RAW		0x8000
+
+struct spiffs_lz_trailer {
+	u32_t	table;		/* Offset of the block table */
+	u32_t	size;		/* Uncompressed */
+	u32_t	magic;
+} __attribute__((packed));
+
+typedef struct {
+	spiffs		*fs;
+	spiffs_file	fh;
+	u8_t		lz;		/* Compressed, else passed through */
+	u8_t		writing;
+	u32_t		size;		/* Uncompressed */
+	u32_t		pos;
+	u32_t		table;		/* Reading: offset of the block table */
+	u32_t		block;		/* Reading: block in buf, or ~0 */
+	u32_t		fill;		/* Writing: bytes in buf */
+	u8_t		buf[SPIFFS_LZ_BLOCK];
+	/* Compressed block; the writer's match finder follows it */
+	u8_t		out[SPIFFS_LZ_BLOCK];
+	u16_t		hash[SPIFFS_LZ_HASH];
+} spiffs_lz;
+
+/*
+ * Creates or truncates "name" as a compressed file, or a plain one if its
+ * first block does not compress.  "meta" may be null for zeroed metadata;
+ * its csize is set to the uncompressed size on close.
+ */
+s32_t spiffs_lz_create(spiffs_lz *z, spiffs *fs, const char *name,
+    const struct MTP_MetaData *meta);
+
+/* Opens "name" for reading, compressed or not */
+s32_t spiffs_lz_open(spiffs_lz *z, spiffs *fs, const char *name);
+
+s32_t spiffs_lz_read(spiffs_lz *z, void *buf, u32_t len);
+s32_t spiffs_lz_write(spiffs_lz *z, const void *buf, u32_t len);
+s32_t spiffs_lz_lseek(spiffs_lz *z, s32_t offs, int whence);
+s32_t spiffs_lz_close(spiffs_lz *z);
+
+/* Uncompressed size of an open file */
+u32_t spiffs_lz_size(spiffs_lz *z);
+
+/* The codec, for tools.  Return the output length, 0 or -1 on overflow. */
+u32_t spiffs_lz_compress(const u8_t *in, u32_t n, u8_t *out, u32_t max,
+    u16_t *hash);
+s32_t spiffs_lz_decompress(const u8_t *in, u32_t n, u8_t *out, u32_t max);
+
+#endif
@@ -0,0 +1,274 @@
+/*
+ * Name index: a small set associative table from a hash of the file name
+ * to the object id and object index header page, so that opening a file
+ * by name costs one header read instead of a walk over every index page
+ * in the file system.
+ *
+ * Every hit is checked against the header on the flash.  The table is
+ * filled by the first lookup after mount, so mounting reads no headers,
+ * and is kept up to date through the object index events.  While it holds
+ * every header on the flash a miss is final and creating a file costs no
+ * search.  Once a full set has dropped its least recently used entry, or
+ * an entry turned out stale, a miss falls back to the full search, whose
+ * result is then entered.
+ */
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+
+#if SPIFFS_NAME_INDEX
+
+#define IX_WAYS		4
+#define IX_SETS		(SPIFFS_NAME_INDEX_SIZE / IX_WAYS)
+#define IX_EMPTY	SPIFFS_OBJ_ID_DELETED
+
+#define IX_UNBUILT	0	/* Filled by the next lookup */
+#define IX_COMPLETE	1	/* Every header is in the table */
+#define IX_PARTIAL	2	/* Misses must search */
+
+struct ix_entry {
+	u32_t		hash;
+	spiffs_obj_id	obj_id;		/* Without the index flag */
+	spiffs_page_ix	pix;		/* Object index header page */
+};
+
+/* There is only the one file system.  Empty ways are at the end of a set. */
+static struct ix_entry ix_table[IX_SETS][IX_WAYS];
+static u8_t ix_state;
+
+static u32_t
+name_hash(const u8_t *name)
+{
+	u32_t h = 2166136261u;	/* FNV-1a */
+	int i;
+
+	for (i = 0; i < SPIFFS_OBJ_NAME_LEN && name[i] != 0; i++)
+		h = (h ^ name[i]) * 16777619u;
+	return h;
+}
+
+/* Moves way "w" of a set to the front, making it the most recently used. */
+static void
+promote(struct ix_entry *set, int w)
+{
+	struct ix_entry e = set[w];
+
+	for (; w > 0; w--)
+		set[w] = set[w - 1];
+	set[0] = e;
+}
+
+static void
+remove_id(spiffs_obj_id obj_id)
+{
+	struct ix_entry *set;
+	int s, w;
+
+	for (s = 0; s < IX_SETS; s++) {
+		set = ix_table[s];
+		for (w = 0; w < IX_WAYS; w++) {
+			if (set[w].obj_id != obj_id)
+				continue;
+			/* Close the gap so empty ways stay at the end */
+			for (; w < IX_WAYS - 1; w++)
+				set[w] = set[w + 1];
+			set[w].obj_id = IX_EMPTY;
+			return;
+		}
+	}
+}
+
+static void
+move_id(spiffs_obj_id obj_id, spiffs_page_ix pix)
+{
+	int s, w;
+
+	for (s = 0; s < IX_SETS; s++)
+		for (w = 0; w < IX_WAYS; w++)
+			if (ix_table[s][w].obj_id == obj_id) {
+				ix_table[s][w].pix = pix;
+				return;
+			}
+}
+
+void
+spiffs_name_ix_add(const u8_t *name, spiffs_obj_id obj_id, spiffs_page_ix pix)
+{
+	u32_t h = name_hash(name);
+	struct ix_entry *set = ix_table[h % IX_SETS];
+
+	obj_id &= ~SPIFFS_OBJ_ID_IX_FLAG;
+	remove_id(obj_id);
+	/* The last way is empty or the least recently used, drop it */
+	if (set[IX_WAYS - 1].obj_id != IX_EMPTY)
+		ix_state = IX_PARTIAL;
+	set[IX_WAYS - 1].hash = h;
+	set[IX_WAYS - 1].obj_id = obj_id;
+	set[IX_WAYS - 1].pix = pix;
+	promote(set, IX_WAYS - 1);
+}
+
+/* Empties the table, the next lookup fills it again. */
+void
+spiffs_name_ix_clear(void)
+{
+	int s, w;
+
+	for (s = 0; s < IX_SETS; s++)
+		for (w = 0; w < IX_WAYS; w++)
+			ix_table[s][w].obj_id = IX_EMPTY;
+	ix_state = IX_UNBUILT;
+}
+
+/*
+ * Starts filling an empty table through spiffs_name_ix_add().  Returns
+ * 0 if the table is already in use.
+ */
+int
+spiffs_name_ix_start(void)
+{
+	if (ix_state != IX_UNBUILT)
+		return 0;
+	ix_state = IX_COMPLETE;
+	return 1;
+}
+
+/* Whether a miss in spiffs_name_ix_find() means there is no such file. */
+int
+spiffs_name_ix_complete(void)
+{
+	return ix_state == IX_COMPLETE;
+}
+
+/*
+ * Looks "name" up in the table, filling it first if need be, and checks
+ * the hit against the header on the flash.  Returns SPIFFS_ERR_NOT_FOUND
+ * on a miss; unless spiffs_name_ix_complete() the caller has to search.
+ */
+s32_t
+spiffs_name_ix_find(spiffs *fs, const u8_t *name, spiffs_page_ix *pix)
+{
+	spiffs_page_object_ix_header hdr;
+	u32_t h = name_hash(name);
+	struct ix_entry *set = ix_table[h % IX_SETS];
+	s32_t res;
+	int live, w;
+
+	if (ix_state == IX_UNBUILT) {
+#if SPIFFS_DIR_INDEX
+		/* Fills this table too, reading the headers once */
+		res = spiffs_dir_ix_build(fs);
+#else
+		res = spiffs_name_ix_build(fs);
+#endif
+		SPIFFS_CHECK_RES(res);
+	}
+	for (w = 0; w < IX_WAYS && set[w].obj_id != IX_EMPTY; w++) {
+		if (set[w].hash != h)
+			continue;
+		res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ, 0,
+		    SPIFFS_PAGE_TO_PADDR(fs, set[w].pix), sizeof(hdr),
+		    (u8_t *)&hdr);
+		SPIFFS_CHECK_RES(res);
+		live = hdr.p_hdr.obj_id ==
+		    (set[w].obj_id | SPIFFS_OBJ_ID_IX_FLAG) &&
+		    hdr.p_hdr.span_ix == 0 &&
+		    (hdr.p_hdr.flags & (SPIFFS_PH_FLAG_DELET |
+		    SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_IXDELE)) ==
+		    (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_IXDELE);
+		if (live && strncmp((const char *)name, (const char *)hdr.name,
+		    SPIFFS_OBJ_NAME_LEN) == 0) {
+			if (pix)
+				*pix = set[w].pix;
+			promote(set, w);
+			return SPIFFS_OK;
+		}
+		if (live)
+			continue;	/* Same hash, other name */
+		/* Stale, an event was missed */
+		remove_id(set[w].obj_id);
+		ix_state = IX_PARTIAL;
+		w--;
+	}
+	return SPIFFS_ERR_NOT_FOUND;
+}
+
+static s32_t
+build_v(spiffs *fs, spiffs_obj_id obj_id, spiffs_block_ix bix, int ix_entry,
+    const void *user_const_p, void *user_var_p)
+{
+	spiffs_page_object_ix_header hdr;
+	spiffs_page_ix pix = SPIFFS_OBJ_LOOKUP_ENTRY_TO_PIX(fs, bix, ix_entry);
+	s32_t res;
+
+	(void)user_const_p;
+	(void)user_var_p;
+	if (obj_id == SPIFFS_OBJ_ID_FREE || obj_id == SPIFFS_OBJ_ID_DELETED ||
+	    (obj_id & SPIFFS_OBJ_ID_IX_FLAG) == 0)
+		return SPIFFS_VIS_COUNTINUE;
+	res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ, 0,
+	    SPIFFS_PAGE_TO_PADDR(fs, pix), sizeof(hdr), (u8_t *)&hdr);
+	SPIFFS_CHECK_RES(res);
+	if (hdr.p_hdr.span_ix == 0 &&
+	    (hdr.p_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_FINAL |
+	    SPIFFS_PH_FLAG_IXDELE)) ==
+	    (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_IXDELE))
+		spiffs_name_ix_add(hdr.name, obj_id, pix);
+	return SPIFFS_VIS_COUNTINUE;
+}
+
+/* Fills the table from the index headers on the flash. */
+s32_t
+spiffs_name_ix_build(spiffs *fs)
+{
+	s32_t res;
+
+	spiffs_name_ix_clear();
+	(void)spiffs_name_ix_start();
+	res = spiffs_obj_lu_find_entry_visitor(fs, 0, 0, 0, 0, build_v, 0, 0,
+	    0, 0);
+	if (res != SPIFFS_VIS_END) {
+		spiffs_name_ix_clear();
+		return res;
+	}
+	return SPIFFS_OK;
+}
+
+/* Follows creates, renames, moves and removals of index headers. */
+void
+spiffs_name_ix_event(spiffs_page_object_ix *objix, int ev,
+    spiffs_obj_id obj_id, spiffs_span_ix spix, spiffs_page_ix pix)
+{
+	int s, w;
+
+	if (ix_state == IX_UNBUILT || spix != 0 || (objix == 0 &&
+	    ev != SPIFFS_EV_IX_MOV && ev != SPIFFS_EV_IX_DEL))
+		return;
+	obj_id &= ~SPIFFS_OBJ_ID_IX_FLAG;
+	switch (ev) {
+	case SPIFFS_EV_IX_NEW:
+	case SPIFFS_EV_IX_UPD:
+	case SPIFFS_EV_IX_UPD_HDR:
+		/* A header with its name, which may have changed */
+		spiffs_name_ix_add(((spiffs_page_object_ix_header *)objix)->name,
+		    obj_id, pix);
+		break;
+	case SPIFFS_EV_IX_MOV:
+		/* Only the page header is passed along */
+		move_id(obj_id, pix);
+		break;
+	case SPIFFS_EV_IX_DEL:
+		/*
+		 * Only for the page the table has: gc also wipes stale
+		 * copies of a header, and a miss may be taken as final.
+		 */
+		for (s = 0; s < IX_SETS; s++)
+			for (w = 0; w < IX_WAYS; w++)
+				if (ix_table[s][w].obj_id == obj_id &&
+				    ix_table[s][w].pix == pix)
+					remove_id(obj_id);
+		break;
+	}
+}
+
+#endif /* SPIFFS_NAME_INDEX */
@@ -29,6 +29,28 @@ static s32_t spiffs_page_data_check(spiffs *fs, spiffs_fd *fd, spiffs_page_ix pi
   return res;
 }
 
+#if !SPIFFS_READ_ONLY
+// Returns 1 if data can be programmed over what is at addr, 0 if a write
+// cut off by power loss left zeroes there that data would need as ones
+static s32_t spiffs_phys_programmable(spiffs *fs, spiffs_file fh, u32_t addr, u32_t len, const u8_t *data) {
+  s32_t res;
+  u8_t b[SPIFFS_COPY_BUFFER_STACK];
+  while (len > 0) {
+    u32_t chunk_size = MIN(SPIFFS_COPY_BUFFER_STACK, len);
+    u32_t i;
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_READ, fh, addr, chunk_size, b);
+    SPIFFS_CHECK_RES(res);
+    for (i = 0; i < chunk_size; i++) {
+      if ((b[i] & data[i]) != data[i]) return 0;
+    }
+    len -= chunk_size;
+    addr += chunk_size;
+    data += chunk_size;
+  }
+  return 1;
+}
+#endif // !SPIFFS_READ_ONLY
+
 #if !SPIFFS_READ_ONLY
 static s32_t spiffs_page_index_check(spiffs *fs, spiffs_fd *fd, spiffs_page_ix pix, spiffs_span_ix spix) {
   s32_t res = SPIFFS_OK;
@@ -239,6 +261,9 @@ s32_t spiffs_erase_block(
     size -= SPIFFS_CFG_PHYS_ERASE_SZ(fs);
   }
   fs->free_blocks++;
+#if SPIFFS_WEAR_LEVEL
+  spiffs_wear_erased(fs, bix);
+#endif
 
   // register erase count for this block
   res = _spiffs_wr(fs, SPIFFS_OP_C_WRTHRU | SPIFFS_OP_T_OBJ_LU2, 0,
@@ -498,6 +523,12 @@ s32_t spiffs_obj_lu_find_id(
 }
 
 
+typedef struct {
+  spiffs_span_ix spix;
+  // first source of a gc move found, 0 if none
+  spiffs_page_ix moving_pix;
+} spiffs_find_id_span;
+
 static s32_t spiffs_obj_lu_find_id_and_span_v(
     spiffs *fs,
     spiffs_obj_id obj_id,
@@ -508,20 +539,51 @@ static s32_t spiffs_obj_lu_find_id_and_span_v(
   s32_t res;
   spiffs_page_header ph;
   spiffs_page_ix pix = SPIFFS_OBJ_LOOKUP_ENTRY_TO_PIX(fs, bix, ix_entry);
+  spiffs_find_id_span *find = (spiffs_find_id_span *)user_var_p;
   res = _spiffs_rd(fs, 0, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
       SPIFFS_PAGE_TO_PADDR(fs, pix), sizeof(spiffs_page_header), (u8_t *)&ph);
   SPIFFS_CHECK_RES(res);
   if (ph.obj_id == obj_id &&
-      ph.span_ix == *((spiffs_span_ix*)user_var_p) &&
+      ph.span_ix == find->spix &&
       (ph.flags & (SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_USED)) == SPIFFS_PH_FLAG_DELET &&
       !((obj_id & SPIFFS_OBJ_ID_IX_FLAG) && (ph.flags & SPIFFS_PH_FLAG_IXDELE) == 0 && ph.span_ix == 0) &&
       (user_const_p == 0 || *((const spiffs_page_ix*)user_const_p) != pix)) {
+    if ((ph.flags & SPIFFS_PH_FLAG_MOVING) == 0) {
+      // the source of a gc move cut off by power loss, the copy wins if
+      // it got written
+      if (find->moving_pix == 0) {
+        find->moving_pix = pix;
+      }
+      return SPIFFS_VIS_COUNTINUE;
+    }
     return SPIFFS_OK;
   } else {
     return SPIFFS_VIS_COUNTINUE;
   }
 }
 
+// Settles a search for an id and span: if only the source of a gc move
+// turned up it is the one
+static s32_t spiffs_obj_lu_find_id_and_span_end(
+    spiffs *fs,
+    s32_t res,
+    spiffs_find_id_span *find,
+    spiffs_block_ix *bix,
+    int *entry) {
+#if SPIFFS_SINGLETON
+  (void)fs;
+#endif
+  if (res == SPIFFS_VIS_END && find->moving_pix != 0) {
+    *bix = SPIFFS_BLOCK_FOR_PAGE(fs, find->moving_pix);
+    *entry = SPIFFS_OBJ_LOOKUP_ENTRY_FOR_PAGE(fs, find->moving_pix);
+    res = SPIFFS_OK;
+  }
+  if (res == SPIFFS_VIS_END) {
+    res = SPIFFS_ERR_NOT_FOUND;
+  }
+  return res;
+}
+
 // Find object lookup entry containing given id and span index
 // Iterate over object lookup pages in each block until a given object id entry is found
 s32_t spiffs_obj_lu_find_id_and_span(
@@ -533,7 +595,10 @@ s32_t spiffs_obj_lu_find_id_and_span(
   s32_t res;
   spiffs_block_ix bix;
   int entry;
+  spiffs_find_id_span find;
 
+  find.spix = spix;
+  find.moving_pix = 0;
   res = spiffs_obj_lu_find_entry_visitor(fs,
       fs->cursor_block_ix,
       fs->cursor_obj_lu_entry,
@@ -541,13 +606,10 @@ s32_t spiffs_obj_lu_find_id_and_span(
       obj_id,
       spiffs_obj_lu_find_id_and_span_v,
       exclusion_pix ? &exclusion_pix : 0,
-      &spix,
+      &find,
       &bix,
       &entry);
-
-  if (res == SPIFFS_VIS_END) {
-    res = SPIFFS_ERR_NOT_FOUND;
-  }
+  res = spiffs_obj_lu_find_id_and_span_end(fs, res, &find, &bix, &entry);
 
   SPIFFS_CHECK_RES(res);
 
@@ -572,7 +634,10 @@ s32_t spiffs_obj_lu_find_id_and_span_by_phdr(
   s32_t res;
   spiffs_block_ix bix;
   int entry;
+  spiffs_find_id_span find;
 
+  find.spix = spix;
+  find.moving_pix = 0;
   res = spiffs_obj_lu_find_entry_visitor(fs,
       fs->cursor_block_ix,
       fs->cursor_obj_lu_entry,
@@ -580,13 +645,10 @@ s32_t spiffs_obj_lu_find_id_and_span_by_phdr(
       obj_id,
       spiffs_obj_lu_find_id_and_span_v,
       exclusion_pix ? &exclusion_pix : 0,
-      &spix,
+      &find,
       &bix,
       &entry);
-
-  if (res == SPIFFS_VIS_END) {
-    res = SPIFFS_ERR_NOT_FOUND;
-  }
+  res = spiffs_obj_lu_find_id_and_span_end(fs, res, &find, &bix, &entry);
 
   SPIFFS_CHECK_RES(res);
 
@@ -694,6 +756,9 @@ static s32_t spiffs_populate_ix_map_v(
     SPIFFS_CHECK_RES(res);
 
     spiffs_update_ix_map(fs, state->fd, objix->p_hdr.span_ix, objix);
+#if SPIFFS_IX_MAP_AUTO
+    spiffs_ix_auto_objix(fs, state->fd, objix->p_hdr.span_ix, pix);
+#endif
 
     state->remaining_objix_pages_to_visit--;
     SPIFFS_DBG("map "_SPIPRIid" ("_SPIPRIsp"--"_SPIPRIsp") remaining objix pages "_SPIPRIi"\n",
@@ -714,7 +779,7 @@ s32_t spiffs_populate_ix_map(spiffs *fs, spiffs_fd *fd, u32_t vec_entry_start, u
   spiffs_ix_map *map = fd->ix_map;
   spiffs_ix_map_populate_state state;
   vec_entry_start = MIN((map->end_spix - map->start_spix + 1) - 1, (s32_t)vec_entry_start);
-  vec_entry_end = MAX((map->end_spix - map->start_spix + 1) - 1, (s32_t)vec_entry_end);
+  vec_entry_end = MIN((map->end_spix - map->start_spix + 1) - 1, (s32_t)vec_entry_end);
   if (vec_entry_start > vec_entry_end) {
     return SPIFFS_ERR_IX_MAP_BAD_RANGE;
   }
@@ -743,6 +808,65 @@ s32_t spiffs_populate_ix_map(spiffs *fs, spiffs_fd *fd, u32_t vec_entry_start, u
   return res;
 }
 
+// attaches map to fd and fills it, see SPIFFS_ix_map
+s32_t spiffs_ix_map_fd(spiffs *fs, spiffs_fd *fd, spiffs_ix_map *map,
+    u32_t offset, u32_t len, spiffs_page_ix *map_buf) {
+  map->map_buf = map_buf;
+  map->offset = offset;
+  // nb: spix range includes last
+  map->start_spix = offset / SPIFFS_DATA_PAGE_SIZE(fs);
+  map->end_spix = (offset + len) / SPIFFS_DATA_PAGE_SIZE(fs);
+  memset(map_buf, 0, sizeof(spiffs_page_ix) * (map->end_spix - map->start_spix + 1));
+  fd->ix_map = map;
+
+  // scan for pixes
+  return spiffs_populate_ix_map(fs, fd, 0, map->end_spix - map->start_spix);
+}
+
+// moves the map of fd to offset, see SPIFFS_ix_remap
+s32_t spiffs_ix_remap_fd(spiffs *fs, spiffs_fd *fd, u32_t offset) {
+  s32_t res = SPIFFS_OK;
+  spiffs_ix_map *map = fd->ix_map;
+
+  s32_t spix_diff = offset / SPIFFS_DATA_PAGE_SIZE(fs) - map->start_spix;
+  map->offset = offset;
+
+  // move existing pixes if within map offs
+  if (spix_diff != 0) {
+    // move vector
+    int i;
+    const s32_t vec_len = map->end_spix - map->start_spix + 1; // spix range includes last
+    map->start_spix += spix_diff;
+    map->end_spix += spix_diff;
+    if (spix_diff >= vec_len || -spix_diff >= vec_len) {
+      // moving beyond range
+      memset(map->map_buf, 0, vec_len * sizeof(spiffs_page_ix));
+      // populate_ix_map is inclusive
+      res = spiffs_populate_ix_map(fs, fd, 0, vec_len-1);
+    } else if (spix_diff > 0) {
+      // diff positive
+      for (i = 0; i < vec_len - spix_diff; i++) {
+        map->map_buf[i] = map->map_buf[i + spix_diff];
+      }
+      // memset is non-inclusive
+      memset(&map->map_buf[vec_len - spix_diff], 0, spix_diff * sizeof(spiffs_page_ix));
+      // populate_ix_map is inclusive
+      res = spiffs_populate_ix_map(fs, fd, vec_len - spix_diff, vec_len-1);
+    } else {
+      // diff negative
+      for (i = vec_len - 1; i >= -spix_diff; i--) {
+        map->map_buf[i] = map->map_buf[i + spix_diff];
+      }
+      // memset is non-inclusive
+      memset(&map->map_buf[0], 0, -spix_diff * sizeof(spiffs_page_ix));
+      // populate_ix_map is inclusive
+      res = spiffs_populate_ix_map(fs, fd, 0, -spix_diff - 1);
+    }
+  }
+
+  return res;
+}
+
 #endif
 
 
@@ -774,11 +898,27 @@ s32_t spiffs_page_allocate_data(
 
   fs->stats_p_allocated++;
 
-  // write page header
   ph->flags &= ~SPIFFS_PH_FLAG_USED;
-  res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
-      0, SPIFFS_OBJ_LOOKUP_ENTRY_TO_PADDR(fs, bix, entry), sizeof(spiffs_page_header), (u8_t*)ph);
-  SPIFFS_CHECK_RES(res);
+#if SPIFFS_MERGE_DATA_WRITES
+  if (data && sizeof(spiffs_page_header) + page_offs + len <= SPIFFS_COPY_BUFFER_STACK) {
+    // write page header and data in one program, the page is not final yet
+    u8_t b[SPIFFS_COPY_BUFFER_STACK];
+    memcpy(b, ph, sizeof(spiffs_page_header));
+    memset(&b[sizeof(spiffs_page_header)], 0xff, page_offs);
+    memcpy(&b[sizeof(spiffs_page_header) + page_offs], data, len);
+    res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+        0, SPIFFS_OBJ_LOOKUP_ENTRY_TO_PADDR(fs, bix, entry),
+        sizeof(spiffs_page_header) + page_offs + len, b);
+    SPIFFS_CHECK_RES(res);
+    data = 0;
+  } else
+#endif
+  {
+    // write page header
+    res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+        0, SPIFFS_OBJ_LOOKUP_ENTRY_TO_PADDR(fs, bix, entry), sizeof(spiffs_page_header), (u8_t*)ph);
+    SPIFFS_CHECK_RES(res);
+  }
 
   // write page data
   if (data) {
@@ -807,9 +947,10 @@ s32_t spiffs_page_allocate_data(
 #endif // !SPIFFS_READ_ONLY
 
 #if !SPIFFS_READ_ONLY
-// Moves a page from src to a free page and finalizes it. Updates page index. Page data is given in param page.
-// If page data is null, provided header is used for metainfo and page data is physically copied.
-s32_t spiffs_page_move(
+// Copies a page from src to a free page and finalizes it, leaving src as
+// it is. Page data is given in param page. If page data is null, provided
+// header is used for metainfo and page data is physically copied.
+s32_t spiffs_page_copy(
     spiffs *fs,
     spiffs_file fh,
     u8_t *page_data,
@@ -831,12 +972,22 @@ s32_t spiffs_page_move(
 
   if (dst_pix) *dst_pix = free_pix;
 
+  // mark entry in destination object lookup first, power loss must not leave
+  // a written page behind a free entry
+  res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_UPDT,
+      0, SPIFFS_BLOCK_TO_PADDR(fs, SPIFFS_BLOCK_FOR_PAGE(fs, free_pix)) + SPIFFS_OBJ_LOOKUP_ENTRY_FOR_PAGE(fs, free_pix) * sizeof(spiffs_page_ix),
+      sizeof(spiffs_obj_id),
+      (u8_t *)&obj_id);
+  SPIFFS_CHECK_RES(res);
+
+  fs->stats_p_allocated++;
+
   p_hdr = page_data ? (spiffs_page_header *)page_data : page_hdr;
   if (page_data) {
     // got page data
     was_final = (p_hdr->flags & SPIFFS_PH_FLAG_FINAL) == 0;
-    // write unfinalized page
-    p_hdr->flags |= SPIFFS_PH_FLAG_FINAL;
+    // write unfinalized page, which is not the source of a move
+    p_hdr->flags |= SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_MOVING;
     p_hdr->flags &= ~SPIFFS_PH_FLAG_USED;
     res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
         0, SPIFFS_PAGE_TO_PADDR(fs, free_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), page_data);
@@ -846,15 +997,6 @@ s32_t spiffs_page_move(
   }
   SPIFFS_CHECK_RES(res);
 
-  // mark entry in destination object lookup
-  res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_UPDT,
-      0, SPIFFS_BLOCK_TO_PADDR(fs, SPIFFS_BLOCK_FOR_PAGE(fs, free_pix)) + SPIFFS_OBJ_LOOKUP_ENTRY_FOR_PAGE(fs, free_pix) * sizeof(spiffs_page_ix),
-      sizeof(spiffs_obj_id),
-      (u8_t *)&obj_id);
-  SPIFFS_CHECK_RES(res);
-
-  fs->stats_p_allocated++;
-
   if (was_final) {
     // mark finalized in destination page
     p_hdr->flags &= ~(SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_USED);
@@ -865,6 +1007,21 @@ s32_t spiffs_page_move(
         (u8_t *)&p_hdr->flags);
     SPIFFS_CHECK_RES(res);
   }
+  return res;
+}
+
+// Moves a page from src to a free page and finalizes it. Updates page index. Page data is given in param page.
+// If page data is null, provided header is used for metainfo and page data is physically copied.
+s32_t spiffs_page_move(
+    spiffs *fs,
+    spiffs_file fh,
+    u8_t *page_data,
+    spiffs_obj_id obj_id,
+    spiffs_page_header *page_hdr,
+    spiffs_page_ix src_pix,
+    spiffs_page_ix *dst_pix) {
+  s32_t res = spiffs_page_copy(fs, fh, page_data, obj_id, page_hdr, src_pix, dst_pix);
+  SPIFFS_CHECK_RES(res);
   // mark source deleted
   res = spiffs_page_delete(fs, src_pix);
   return res;
@@ -936,10 +1093,13 @@ s32_t spiffs_object_create(
   // write empty object index page
   oix_hdr.p_hdr.obj_id = obj_id;
   oix_hdr.p_hdr.span_ix = 0;
-  oix_hdr.p_hdr.flags = 0xff & ~(SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED);
+  // finalized once written, power loss may cut the name short
+  oix_hdr.p_hdr.flags = 0xff & ~(SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED);
   oix_hdr.type = type;
   oix_hdr.size = SPIFFS_UNDEFINED_LEN; // keep ones so we can update later without wasting this page
-  strncpy((char*)oix_hdr.name, (const char*)name, SPIFFS_OBJ_NAME_LEN);
+  // zero padded like strncpy, spelled out as a full length name is not terminated
+  memset(oix_hdr.name, 0, SPIFFS_OBJ_NAME_LEN);
+  memcpy(oix_hdr.name, name, strnlen((const char*)name, SPIFFS_OBJ_NAME_LEN));
 #if SPIFFS_OBJ_META_LEN
   if (meta) {
     memcpy(oix_hdr.meta, meta, SPIFFS_OBJ_META_LEN);
@@ -953,6 +1113,11 @@ s32_t spiffs_object_create(
   // update page
   res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
       0, SPIFFS_OBJ_LOOKUP_ENTRY_TO_PADDR(fs, bix, entry), sizeof(spiffs_page_object_ix_header), (u8_t*)&oix_hdr);
+  SPIFFS_CHECK_RES(res);
+  oix_hdr.p_hdr.flags &= ~SPIFFS_PH_FLAG_FINAL;
+  res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+      0, SPIFFS_OBJ_LOOKUP_ENTRY_TO_PADDR(fs, bix, entry) + offsetof(spiffs_page_header, flags),
+      sizeof(u8_t), (u8_t*)&oix_hdr.p_hdr.flags);
 
   SPIFFS_CHECK_RES(res);
   spiffs_cb_object_event(fs, (spiffs_page_object_ix *)&oix_hdr,
@@ -1002,7 +1167,8 @@ s32_t spiffs_object_update_index_hdr(
 
   // change name
   if (name) {
-    strncpy((char*)objix_hdr->name, (const char*)name, SPIFFS_OBJ_NAME_LEN);
+    memset(objix_hdr->name, 0, SPIFFS_OBJ_NAME_LEN);
+    memcpy(objix_hdr->name, name, strnlen((const char*)name, SPIFFS_OBJ_NAME_LEN));
   }
 #if SPIFFS_OBJ_META_LEN
   if (meta) {
@@ -1075,6 +1241,10 @@ void spiffs_cb_object_event(
         cur_fd->cursor_objix_pix = 0;
       }
     }
+#if SPIFFS_IX_MAP_AUTO
+    spiffs_ix_auto_objix(fs, cur_fd, spix,
+        ev != SPIFFS_EV_IX_DEL ? new_pix : 0);
+#endif
   }
 
 #if SPIFFS_IX_MAP
@@ -1094,6 +1264,13 @@ void spiffs_cb_object_event(
 
 #endif
 
+#if SPIFFS_NAME_INDEX
+  spiffs_name_ix_event(objix, ev, obj_id_raw, spix, new_pix);
+#endif
+#if SPIFFS_DIR_INDEX
+  spiffs_dir_ix_event(objix, ev, obj_id_raw, spix, new_pix);
+#endif
+
   // callback to user if object index header
   if (fs->file_cb_f && spix == 0 && (obj_id_raw & SPIFFS_OBJ_ID_IX_FLAG)) {
     spiffs_fileop_type op;
@@ -1170,6 +1347,62 @@ s32_t spiffs_object_open_by_page(
 }
 
 #if !SPIFFS_READ_ONLY
+// Writes the object index page in fs->work over its old version at pix, or
+// moves it to a new page if a write cut off by power loss left the old one
+// unfit to program over
+static s32_t spiffs_object_index_store(spiffs *fs, spiffs_fd *fd, spiffs_page_ix *pix) {
+  s32_t res = spiffs_phys_programmable(fs, fd->file_nbr,
+      SPIFFS_PAGE_TO_PADDR(fs, *pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+  SPIFFS_CHECK_RES(res);
+  if (res == 1) {
+    return _spiffs_wr(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_UPDT,
+        fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, *pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+  }
+  return spiffs_page_move(fs, fd->file_nbr, fs->work, fd->obj_id, 0, *pix, pix);
+}
+
+// Deletes pix if it still holds live data of span spix of the object, as
+// pages past the end that an append or truncate cut off by power loss
+// left behind do
+static s32_t spiffs_object_drop_stale(spiffs *fs, spiffs_fd *fd, spiffs_page_ix pix, spiffs_span_ix spix) {
+  spiffs_page_header p_hdr;
+  s32_t res;
+  if (pix == (spiffs_page_ix)SPIFFS_OBJ_ID_FREE || pix >= SPIFFS_MAX_PAGES(fs) ||
+      SPIFFS_IS_LOOKUP_PAGE(fs, pix)) {
+    return SPIFFS_OK;
+  }
+  res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+      fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, pix), sizeof(spiffs_page_header), (u8_t *)&p_hdr);
+  SPIFFS_CHECK_RES(res);
+  if (p_hdr.obj_id != (fd->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG) || p_hdr.span_ix != spix ||
+      (p_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX | SPIFFS_PH_FLAG_USED | SPIFFS_PH_FLAG_FINAL)) !=
+          (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_INDEX)) {
+    return SPIFFS_OK;
+  }
+  SPIFFS_DBG("stale: "_SPIPRIid" delete data page "_SPIPRIpg":"_SPIPRIsp"\n", fd->obj_id, pix, spix);
+  return spiffs_page_delete(fs, pix);
+}
+
+// Deletes the object index page pix past the end and the data it refers to
+static s32_t spiffs_object_drop_stale_index(spiffs *fs, spiffs_fd *fd, spiffs_page_ix pix, spiffs_span_ix objix_spix) {
+  spiffs_page_ix entries[16];
+  spiffs_span_ix data_spix = SPIFFS_DATA_SPAN_IX_FOR_OBJ_IX_SPAN_IX(fs, objix_spix);
+  u32_t i, j, n;
+  s32_t res;
+  for (i = 0; i < SPIFFS_OBJ_IX_LEN(fs); i += n) {
+    n = MIN(sizeof(entries) / sizeof(entries[0]), SPIFFS_OBJ_IX_LEN(fs) - i);
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ,
+        fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, pix) + sizeof(spiffs_page_object_ix) + i * sizeof(spiffs_page_ix),
+        n * sizeof(spiffs_page_ix), (u8_t *)entries);
+    SPIFFS_CHECK_RES(res);
+    for (j = 0; j < n; j++) {
+      res = spiffs_object_drop_stale(fs, fd, entries[j], data_spix + i + j);
+      SPIFFS_CHECK_RES(res);
+    }
+  }
+  return spiffs_page_delete(fs, pix);
+}
+
 // Append to object
 // keep current object index (header) page in fs->work buffer
 s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
@@ -1223,11 +1456,17 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
             // was an empty object, update same page (size was 0xffffffff)
             res = spiffs_page_index_check(fs, fd, cur_objix_pix, 0);
             SPIFFS_CHECK_RES(res);
+            res = spiffs_phys_programmable(fs, fd->file_nbr,
+                SPIFFS_PAGE_TO_PADDR(fs, cur_objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+            SPIFFS_CHECK_RES(res);
+          }
+          if (offset == 0 && res == 1) {
             res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_UPDT,
                 fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, cur_objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
             SPIFFS_CHECK_RES(res);
           } else {
-            // was a nonempty object, update to new page
+            // was a nonempty object, or an append to the empty one was cut
+            // off, update to new page
             res = spiffs_object_update_index_hdr(fs, fd, fd->obj_id,
                 fd->objix_hdr_pix, fs->work, 0, 0, offset+written, &new_objix_hdr_page);
             SPIFFS_CHECK_RES(res);
@@ -1239,8 +1478,7 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
           res = spiffs_page_index_check(fs, fd, cur_objix_pix, prev_objix_spix);
           SPIFFS_CHECK_RES(res);
 
-          res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_UPDT,
-              fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, cur_objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+          res = spiffs_object_index_store(fs, fd, &cur_objix_pix);
           SPIFFS_CHECK_RES(res);
           spiffs_cb_object_event(fs, (spiffs_page_object_ix *)fs->work,
               SPIFFS_EV_IX_UPD,fd->obj_id, objix->p_hdr.span_ix, cur_objix_pix, 0);
@@ -1267,6 +1505,17 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
         spiffs_span_ix len_objix_spix = SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, (fd->size-1)/SPIFFS_DATA_PAGE_SIZE(fs));
         // on subsequent passes, create a new object index page
         if (written > 0 || cur_objix_spix > len_objix_spix) {
+          spiffs_page_ix stale_pix;
+          // an append or truncate cut off by power loss may have left an
+          // index page of this span past the end, it would hide the new one
+          while ((res = spiffs_obj_lu_find_id_and_span(fs, fd->obj_id | SPIFFS_OBJ_ID_IX_FLAG,
+              cur_objix_spix, 0, &stale_pix)) == SPIFFS_OK) {
+            res = spiffs_object_drop_stale_index(fs, fd, stale_pix, cur_objix_spix);
+            SPIFFS_CHECK_RES(res);
+          }
+          if (res != SPIFFS_ERR_NOT_FOUND) {
+            SPIFFS_CHECK_RES(res);
+          }
           p_hdr.obj_id = fd->obj_id | SPIFFS_OBJ_ID_IX_FLAG;
           p_hdr.span_ix = cur_objix_spix;
           p_hdr.flags = 0xff & ~(SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_INDEX);
@@ -1309,6 +1558,13 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
     u32_t to_write = MIN(len-written, SPIFFS_DATA_PAGE_SIZE(fs) - page_offs);
     if (page_offs == 0) {
       // at beginning of a page, allocate and write a new page of data
+      if (cur_objix_spix == 0) {
+        data_page = ((spiffs_page_ix*)((u8_t *)objix_hdr + sizeof(spiffs_page_object_ix_header)))[data_spix];
+      } else {
+        data_page = ((spiffs_page_ix*)((u8_t *)objix + sizeof(spiffs_page_object_ix)))[SPIFFS_OBJ_IX_ENTRY(fs, data_spix)];
+      }
+      res = spiffs_object_drop_stale(fs, fd, data_page, data_spix);
+      if (res != SPIFFS_OK) break;
       p_hdr.obj_id = fd->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
       p_hdr.span_ix = data_spix;
       p_hdr.flags = 0xff & ~(SPIFFS_PH_FLAG_FINAL);  // finalize immediately
@@ -1329,8 +1585,41 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
       res = spiffs_page_data_check(fs, fd, data_page, data_spix);
       SPIFFS_CHECK_RES(res);
 
-      res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
-          fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, data_page) + sizeof(spiffs_page_header) + page_offs, to_write, &data[written]);
+      res = spiffs_phys_programmable(fs, fd->file_nbr,
+          SPIFFS_PAGE_TO_PADDR(fs, data_page) + sizeof(spiffs_page_header) + page_offs, to_write, &data[written]);
+      if (res < SPIFFS_OK) break;
+      if (res == 0) {
+        // an append cut off by power loss left bytes past the end, copy
+        // the page instead
+        spiffs_page_ix new_data_page;
+        p_hdr.obj_id = fd->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG;
+        p_hdr.span_ix = data_spix;
+        p_hdr.flags = 0xff;
+        res = spiffs_page_allocate_data(fs, fd->obj_id & ~SPIFFS_OBJ_ID_IX_FLAG,
+            &p_hdr, 0, 0, 0, 0, &new_data_page);
+        if (res != SPIFFS_OK) break;
+        res = spiffs_phys_cpy(fs, fd->file_nbr,
+            SPIFFS_PAGE_TO_PADDR(fs, new_data_page) + sizeof(spiffs_page_header),
+            SPIFFS_PAGE_TO_PADDR(fs, data_page) + sizeof(spiffs_page_header),
+            page_offs);
+        if (res != SPIFFS_OK) break;
+        res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+            fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, new_data_page) + sizeof(spiffs_page_header) + page_offs, to_write, &data[written]);
+        if (res != SPIFFS_OK) break;
+        p_hdr.flags &= ~SPIFFS_PH_FLAG_FINAL;
+        res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+            fd->file_nbr,
+            SPIFFS_PAGE_TO_PADDR(fs, new_data_page) + offsetof(spiffs_page_header, flags),
+            sizeof(u8_t),
+            (u8_t *)&p_hdr.flags);
+        if (res != SPIFFS_OK) break;
+        res = spiffs_page_delete(fs, data_page);
+        SPIFFS_DBG("append: "_SPIPRIid" moved unclean data page "_SPIPRIpg" to "_SPIPRIpg"\n", fd->obj_id, data_page, new_data_page);
+        data_page = new_data_page;
+      } else {
+        res = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_DA | SPIFFS_OP_C_UPDT,
+            fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, data_page) + sizeof(spiffs_page_header) + page_offs, to_write, &data[written]);
+      }
       SPIFFS_DBG("append: "_SPIPRIid" store to existing data page, "_SPIPRIpg":"_SPIPRIsp" offset:"_SPIPRIi", len "_SPIPRIi", written "_SPIPRIi"\n", fd->obj_id
           , data_page, data_spix, page_offs, to_write, written);
     }
@@ -1373,9 +1662,9 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
     res2 = spiffs_page_index_check(fs, fd, cur_objix_pix, cur_objix_spix);
     SPIFFS_CHECK_RES(res2);
 
-    res2 = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_UPDT,
-        fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, cur_objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+    res2 = spiffs_object_index_store(fs, fd, &cur_objix_pix);
     SPIFFS_CHECK_RES(res2);
+    fd->cursor_objix_pix = cur_objix_pix;
     spiffs_cb_object_event(fs, (spiffs_page_object_ix *)fs->work,
         SPIFFS_EV_IX_UPD, fd->obj_id, objix->p_hdr.span_ix, cur_objix_pix, 0);
 
@@ -1396,6 +1685,11 @@ s32_t spiffs_object_append(spiffs_fd *fd, u32_t offset, u8_t *data, u32_t len) {
       res2 = spiffs_page_index_check(fs, fd, cur_objix_pix, cur_objix_spix);
       SPIFFS_CHECK_RES(res2);
 
+      res2 = spiffs_phys_programmable(fs, fd->file_nbr,
+          SPIFFS_PAGE_TO_PADDR(fs, cur_objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+      SPIFFS_CHECK_RES(res2);
+    }
+    if (offset == 0 && res2 == 1) {
       res2 = _spiffs_wr(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_UPDT,
           fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, cur_objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
       SPIFFS_CHECK_RES(res2);
@@ -1628,7 +1922,6 @@ static s32_t spiffs_object_find_object_index_header_by_name_v(
     int ix_entry,
     const void *user_const_p,
     void *user_var_p) {
-  (void)user_var_p;
   s32_t res;
   spiffs_page_object_ix_header objix_hdr;
   spiffs_page_ix pix = SPIFFS_OBJ_LOOKUP_ENTRY_TO_PIX(fs, bix, ix_entry);
@@ -1643,6 +1936,9 @@ static s32_t spiffs_object_find_object_index_header_by_name_v(
       (objix_hdr.p_hdr.flags & (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_FINAL | SPIFFS_PH_FLAG_IXDELE)) ==
           (SPIFFS_PH_FLAG_DELET | SPIFFS_PH_FLAG_IXDELE)) {
     if (strcmp((const char*)user_const_p, (char*)objix_hdr.name) == 0) {
+      if (user_var_p) {
+        *(spiffs_obj_id *)user_var_p = obj_id;
+      }
       return SPIFFS_OK;
     }
   }
@@ -1658,6 +1954,15 @@ s32_t spiffs_object_find_object_index_header_by_name(
   s32_t res;
   spiffs_block_ix bix;
   int entry;
+  spiffs_obj_id obj_id;
+
+#if SPIFFS_NAME_INDEX
+  // a miss is final while the index holds every header
+  res = spiffs_name_ix_find(fs, name, pix);
+  if (res != SPIFFS_ERR_NOT_FOUND || spiffs_name_ix_complete()) {
+    return res;
+  }
+#endif
 
   res = spiffs_obj_lu_find_entry_visitor(fs,
       fs->cursor_block_ix,
@@ -1666,7 +1971,7 @@ s32_t spiffs_object_find_object_index_header_by_name(
       0,
       spiffs_object_find_object_index_header_by_name_v,
       name,
-      0,
+      &obj_id,
       &bix,
       &entry);
 
@@ -1675,6 +1980,10 @@ s32_t spiffs_object_find_object_index_header_by_name(
   }
   SPIFFS_CHECK_RES(res);
 
+#if SPIFFS_NAME_INDEX
+  spiffs_name_ix_add(name, obj_id, SPIFFS_OBJ_LOOKUP_ENTRY_TO_PIX(fs, bix, entry));
+#endif
+
   if (pix) {
     *pix = SPIFFS_OBJ_LOOKUP_ENTRY_TO_PIX(fs, bix, entry);
   }
@@ -1738,10 +2047,6 @@ s32_t spiffs_object_truncate(
         res = spiffs_page_index_check(fs, fd, objix_pix, prev_objix_spix);
         SPIFFS_CHECK_RES(res);
 
-        res = spiffs_page_delete(fs, objix_pix);
-        SPIFFS_CHECK_RES(res);
-        spiffs_cb_object_event(fs, (spiffs_page_object_ix *)0,
-            SPIFFS_EV_IX_DEL, fd->obj_id, objix->p_hdr.span_ix, objix_pix, 0);
         if (prev_objix_spix > 0) {
           // Update object index header page, unless we totally want to remove the file.
           // If fully removing, we're not keeping consistency as good as when storing the header between chunks,
@@ -1749,6 +2054,8 @@ s32_t spiffs_object_truncate(
           // report ERR_FULL a la windows. We cannot have that.
           // Hence, take the risk - if aborted, a file check would free the lost pages and mend things
           // as the file is marked as fully deleted in the beginning.
+          // The size goes first so power loss never leaves it covering a
+          // deleted index page.
           if (remove_full == 0) {
             SPIFFS_DBG("truncate: update objix hdr page "_SPIPRIpg":"_SPIPRIsp" to size "_SPIPRIi"\n", fd->objix_hdr_pix, prev_objix_spix, cur_size);
             res = spiffs_object_update_index_hdr(fs, fd, fd->obj_id,
@@ -1757,6 +2064,11 @@ s32_t spiffs_object_truncate(
           }
           fd->size = cur_size;
         }
+
+        res = spiffs_page_delete(fs, objix_pix);
+        SPIFFS_CHECK_RES(res);
+        spiffs_cb_object_event(fs, (spiffs_page_object_ix *)0,
+            SPIFFS_EV_IX_DEL, fd->obj_id, prev_objix_spix, objix_pix, 0);
       }
       // load current object index (header) page
       if (cur_objix_spix == 0) {
@@ -1872,6 +2184,14 @@ s32_t spiffs_object_truncate(
   if (cur_objix_spix == 0) {
     // update object index header page
     if (cur_size == 0) {
+      // refs past the old size, left by a cut append or truncate, go with
+      // the header, else their pages outlive it under the same id
+      u32_t i;
+      for (i = 0; prev_objix_spix == 0 && i < SPIFFS_OBJ_HDR_IX_LEN(fs); i++) {
+        res = spiffs_object_drop_stale(fs, fd,
+            ((spiffs_page_ix*)((u8_t *)objix_hdr + sizeof(spiffs_page_object_ix_header)))[i], i);
+        SPIFFS_CHECK_RES(res);
+      }
       if (remove_full) {
         // remove object altogether
         SPIFFS_DBG("truncate: remove object index header page "_SPIPRIpg"\n", objix_pix);
@@ -1926,68 +2246,82 @@ s32_t spiffs_object_truncate(
 } // spiffs_object_truncate
 #endif // !SPIFFS_READ_ONLY
 
-s32_t spiffs_object_read(
+// Finds the data page of data_spix. The object index page it is in is loaded
+// into fs->work, unless it is *prev_objix_spix and so already there.
+static s32_t spiffs_object_find_data_page(
     spiffs_fd *fd,
-    u32_t offset,
-    u32_t len,
-    u8_t *dst) {
+    u32_t cur_offset,
+    spiffs_span_ix data_spix,
+    spiffs_span_ix *prev_objix_spix,
+    spiffs_page_ix *data_pix) {
   s32_t res = SPIFFS_OK;
   spiffs *fs = fd->fs;
   spiffs_page_ix objix_pix;
-  spiffs_page_ix data_pix;
-  spiffs_span_ix data_spix = offset / SPIFFS_DATA_PAGE_SIZE(fs);
-  u32_t cur_offset = offset;
   spiffs_span_ix cur_objix_spix;
-  spiffs_span_ix prev_objix_spix = (spiffs_span_ix)-1;
   spiffs_page_object_ix_header *objix_hdr = (spiffs_page_object_ix_header *)fs->work;
   spiffs_page_object_ix *objix = (spiffs_page_object_ix *)fs->work;
 
-  while (cur_offset < offset + len) {
 #if SPIFFS_IX_MAP
-    // check if we have a memory, index map and if so, if we're within index map's range
-    // and if so, if the entry is populated
-    if (fd->ix_map && data_spix >= fd->ix_map->start_spix && data_spix <= fd->ix_map->end_spix
-        && fd->ix_map->map_buf[data_spix - fd->ix_map->start_spix]) {
-      data_pix = fd->ix_map->map_buf[data_spix - fd->ix_map->start_spix];
-    } else {
+  // check if we have a memory, index map and if so, if we're within index map's range
+  // and if so, if the entry is populated
+  if (fd->ix_map && data_spix >= fd->ix_map->start_spix && data_spix <= fd->ix_map->end_spix
+      && fd->ix_map->map_buf[data_spix - fd->ix_map->start_spix]) {
+    *data_pix = fd->ix_map->map_buf[data_spix - fd->ix_map->start_spix];
+    return res;
+  }
 #endif
-      cur_objix_spix = SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, data_spix);
-      if (prev_objix_spix != cur_objix_spix) {
-        // load current object index (header) page
-        if (cur_objix_spix == 0) {
-          objix_pix = fd->objix_hdr_pix;
-        } else {
-          SPIFFS_DBG("read: find objix "_SPIPRIid":"_SPIPRIsp"\n", fd->obj_id, cur_objix_spix);
-          if (fd->cursor_objix_spix == cur_objix_spix) {
-            objix_pix = fd->cursor_objix_pix;
-          } else {
-            res = spiffs_obj_lu_find_id_and_span(fs, fd->obj_id | SPIFFS_OBJ_ID_IX_FLAG, cur_objix_spix, 0, &objix_pix);
-            SPIFFS_CHECK_RES(res);
-          }
-        }
-        SPIFFS_DBG("read: load objix page "_SPIPRIpg":"_SPIPRIsp" for data spix:"_SPIPRIsp"\n", objix_pix, cur_objix_spix, data_spix);
-        res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_READ,
-            fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+  cur_objix_spix = SPIFFS_OBJ_IX_ENTRY_SPAN_IX(fs, data_spix);
+  if (*prev_objix_spix != cur_objix_spix) {
+    // load current object index (header) page
+    if (cur_objix_spix == 0) {
+      objix_pix = fd->objix_hdr_pix;
+    } else {
+      SPIFFS_DBG("read: find objix "_SPIPRIid":"_SPIPRIsp"\n", fd->obj_id, cur_objix_spix);
+      if (fd->cursor_objix_spix == cur_objix_spix) {
+        objix_pix = fd->cursor_objix_pix;
+      } else {
+        res = spiffs_obj_lu_find_id_and_span(fs, fd->obj_id | SPIFFS_OBJ_ID_IX_FLAG, cur_objix_spix, 0, &objix_pix);
         SPIFFS_CHECK_RES(res);
-        SPIFFS_VALIDATE_OBJIX(objix->p_hdr, fd->obj_id, cur_objix_spix);
+      }
+    }
+    SPIFFS_DBG("read: load objix page "_SPIPRIpg":"_SPIPRIsp" for data spix:"_SPIPRIsp"\n", objix_pix, cur_objix_spix, data_spix);
+    res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_IX | SPIFFS_OP_C_READ,
+        fd->file_nbr, SPIFFS_PAGE_TO_PADDR(fs, objix_pix), SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->work);
+    SPIFFS_CHECK_RES(res);
+    SPIFFS_VALIDATE_OBJIX(objix->p_hdr, fd->obj_id, cur_objix_spix);
 
-        fd->offset = cur_offset;
-        fd->cursor_objix_pix = objix_pix;
-        fd->cursor_objix_spix = cur_objix_spix;
+    fd->offset = cur_offset;
+    fd->cursor_objix_pix = objix_pix;
+    fd->cursor_objix_spix = cur_objix_spix;
 
-        prev_objix_spix = cur_objix_spix;
-      }
+    *prev_objix_spix = cur_objix_spix;
+  }
 
-      if (cur_objix_spix == 0) {
-        // get data page from object index header page
-        data_pix = ((spiffs_page_ix*)((u8_t *)objix_hdr + sizeof(spiffs_page_object_ix_header)))[data_spix];
-      } else {
-        // get data page from object index page
-        data_pix = ((spiffs_page_ix*)((u8_t *)objix + sizeof(spiffs_page_object_ix)))[SPIFFS_OBJ_IX_ENTRY(fs, data_spix)];
-      }
-#if SPIFFS_IX_MAP
-    }
-#endif
+  if (cur_objix_spix == 0) {
+    // get data page from object index header page
+    *data_pix = ((spiffs_page_ix*)((u8_t *)objix_hdr + sizeof(spiffs_page_object_ix_header)))[data_spix];
+  } else {
+    // get data page from object index page
+    *data_pix = ((spiffs_page_ix*)((u8_t *)objix + sizeof(spiffs_page_object_ix)))[SPIFFS_OBJ_IX_ENTRY(fs, data_spix)];
+  }
+  return res;
+}
+
+s32_t spiffs_object_read(
+    spiffs_fd *fd,
+    u32_t offset,
+    u32_t len,
+    u8_t *dst) {
+  s32_t res = SPIFFS_OK;
+  spiffs *fs = fd->fs;
+  spiffs_page_ix data_pix;
+  spiffs_span_ix data_spix = offset / SPIFFS_DATA_PAGE_SIZE(fs);
+  u32_t cur_offset = offset;
+  spiffs_span_ix prev_objix_spix = (spiffs_span_ix)-1;
+
+  while (cur_offset < offset + len) {
+    res = spiffs_object_find_data_page(fd, cur_offset, data_spix, &prev_objix_spix, &data_pix);
+    SPIFFS_CHECK_RES(res);
     // all remaining data
     u32_t len_to_read = offset + len - cur_offset;
     // remaining data in page
@@ -2018,6 +2352,49 @@ s32_t spiffs_object_read(
   return res;
 }
 
+#if SPIFFS_READ_EXTENTS
+// Like spiffs_object_read, but instead of reading the data, describes
+// where it is as one extent per data page, at most n of them. Without
+// check the page headers are not read, the caller checks them.
+s32_t spiffs_object_read_extents(
+    spiffs_fd *fd,
+    u32_t offset,
+    u32_t len,
+    spiffs_extent *ext,
+    u32_t n,
+    u32_t *filled,
+    u8_t check) {
+  s32_t res = SPIFFS_OK;
+  spiffs *fs = fd->fs;
+  spiffs_page_ix data_pix;
+  spiffs_span_ix data_spix = offset / SPIFFS_DATA_PAGE_SIZE(fs);
+  u32_t cur_offset = offset;
+  spiffs_span_ix prev_objix_spix = (spiffs_span_ix)-1;
+
+  *filled = 0;
+  while (cur_offset < offset + len && *filled < n) {
+    res = spiffs_object_find_data_page(fd, cur_offset, data_spix, &prev_objix_spix, &data_pix);
+    SPIFFS_CHECK_RES(res);
+    u32_t len_to_read = offset + len - cur_offset;
+    len_to_read = MIN(len_to_read, SPIFFS_DATA_PAGE_SIZE(fs) - (cur_offset % SPIFFS_DATA_PAGE_SIZE(fs)));
+    if (check) {
+      res = spiffs_page_data_check(fs, fd, data_pix, data_spix);
+      SPIFFS_CHECK_RES(res);
+    }
+    ext[*filled].addr = SPIFFS_PAGE_TO_PADDR(fs, data_pix) + sizeof(spiffs_page_header) +
+        (cur_offset % SPIFFS_DATA_PAGE_SIZE(fs));
+    ext[*filled].len = len_to_read;
+    ext[*filled].span_ix = data_spix;
+    (*filled)++;
+    cur_offset += len_to_read;
+    fd->offset = cur_offset;
+    data_spix++;
+  }
+
+  return res;
+}
+#endif
+
 #if !SPIFFS_READ_ONLY
 typedef struct {
   spiffs_obj_id min_obj_id;
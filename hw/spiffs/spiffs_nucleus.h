@@ -268,6 +268,8 @@
 #define SPIFFS_PH_FLAG_DELET  (1<<7)
 // if 0, this index header is being deleted
 #define SPIFFS_PH_FLAG_IXDELE (1<<6)
+// if 0, gc is moving this index page, a finished copy elsewhere supersedes it
+#define SPIFFS_PH_FLAG_MOVING (1<<3)
 
 
 #define SPIFFS_CHECK_MOUNT(fs) \
@@ -339,6 +341,10 @@
   (_fs)->cfg.hal_read_f((_fs), (_paddr), (_len), (_dst))
 #define SPIFFS_HAL_ERASE(_fs, _paddr, _len) \
   (_fs)->cfg.hal_erase_f((_fs), (_paddr), (_len))
+#define SPIFFS_HAL_STREAM_READ(_fs, _paddr, _len, _dst) \
+  ((_fs)->cfg.hal_stream_read_f ? \
+  (_fs)->cfg.hal_stream_read_f((_fs), (_paddr), (_len), (_dst)) : \
+  SPIFFS_HAL_READ(_fs, _paddr, _len, _dst))
 
 #else // SPIFFS_HAL_CALLBACK_EXTRA
 
@@ -348,6 +354,10 @@
   (_fs)->cfg.hal_read_f((_paddr), (_len), (_dst))
 #define SPIFFS_HAL_ERASE(_fs, _paddr, _len) \
   (_fs)->cfg.hal_erase_f((_paddr), (_len))
+#define SPIFFS_HAL_STREAM_READ(_fs, _paddr, _len, _dst) \
+  ((_fs)->cfg.hal_stream_read_f ? \
+  (_fs)->cfg.hal_stream_read_f((_paddr), (_len), (_dst)) : \
+  SPIFFS_HAL_READ(_fs, _paddr, _len, _dst))
 
 #endif // SPIFFS_HAL_CALLBACK_EXTRA
 
@@ -358,6 +368,7 @@
 #define SPIFFS_CACHE_FLAG_OBJLU       (1<<2)
 #define SPIFFS_CACHE_FLAG_OBJIX       (1<<3)
 #define SPIFFS_CACHE_FLAG_DATA        (1<<4)
+#define SPIFFS_CACHE_FLAG_PROT        (1<<5)
 #define SPIFFS_CACHE_FLAG_TYPE_WR     (1<<7)
 
 #define SPIFFS_CACHE_PAGE_SIZE(fs) \
@@ -385,6 +396,10 @@ typedef struct {
     struct {
       // read cache page index
       spiffs_page_ix pix;
+#if SPIFFS_CACHE_SLRU
+      // value of cache loads when this page was read in
+      u32_t loaded;
+#endif
     };
 #if SPIFFS_CACHE_WR
     // type write cache
@@ -403,6 +418,12 @@ typedef struct {
 // cache struct
 typedef struct {
   u8_t cpage_count;
+#if SPIFFS_CACHE_SLRU
+  // pages in the protected segment
+  u8_t cpage_prot;
+  // pages read in so far
+  u32_t loads;
+#endif
   u32_t last_access;
   u32_t cpage_use_map;
   u32_t cpage_use_mask;
@@ -574,6 +595,83 @@ s32_t spiffs_probe(
 s32_t spiffs_obj_lu_scan(
     spiffs *fs);
 
+#if SPIFFS_MOUNT_SNAPSHOT
+s32_t spiffs_snap_load(
+    spiffs *fs);
+
+s32_t spiffs_snap_save(
+    spiffs *fs);
+
+void spiffs_snap_invalidate(void);
+#endif
+
+#if SPIFFS_WEAR_LEVEL
+s32_t spiffs_wear_load(
+    spiffs *fs);
+
+void spiffs_wear_erased(
+    spiffs *fs,
+    spiffs_block_ix bix);
+
+s32_t spiffs_wear_count(
+    spiffs *fs,
+    spiffs_block_ix bix,
+    u32_t *count);
+#endif
+
+#if SPIFFS_NAME_INDEX
+s32_t spiffs_name_ix_build(
+    spiffs *fs);
+
+void spiffs_name_ix_clear(void);
+
+int spiffs_name_ix_start(void);
+
+int spiffs_name_ix_complete(void);
+
+s32_t spiffs_name_ix_find(
+    spiffs *fs,
+    const u8_t *name,
+    spiffs_page_ix *pix);
+
+void spiffs_name_ix_add(
+    const u8_t *name,
+    spiffs_obj_id obj_id,
+    spiffs_page_ix pix);
+
+void spiffs_name_ix_event(
+    spiffs_page_object_ix *objix,
+    int ev,
+    spiffs_obj_id obj_id,
+    spiffs_span_ix spix,
+    spiffs_page_ix pix);
+#endif
+
+#if SPIFFS_DIR_INDEX
+s32_t spiffs_dir_ix_build(
+    spiffs *fs);
+
+void spiffs_dir_ix_clear(void);
+
+void spiffs_dir_ix_event(
+    spiffs_page_object_ix *objix,
+    int ev,
+    spiffs_obj_id obj_id,
+    spiffs_span_ix spix,
+    spiffs_page_ix pix);
+
+s32_t spiffs_dir_ix_list(
+    spiffs *fs,
+    spiffs_obj_id parent,
+    spiffs_obj_id *ids,
+    u32_t max);
+
+s32_t spiffs_dir_ix_lookup(
+    spiffs *fs,
+    const char *path,
+    spiffs_obj_id *obj_id);
+#endif
+
 s32_t spiffs_obj_lu_find_free_obj_id(
     spiffs *fs,
     spiffs_obj_id *obj_id,
@@ -620,6 +718,15 @@ s32_t spiffs_page_allocate_data(
     u8_t finalize,
     spiffs_page_ix *pix);
 
+s32_t spiffs_page_copy(
+    spiffs *fs,
+    spiffs_file fh,
+    u8_t *page_data,
+    spiffs_obj_id obj_id,
+    spiffs_page_header *page_hdr,
+    spiffs_page_ix src_pix,
+    spiffs_page_ix *dst_pix);
+
 s32_t spiffs_page_move(
     spiffs *fs,
     spiffs_file fh,
@@ -662,6 +769,35 @@ s32_t spiffs_populate_ix_map(
     u32_t vec_entry_start,
     u32_t vec_entry_end);
 
+s32_t spiffs_ix_map_fd(
+    spiffs *fs,
+    spiffs_fd *fd,
+    spiffs_ix_map *map,
+    u32_t offset,
+    u32_t len,
+    spiffs_page_ix *map_buf);
+
+s32_t spiffs_ix_remap_fd(
+    spiffs *fs,
+    spiffs_fd *fd,
+    u32_t offset);
+
+#if SPIFFS_IX_MAP_AUTO
+s32_t spiffs_ix_auto(
+    spiffs *fs,
+    spiffs_fd *fd,
+    u32_t offset);
+
+u8_t spiffs_ix_auto_owns(
+    spiffs_ix_map *map);
+
+void spiffs_ix_auto_objix(
+    spiffs *fs,
+    spiffs_fd *fd,
+    spiffs_span_ix objix_spix,
+    spiffs_page_ix pix);
+#endif
+
 #endif
 
 void spiffs_cb_object_event(
@@ -705,6 +841,17 @@ s32_t spiffs_object_read(
     u32_t len,
     u8_t *dst);
 
+#if SPIFFS_READ_EXTENTS
+s32_t spiffs_object_read_extents(
+    spiffs_fd *fd,
+    u32_t offset,
+    u32_t len,
+    spiffs_extent *ext,
+    u32_t n,
+    u32_t *filled,
+    u8_t check);
+#endif
+
 s32_t spiffs_object_truncate(
     spiffs_fd *fd,
     u32_t new_len,
@@ -733,11 +880,23 @@ s32_t spiffs_gc_find_candidate(
 
 s32_t spiffs_gc_clean(
     spiffs *fs,
-    spiffs_block_ix bix);
+    spiffs_block_ix bix,
+    u32_t max_moves);
 
 s32_t spiffs_gc_quick(
     spiffs *fs, u16_t max_free_pages);
 
+s32_t spiffs_gc_step(
+    spiffs *fs,
+    u32_t min_deleted,
+    u8_t *erased);
+
+#if SPIFFS_WEAR_LEVEL
+s32_t spiffs_gc_migrate(
+    spiffs *fs,
+    u32_t spread);
+#endif
+
 // ---------------
 
 s32_t spiffs_fd_find_new(
@@ -765,6 +924,9 @@ void spiffs_fd_temporal_cache_rehash(
 void spiffs_cache_init(
     spiffs *fs);
 
+s32_t spiffs_cache_drop_all(
+    spiffs *fs);
+
 void spiffs_cache_drop_page(
     spiffs *fs,
     spiffs_page_ix pix);
@@ -794,4 +956,10 @@ s32_t spiffs_page_consistency_check(
 s32_t spiffs_object_index_consistency_check(
     spiffs *fs);
 
+#if SPIFFS_INCREMENTAL_CHECK
+s32_t spiffs_check_slice(
+    spiffs *fs,
+    spiffs_check_cursor *c);
+#endif
+
 #endif /* SPIFFS_NUCLEUS_H_ */
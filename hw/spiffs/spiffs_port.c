@@ -1,30 +1,82 @@
+#include <stdbool.h>
+#include <stdio.h>
+
 #include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "spiffs_port.h"
 #include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+
+#define CACHE_BYTES(pages) \
+	(sizeof(spiffs_cache) + (pages) * SPIFFS_CACHE_PAGE_SIZE(&spiffs_fs))
+
+SemaphoreHandle_t SPIFFS_Mutex;
+spiffs spiffs_fs;
+
+static u8_t spiffs_work[2 * 256];
+static u8_t spiffs_fds[SPIFFS_PORT_FDS * sizeof(spiffs_fd)]
+    __attribute__((aligned(4)));
+/* Not CCM, cached pages may be handed to DMA */
+static u8_t spiffs_cache_arena[sizeof(spiffs_cache) +
+    SPIFFS_PORT_CACHE_MAX * (sizeof(spiffs_cache_page) + 256)]
+    __attribute__((aligned(4)));
 
 int32_t my_spiffs_read(uint32_t addr, uint32_t size, uint8_t *dst)
 {
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+
 	/* Prevent bashing the good stuff */
-	if (addr < 0x100000 || addr > 0xffffff || addr+size > 0xffffff)
+	if (!flash_part_contains(p, addr, size))
 		return -1;
 	if (size > 0xffff)
 		return -1;
-	sFLASH_ReadBuffer(dst, addr, size);
+	/* Lookup scans walk every block and would only evict the rest */
+	if (SPIFFS_IS_LOOKUP_PAGE(&spiffs_fs,
+	    SPIFFS_PADDR_TO_PAGE(&spiffs_fs, addr)))
+		sFLASH_UncachedRead(dst, addr, size);
+	else
+		sFLASH_CachedRead(dst, addr, size);
+	return SPIFFS_OK;
+}
+
+/* File data for SPIFFS_read_stream(), read once so kept out of the cache */
+int32_t my_spiffs_stream_read(uint32_t addr, uint32_t size, uint8_t *dst)
+{
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+
+	if (!flash_part_contains(p, addr, size))
+		return -1;
+	sFLASH_UncachedRead(dst, addr, size);
 	return SPIFFS_OK;
 }
 
 int32_t my_spiffs_write(uint32_t addr, uint32_t size, uint8_t *src)
 {
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+
 	/* Prevent bashing the good stuff */
-	if (addr < 0x100000 || addr > 0xffffff || addr+size > 0xffffff)
+	if (!flash_part_contains(p, addr, size))
 		return -1;
-	if (size > 256)
+	if (size > 0xffff)
 		return -1;
-	sFLASH_WritePage(src, addr, size);
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
+	/* Split at page boundaries, the last page programs while SPIFFS goes on */
+	sFLASH_WriteBuffer(src, addr, size);
 	return SPIFFS_OK;
 }
 
 int32_t my_spiffs_erase(uint32_t addr, uint32_t size)
 {
+	const struct flash_part *p = flash_part(FLASH_PART_SPIFFS);
+
+	if (!flash_part_contains(p, addr, size))
+		return -1;
+#if SPIFFS_MOUNT_SNAPSHOT
+	spiffs_snap_invalidate();
+#endif
 	switch(size) {
 	case 0x1000:
 		sFLASH_EraseSector(addr);
@@ -38,3 +90,81 @@ int32_t my_spiffs_erase(uint32_t addr, uint32_t size)
 	}
 	return -1;
 }
+
+int32_t
+spiffs_port_mount(void)
+{
+	spiffs_config cfg;
+
+	if (SPIFFS_mounted(&spiffs_fs))
+		return SPIFFS_OK;
+	if (SPIFFS_Mutex == NULL)
+		SPIFFS_Mutex = xSemaphoreCreateMutex();
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.hal_read_f = my_spiffs_read;
+	cfg.hal_write_f = my_spiffs_write;
+	cfg.hal_erase_f = my_spiffs_erase;
+#if SPIFFS_READ_EXTENTS
+	cfg.hal_stream_read_f = my_spiffs_stream_read;
+#endif
+	return SPIFFS_mount(&spiffs_fs, &cfg, spiffs_work, spiffs_fds,
+	    sizeof(spiffs_fds), spiffs_cache_arena,
+	    CACHE_BYTES(SPIFFS_PORT_CACHE_PAGES), NULL);
+}
+
+int32_t
+spiffs_port_cache_pages(uint32_t pages)
+{
+	if (pages < 1 || pages > SPIFFS_PORT_CACHE_MAX)
+		return SPIFFS_ERR_CACHE_TOO_SMALL;
+	return SPIFFS_set_cache(&spiffs_fs, spiffs_cache_arena,
+	    CACHE_BYTES(pages));
+}
+
+#if SPIFFS_READ_EXTENTS
+int32_t
+spiffs_port_stream(const char *path, uint8_t *buf, uint32_t size,
+    int32_t (*sink)(void *, const uint8_t *, uint32_t), void *arg)
+{
+	spiffs_file fh;
+	int32_t res;
+
+	if ((fh = SPIFFS_open(&spiffs_fs, path, SPIFFS_O_RDONLY, 0)) < 0)
+		return fh;
+	res = SPIFFS_read_stream(&spiffs_fs, fh, 0x7fffffff, buf, size,
+	    sink, arg);
+	SPIFFS_close(&spiffs_fs, fh);
+	return res;
+}
+#endif
+
+int
+spiffs_port_cache_report(char *buf, size_t len, bool clear)
+{
+	spiffs_cache_stats st;
+
+	if (!SPIFFS_mounted(&spiffs_fs))
+		return snprintf(buf, len, "spiffs: not mounted\n");
+	SPIFFS_cache_stats(&spiffs_fs, &st, clear);
+	return snprintf(buf, len, "spiffs cache: %u/%u/%u pages, "
+	    "%lu hits %lu misses %lu evictions %lu write-backs "
+	    "%lu promotions\n", st.pages_used, st.pages_protected, st.pages,
+	    (unsigned long)st.hits, (unsigned long)st.misses,
+	    (unsigned long)st.evictions, (unsigned long)st.write_backs,
+	    (unsigned long)st.promotions);
+}
+
+int
+spiffs_port_wear_report(char *buf, size_t len)
+{
+	spiffs_wear_stats st;
+
+	if (!SPIFFS_mounted(&spiffs_fs))
+		return snprintf(buf, len, "spiffs: not mounted\n");
+	if (SPIFFS_wear_stats(&spiffs_fs, &st) < 0)
+		return snprintf(buf, len, "spiffs wear: no counts\n");
+	return snprintf(buf, len, "spiffs wear: %lu blocks, %lu-%lu erases, "
+	    "%lu in all, %lu moves\n", (unsigned long)st.blocks,
+	    (unsigned long)st.min, (unsigned long)st.max,
+	    (unsigned long)st.total, (unsigned long)st.moves);
+}
@@ -0,0 +1,48 @@
+#ifndef _SPIFFS_PORT_H_
+#define _SPIFFS_PORT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * The file system on the FLASH_PART_SPIFFS partition of the external
+ * SPI flash.  spiffs_port_mount() sets up the buffers and mounts it; it
+ * does not format, so an unformatted partition stays unmounted.
+ *
+ * This header stays clear of spiffs.h, whose config pulls in more of
+ * libc than application code wants.
+ */
+
+#define SPIFFS_PORT_FDS		8
+#define SPIFFS_PORT_CACHE_MAX	16	/* Pages in the cache arena */
+#define SPIFFS_PORT_CACHE_PAGES	8	/* Pages used at mount */
+
+struct spiffs_t;
+extern struct spiffs_t spiffs_fs;
+
+int32_t spiffs_port_mount(void);
+
+/* Resizes the SPIFFS cache within its arena, 1 to SPIFFS_PORT_CACHE_MAX */
+int32_t spiffs_port_cache_pages(uint32_t pages);
+
+/*
+ * Passes the whole of file "path" to "sink" in pieces, read straight from
+ * the flash into "buf" of "size" bytes, at least a page.  Returns the bytes
+ * passed, or the SPIFFS error or the sink's if it returned < 0.
+ */
+int32_t spiffs_port_stream(const char *path, uint8_t *buf, uint32_t size,
+    int32_t (*sink)(void *, const uint8_t *, uint32_t), void *arg);
+
+/* Formats the cache statistics as one line of text */
+int spiffs_port_cache_report(char *buf, size_t len, bool clear);
+
+/* Formats the spread of the block erase counts as one line of text */
+int spiffs_port_wear_report(char *buf, size_t len);
+
+int32_t my_spiffs_read(uint32_t addr, uint32_t size, uint8_t *dst);
+int32_t my_spiffs_stream_read(uint32_t addr, uint32_t size, uint8_t *dst);
+int32_t my_spiffs_write(uint32_t addr, uint32_t size, uint8_t *src);
+int32_t my_spiffs_erase(uint32_t addr, uint32_t size);
+
+#endif
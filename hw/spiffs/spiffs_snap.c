@@ -0,0 +1,325 @@
+/*
+ * Mount snapshot: the result of the object lookup scan SPIFFS_mount()
+ * would otherwise do, saved at unmount or by SPIFFS_checkpoint().
+ *
+ * Two records alternate between the two sectors of the snapshot
+ * partition, the newer one having the higher generation.  Each record
+ * is a header page followed by one entry per block.  The header is
+ * written last, so a record cut short by power loss has no valid
+ * header.  The "clean" word sits outside the CRC and is programmed to
+ * zero by the first write or erase that reaches the file system after
+ * the record was saved, so only a record that still matches the flash
+ * is ever trusted.
+ */
+
+#include <stddef.h>
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "flash_part.h"
+#include "crc.h"
+
+#if SPIFFS_MOUNT_SNAPSHOT
+
+#define SNAP_MAGIC	0x504e5353	/* "SSNP" */
+#define SNAP_VERSION	1
+#define SNAP_SECTOR	0x1000
+#define SNAP_ENTRIES	SPIFFS_CFG_LOG_PAGE_SZ(fs)	/* Offset of the entries */
+#define SNAP_CLEAN	0xffffffff
+
+struct snap_hdr {
+	u32_t	magic;
+	u16_t	version;
+	u16_t	block_count;
+	u32_t	generation;
+	u32_t	phys_addr;
+	u32_t	phys_size;
+	u32_t	block_size;
+	u32_t	page_size;
+	u32_t	free_blocks;
+	u32_t	p_allocated;
+	u32_t	p_deleted;
+	u32_t	free_cursor_entry;
+	u16_t	free_cursor_block;
+	u16_t	max_erase_count;
+	u32_t	crc;		/* Of everything above and the entries */
+	u32_t	clean;		/* SNAP_CLEAN until the file system changes */
+} __attribute__((packed));
+
+struct snap_block {
+	u16_t	used;		/* Pages in use */
+	u16_t	deleted;	/* Deleted pages */
+	u16_t	erase_count;
+	u16_t	id_min;		/* Range of object ids in the block */
+	u16_t	id_max;
+} __attribute__((packed));
+
+#define SNAP_MAX_BLOCKS	((SNAP_SECTOR - 256) / sizeof(struct snap_block))
+
+/* Offset of the record the file system currently matches, or -1 */
+static s32_t snap_live = -1;
+static u32_t snap_generation;
+
+static const struct flash_part *
+snap_part(void)
+{
+	return flash_part(FLASH_PART_SPIFFS_SNAP);
+}
+
+static void
+hdr_geometry(spiffs *fs, struct snap_hdr *h)
+{
+	h->block_count = fs->block_count;
+	h->phys_addr = SPIFFS_CFG_PHYS_ADDR(fs);
+	h->phys_size = SPIFFS_CFG_PHYS_SZ(fs);
+	h->block_size = SPIFFS_CFG_LOG_BLOCK_SZ(fs);
+	h->page_size = SPIFFS_CFG_LOG_PAGE_SZ(fs);
+}
+
+/* Reads a block's magic and erase count, which sit side by side. */
+static s32_t
+read_block_tail(spiffs *fs, spiffs_block_ix bix, spiffs_obj_id tail[2])
+{
+	return _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU2 | SPIFFS_OP_C_READ, 0,
+	    SPIFFS_MAGIC_PADDR(fs, bix), 2 * sizeof(spiffs_obj_id),
+	    (u8_t *)tail);
+}
+
+/*
+ * Checks the record at "off" against the file system.  Returns
+ * SPIFFS_OK and the header, or SPIFFS_ERR_SNAP_INVALID.  "torn" is set
+ * when the record itself is damaged, as opposed to merely stale.
+ */
+static s32_t
+snap_check(spiffs *fs, u32_t off, struct snap_hdr *h, int *torn)
+{
+	const struct flash_part *p = snap_part();
+	struct snap_hdr want;
+	struct snap_block *e;
+	struct crc_ctx crc;
+	spiffs_obj_id tail[2];
+	u32_t used = 0, deleted = 0;
+	u32_t n, per_page, i;
+	spiffs_block_ix bix;
+
+	*torn = 1;
+	if (flash_part_read(p, off, h, sizeof(*h)) != 0 ||
+	    h->magic != SNAP_MAGIC || h->version != SNAP_VERSION)
+		return SPIFFS_ERR_SNAP_INVALID;
+	hdr_geometry(fs, &want);
+	if (h->block_count != want.block_count ||
+	    h->phys_addr != want.phys_addr || h->phys_size != want.phys_size ||
+	    h->block_size != want.block_size || h->page_size != want.page_size)
+		return SPIFFS_ERR_SNAP_INVALID;
+
+	crc_start(&crc);
+	per_page = SPIFFS_CFG_LOG_PAGE_SZ(fs) / sizeof(*e);
+	e = (struct snap_block *)fs->work;
+	for (bix = 0; bix < fs->block_count; bix += n) {
+		n = MIN(per_page, (u32_t)(fs->block_count - bix));
+		if (flash_part_read(p, off + SNAP_ENTRIES + bix * sizeof(*e),
+		    e, n * sizeof(*e)) != 0)
+			return SPIFFS_ERR_SNAP_INVALID;
+		crc_update(&crc, e, n * sizeof(*e));
+		for (i = 0; i < n; i++) {
+			used += e[i].used;
+			deleted += e[i].deleted;
+		}
+	}
+	crc_update(&crc, h, offsetof(struct snap_hdr, crc));
+	if (crc_final(&crc) != h->crc)
+		return SPIFFS_ERR_SNAP_INVALID;
+	*torn = 0;
+	if (h->clean != SNAP_CLEAN || used != h->p_allocated ||
+	    deleted != h->p_deleted)
+		return SPIFFS_ERR_SNAP_INVALID;
+
+	/* Cheap cross check against the flash: every block's magic and
+	 * erase count, as read by the first pass of the full scan. */
+	for (bix = 0; bix < fs->block_count; bix += n) {
+		n = MIN(per_page, (u32_t)(fs->block_count - bix));
+		if (flash_part_read(p, off + SNAP_ENTRIES + bix * sizeof(*e),
+		    e, n * sizeof(*e)) != 0)
+			return SPIFFS_ERR_SNAP_INVALID;
+		for (i = 0; i < n; i++) {
+			if (read_block_tail(fs, bix + i, tail) != SPIFFS_OK)
+				return SPIFFS_ERR_SNAP_INVALID;
+#if SPIFFS_USE_MAGIC
+			if (tail[0] != SPIFFS_MAGIC(fs, bix + i))
+				return SPIFFS_ERR_SNAP_INVALID;
+#endif
+			if (tail[1] != e[i].erase_count)
+				return SPIFFS_ERR_SNAP_INVALID;
+		}
+	}
+	return SPIFFS_OK;
+}
+
+/*
+ * Restores the state the lookup scan would compute from the newest
+ * record, if it is clean and matches the flash.
+ */
+s32_t
+spiffs_snap_load(spiffs *fs)
+{
+	struct snap_hdr h[2];
+	s32_t res;
+	u32_t first;
+	int torn, i;
+
+	snap_live = -1;
+	snap_generation = 0;
+	if (fs->block_count > SNAP_MAX_BLOCKS)
+		return SPIFFS_ERR_SNAP_INVALID;
+	for (i = 0; i < 2; i++)
+		if (flash_part_read(snap_part(), i * SNAP_SECTOR, &h[i],
+		    sizeof(h[i])) != 0 || h[i].magic != SNAP_MAGIC)
+			h[i].generation = 0;
+	snap_generation = MAX(h[0].generation, h[1].generation);
+	first = h[1].generation > h[0].generation;
+
+	/* The older record only counts if the newer one is torn */
+	res = snap_check(fs, first * SNAP_SECTOR, &h[0], &torn);
+	if (res != SPIFFS_OK && torn) {
+		first ^= 1;
+		res = snap_check(fs, first * SNAP_SECTOR, &h[0], &torn);
+	}
+	if (res != SPIFFS_OK)
+		return res;
+
+	fs->free_blocks = h[0].free_blocks;
+	fs->stats_p_allocated = h[0].p_allocated;
+	fs->stats_p_deleted = h[0].p_deleted;
+	fs->free_cursor_block_ix = h[0].free_cursor_block;
+	fs->free_cursor_obj_lu_entry = h[0].free_cursor_entry;
+	fs->max_erase_count = h[0].max_erase_count;
+	snap_live = first * SNAP_SECTOR;
+	return SPIFFS_OK;
+}
+
+/* Scans one block's lookup pages into "e", like spiffs_obj_lu_scan_v. */
+static s32_t
+scan_block(spiffs *fs, spiffs_block_ix bix, struct snap_block *e,
+    u32_t *free_blocks)
+{
+	const u32_t per_page = SPIFFS_CFG_LOG_PAGE_SZ(fs) / sizeof(spiffs_obj_id);
+	spiffs_obj_id *lu = (spiffs_obj_id *)fs->lu_work;
+	spiffs_obj_id tail[2], id;
+	u32_t entry, page;
+	s32_t res;
+
+	e->used = e->deleted = 0;
+	e->id_min = SPIFFS_OBJ_ID_FREE;
+	e->id_max = 0;
+	for (entry = 0; entry < SPIFFS_OBJ_LOOKUP_MAX_ENTRIES(fs); entry++) {
+		page = entry / per_page;
+		if (entry % per_page == 0) {
+			res = _spiffs_rd(fs, SPIFFS_OP_T_OBJ_LU | SPIFFS_OP_C_READ,
+			    0, SPIFFS_BLOCK_TO_PADDR(fs, bix) +
+			    page * SPIFFS_CFG_LOG_PAGE_SZ(fs),
+			    SPIFFS_CFG_LOG_PAGE_SZ(fs), fs->lu_work);
+			SPIFFS_CHECK_RES(res);
+		}
+		id = lu[entry % per_page];
+		if (id == SPIFFS_OBJ_ID_FREE) {
+			if (entry == 0)
+				(*free_blocks)++;
+		} else if (id == SPIFFS_OBJ_ID_DELETED) {
+			e->deleted++;
+		} else {
+			e->used++;
+			id &= ~SPIFFS_OBJ_ID_IX_FLAG;
+			e->id_min = MIN(e->id_min, id);
+			e->id_max = MAX(e->id_max, id);
+		}
+	}
+	res = read_block_tail(fs, bix, tail);
+	SPIFFS_CHECK_RES(res);
+	e->erase_count = tail[1];
+	return SPIFFS_OK;
+}
+
+/*
+ * Writes a new record of the file system as it is on the flash.  All
+ * cached writes must have been flushed.  The lookup pages are scanned
+ * afresh rather than trusting the running counters.
+ */
+s32_t
+spiffs_snap_save(spiffs *fs)
+{
+	const struct flash_part *p = snap_part();
+	struct snap_block *e = (struct snap_block *)fs->work;
+	struct snap_hdr h;
+	struct crc_ctx crc;
+	u32_t off, per_page, n, i;
+	u32_t used = 0, deleted = 0, free_blocks = 0;
+	spiffs_block_ix bix;
+	s32_t res;
+
+	if (fs->block_count > SNAP_MAX_BLOCKS)
+		return SPIFFS_ERR_SNAP_INVALID;
+	if (snap_live >= 0) {
+		/* The live record is still exact, nothing to do */
+		return SPIFFS_OK;
+	}
+	/* Never overwrite the record a torn save would fall back to */
+	off = snap_generation & 1 ? 0 : SNAP_SECTOR;
+	if (flash_part_erase(p, off, SNAP_SECTOR) != 0)
+		return SPIFFS_ERR_SNAP_INVALID;
+
+	memset(&h, 0, sizeof(h));
+	h.magic = SNAP_MAGIC;
+	h.version = SNAP_VERSION;
+	hdr_geometry(fs, &h);
+	h.generation = snap_generation + 1;
+	h.free_cursor_block = fs->free_cursor_block_ix;
+	h.free_cursor_entry = fs->free_cursor_obj_lu_entry;
+	h.max_erase_count = fs->max_erase_count;
+
+	per_page = SPIFFS_CFG_LOG_PAGE_SZ(fs) / sizeof(*e);
+	crc_start(&crc);
+	for (bix = 0; bix < fs->block_count; bix += n) {
+		n = MIN(per_page, (u32_t)(fs->block_count - bix));
+		for (i = 0; i < n; i++) {
+			res = scan_block(fs, bix + i, &e[i], &free_blocks);
+			SPIFFS_CHECK_RES(res);
+			used += e[i].used;
+			deleted += e[i].deleted;
+		}
+		if (flash_part_write(p, off + SNAP_ENTRIES + bix * sizeof(*e),
+		    e, n * sizeof(*e)) != 0)
+			return SPIFFS_ERR_SNAP_INVALID;
+		crc_update(&crc, e, n * sizeof(*e));
+	}
+	h.free_blocks = free_blocks;
+	h.p_allocated = used;
+	h.p_deleted = deleted;
+	h.clean = SNAP_CLEAN;
+	/* The CRC covers the entries, then the header up to the CRC */
+	crc_update(&crc, &h, offsetof(struct snap_hdr, crc));
+	h.crc = crc_final(&crc);
+	if (flash_part_write(p, off, &h, sizeof(h)) != 0)
+		return SPIFFS_ERR_SNAP_INVALID;
+
+	fs->free_blocks = free_blocks;
+	fs->stats_p_allocated = used;
+	fs->stats_p_deleted = deleted;
+	snap_generation = h.generation;
+	snap_live = off;
+	return SPIFFS_OK;
+}
+
+/* Called before anything is written or erased in the file system. */
+void
+spiffs_snap_invalidate(void)
+{
+	u32_t zero = 0;
+
+	if (snap_live < 0)
+		return;
+	flash_part_write(snap_part(), snap_live + offsetof(struct snap_hdr, clean),
+	    &zero, sizeof(zero));
+	snap_live = -1;
+}
+
+#endif /* SPIFFS_MOUNT_SNAPSHOT */
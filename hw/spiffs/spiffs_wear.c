@@ -0,0 +1,194 @@
+/*
+ * Erase counts of the SPIFFS blocks.
+ *
+ * SPIFFS itself only stamps each block with the sequence number of its
+ * last erase, which tells which block is older but not how worn it is.
+ * The counts are kept here, in the two sectors of the
+ * FLASH_PART_SPIFFS_WEAR partition.  The active sector holds the counts
+ * as they were when it was written, then one word per erase since,
+ * appended as the erases happen.  When it is full the counts go into the
+ * other sector, whose header is written last and has the higher
+ * generation.  An erase that power loss cuts off before its word is
+ * written goes uncounted.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "spiffs.h"
+#include "spiffs_nucleus.h"
+#include "flash_part.h"
+#include "crc.h"
+
+#if SPIFFS_WEAR_LEVEL
+
+#define WEAR_MAGIC	0x52574653	/* "SFWR" */
+#define WEAR_VERSION	1
+#define WEAR_SECTOR	0x1000
+#define WEAR_BASE	32		/* Offset of the counts */
+#define WEAR_EMPTY	0xffffffff
+/* Appended per erase: the block, and its complement to spot torn words */
+#define WEAR_ENTRY(bix)	((u32_t)(bix) | (u32_t)(u16_t)~(bix) << 16)
+
+struct wear_hdr {
+	u32_t	magic;
+	u16_t	version;
+	u16_t	block_count;
+	u32_t	generation;
+	u32_t	phys_addr;
+	u32_t	block_size;
+	u32_t	crc;		/* Of the above and the counts */
+} __attribute__((packed));
+
+static u32_t wear_counts[SPIFFS_WEAR_BLOCKS];
+static struct wear_hdr wear;	/* Of the active sector, magic 0 if none */
+static u32_t wear_active;	/* Offset of the active sector */
+static u32_t wear_off;		/* Where the next word goes */
+
+static const struct flash_part *
+wear_part(void)
+{
+	return flash_part(FLASH_PART_SPIFFS_WEAR);
+}
+
+static int
+wear_matches(spiffs *fs, const struct wear_hdr *h)
+{
+	return h->magic == WEAR_MAGIC && h->version == WEAR_VERSION &&
+	    h->block_count == fs->block_count &&
+	    h->phys_addr == SPIFFS_CFG_PHYS_ADDR(fs) &&
+	    h->block_size == SPIFFS_CFG_LOG_BLOCK_SZ(fs);
+}
+
+static u32_t
+wear_crc(spiffs *fs, const struct wear_hdr *h)
+{
+	struct crc_ctx crc;
+
+	crc_start(&crc);
+	crc_update(&crc, h, offsetof(struct wear_hdr, crc));
+	crc_update(&crc, wear_counts, fs->block_count * sizeof(u32_t));
+	return crc_final(&crc);
+}
+
+/* Reads the counts from the sector at "off", if its record is whole. */
+static s32_t
+wear_read(spiffs *fs, u32_t off, const struct wear_hdr *h)
+{
+	const struct flash_part *p = wear_part();
+	u32_t end = off + WEAR_SECTOR, buf[16], n, i, bix;
+
+	if (flash_part_read(p, off + WEAR_BASE, wear_counts,
+	    fs->block_count * sizeof(u32_t)) != 0 || wear_crc(fs, h) != h->crc)
+		return SPIFFS_ERR_NO_WEAR_COUNTS;
+	for (off += WEAR_BASE + fs->block_count * sizeof(u32_t); off < end;
+	    off += n * sizeof(u32_t)) {
+		n = MIN(sizeof(buf) / sizeof(buf[0]), (end - off) / sizeof(u32_t));
+		if (flash_part_read(p, off, buf, n * sizeof(u32_t)) != 0)
+			return SPIFFS_ERR_NO_WEAR_COUNTS;
+		for (i = 0; i < n; i++) {
+			if (buf[i] == WEAR_EMPTY) {
+				wear_off = off + i * sizeof(u32_t);
+				return SPIFFS_OK;
+			}
+			/* Anything else was cut short by power loss */
+			bix = buf[i] & 0xffff;
+			if (buf[i] == WEAR_ENTRY(bix) && bix < fs->block_count)
+				wear_counts[bix]++;
+		}
+	}
+	wear_off = end;
+	return SPIFFS_OK;
+}
+
+/* Writes the counts as a new record into the other sector. */
+static s32_t
+wear_compact(spiffs *fs)
+{
+	const struct flash_part *p = wear_part();
+	struct wear_hdr h;
+	u32_t off = wear.magic == WEAR_MAGIC ? wear_active ^ WEAR_SECTOR : 0;
+
+	if (flash_part_erase(p, off, WEAR_SECTOR) != 0)
+		return SPIFFS_ERR_NO_WEAR_COUNTS;
+	memset(&h, 0, sizeof(h));
+	h.magic = WEAR_MAGIC;
+	h.version = WEAR_VERSION;
+	h.block_count = fs->block_count;
+	h.generation = wear.generation + 1;
+	h.phys_addr = SPIFFS_CFG_PHYS_ADDR(fs);
+	h.block_size = SPIFFS_CFG_LOG_BLOCK_SZ(fs);
+	h.crc = wear_crc(fs, &h);
+	if (flash_part_write(p, off + WEAR_BASE, wear_counts,
+	    fs->block_count * sizeof(u32_t)) != 0 ||
+	    flash_part_write(p, off, &h, sizeof(h)) != 0)
+		return SPIFFS_ERR_NO_WEAR_COUNTS;
+	wear = h;
+	wear_active = off;
+	wear_off = off + WEAR_BASE + fs->block_count * sizeof(u32_t);
+	return SPIFFS_OK;
+}
+
+/*
+ * Reads the counts of the file system's geometry, or starts them at zero
+ * if there are none.
+ */
+s32_t
+spiffs_wear_load(spiffs *fs)
+{
+	struct wear_hdr h[2];
+	u32_t first;
+	int i;
+
+	memset(&wear, 0, sizeof(wear));
+	if (fs->block_count > SPIFFS_WEAR_BLOCKS ||
+	    WEAR_BASE + fs->block_count * sizeof(u32_t) >= WEAR_SECTOR)
+		return SPIFFS_ERR_NO_WEAR_COUNTS;
+	for (i = 0; i < 2; i++)
+		if (flash_part_read(wear_part(), i * WEAR_SECTOR, &h[i],
+		    sizeof(h[i])) != 0 || !wear_matches(fs, &h[i]))
+			h[i].generation = 0;
+	first = h[1].generation > h[0].generation;
+
+	/* The older record only counts if the newer one is torn */
+	for (i = 0; i < 2; i++, first ^= 1) {
+		if (h[first].generation != 0 &&
+		    wear_read(fs, first * WEAR_SECTOR, &h[first]) == SPIFFS_OK) {
+			wear = h[first];
+			wear_active = first * WEAR_SECTOR;
+			return SPIFFS_OK;
+		}
+	}
+	memset(wear_counts, 0, sizeof(wear_counts));
+	wear.generation = MAX(h[0].generation, h[1].generation);
+	return wear_compact(fs);
+}
+
+/* Called after block "bix" has been erased. */
+void
+spiffs_wear_erased(spiffs *fs, spiffs_block_ix bix)
+{
+	u32_t e = WEAR_ENTRY(bix);
+
+	/* Format erases before anything is mounted */
+	if (!wear_matches(fs, &wear) && spiffs_wear_load(fs) != SPIFFS_OK)
+		return;
+	wear_counts[bix]++;
+	if (wear_off + sizeof(e) > wear_active + WEAR_SECTOR) {
+		(void)wear_compact(fs);
+		return;
+	}
+	(void)flash_part_write(wear_part(), wear_off, &e, sizeof(e));
+	wear_off += sizeof(e);
+}
+
+s32_t
+spiffs_wear_count(spiffs *fs, spiffs_block_ix bix, u32_t *count)
+{
+	if (!wear_matches(fs, &wear))
+		return SPIFFS_ERR_NO_WEAR_COUNTS;
+	*count = wear_counts[bix];
+	return SPIFFS_OK;
+}
+
+#endif /* SPIFFS_WEAR_LEVEL */
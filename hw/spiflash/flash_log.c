@@ -0,0 +1,475 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crc.h"
+#include "flash_part.h"
+#include "flash_log.h"
+
+#ifdef SFLASH_EMU
+/* Host builds are single threaded */
+#define LOG_LOCK(l)
+#define LOG_UNLOCK(l)
+#define LOG_KICK(l)
+#else
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "task.h"
+
+#define LOG_STACK	256
+#define LOG_LOCK(l)	xSemaphoreTake((l)->lock, portMAX_DELAY)
+#define LOG_UNLOCK(l)	xSemaphoreGive((l)->lock)
+#define LOG_KICK(l)	do {					\
+	if ((l)->task != NULL)					\
+		xTaskNotifyGive((TaskHandle_t)(l)->task);	\
+} while (0)
+#endif
+
+#define HDR		sizeof(struct flash_log_sector)
+#define REC		sizeof(struct flash_log_rec)
+#define PAD(n)		(((n) + 3) & ~3)
+#define ERASED		0xffff
+
+static uint32_t
+sector_crc(const struct flash_log_sector *h)
+{
+	return crc_block(h, offsetof(struct flash_log_sector, crc));
+}
+
+static uint32_t
+rec_crc(const struct flash_log_rec *r, const void *data)
+{
+	struct crc_ctx c;
+
+	crc_start(&c);
+	crc_update(&c, r, offsetof(struct flash_log_rec, crc));
+	crc_update(&c, data, r->len);
+	return crc_final(&c);
+}
+
+/* Checks the record at "addr" a piece at a time */
+static int
+rec_ok(struct flash_log *log, uint32_t addr, const struct flash_log_rec *r)
+{
+	struct crc_ctx c;
+	uint8_t buf[64];
+	uint32_t off, n;
+
+	crc_start(&c);
+	crc_update(&c, r, offsetof(struct flash_log_rec, crc));
+	for (off = 0; off < r->len; off += n) {
+		n = r->len - off < sizeof(buf) ? r->len - off : sizeof(buf);
+		if (flash_part_read(log->part, addr + REC + off, buf, n) < 0)
+			return 0;
+		crc_update(&c, buf, n);
+	}
+	return crc_final(&c) == r->crc;
+}
+
+static int
+read_hdr(struct flash_log *log, uint32_t sector, struct flash_log_sector *h)
+{
+	if (flash_part_read(log->part, sector * FLASH_LOG_SECTOR, h, HDR) < 0)
+		return 0;
+	return h->magic == FLASH_LOG_MAGIC && h->crc == sector_crc(h);
+}
+
+/* Whether sector "i", modulo the ring, is in use with sequence "seq" */
+static int
+holds(struct flash_log *log, uint32_t i, uint32_t seq)
+{
+	struct flash_log_sector h;
+
+	return read_hdr(log, i % log->sectors, &h) && h.seq == seq;
+}
+
+/* Reads the header of the record at "off" in "sector", 0 past the last */
+static int
+read_rec(struct flash_log *log, uint32_t sector, uint32_t off,
+    struct flash_log_rec *r)
+{
+	if (off + REC > FLASH_LOG_SECTOR || flash_part_read(log->part,
+	    sector * FLASH_LOG_SECTOR + off, r, REC) < 0)
+		return 0;
+	/* A length cut short by power loss ends the sector too */
+	return r->len != ERASED && r->len <= FLASH_LOG_SECTOR - off - REC;
+}
+
+static void
+set_empty(struct flash_log *log)
+{
+	log->head = log->sectors - 1;
+	log->head_seq = 0;
+	log->head_off = FLASH_LOG_SECTOR;
+	log->count = 0;
+	log->next = 0;
+}
+
+/*
+ * Sectors in use hold consecutive sequences around the ring, from the
+ * tail to the head, and are followed by the erased ones.  Starting from
+ * any sector in use, the sectors up to the head are exactly those whose
+ * sequence follows on, so the head is found by bisection; so is the
+ * tail when the sectors in use wrap past the end of the partition.
+ */
+int
+flash_log_open(struct flash_log *log, enum flash_part_id id)
+{
+	struct flash_log_sector h, t;
+	struct flash_log_rec r;
+	uint32_t n, first, lo, hi, mid, tail, off, last;
+
+#ifndef SFLASH_EMU
+	if (log->lock == NULL)
+		log->lock = xSemaphoreCreateMutex();
+#endif
+	log->part = flash_part(id);
+	n = log->sectors = log->part->size / FLASH_LOG_SECTOR;
+	if (log->part->erase_size != FLASH_LOG_SECTOR ||
+	    n <= FLASH_LOG_AHEAD + 1)
+		return -1;
+	memset(&log->stats, 0, sizeof(log->stats));
+	/* Sectors after a reboot may hold an erase cut short */
+	log->ahead = 0;
+
+	/* The first sector is in use unless the erased ones cover it */
+	for (first = 0; first < n && !read_hdr(log, first, &h); first++)
+		;
+	if (first == n) {
+		set_empty(log);
+		return 0;
+	}
+	lo = first;
+	hi = first + n;
+	while (hi - lo > 1) {
+		mid = lo + (hi - lo) / 2;
+		if (holds(log, mid, h.seq + mid - first))
+			lo = mid;
+		else
+			hi = mid;
+	}
+	log->head = lo % n;
+	log->head_seq = h.seq + lo - first;
+
+	tail = first;
+	if (first == 0 && lo < n - 1 && read_hdr(log, n - 1, &t) &&
+	    t.seq == h.seq - 1) {
+		/* The oldest sectors end the partition */
+		lo = log->head;
+		hi = n - 1;
+		while (hi - lo > 1) {
+			mid = lo + (hi - lo) / 2;
+			if (holds(log, mid, t.seq - (n - 1 - mid)))
+				hi = mid;
+			else
+				lo = mid;
+		}
+		tail = hi;
+	}
+	log->count = (log->head + n - tail) % n + 1;
+
+	/* Walk the head sector to its end */
+	if (!read_hdr(log, log->head, &h))
+		return -1;
+	log->next = h.first;
+	last = 0;
+	for (off = HDR; read_rec(log, log->head, off, &r);
+	    off += PAD(REC + r.len)) {
+		last = off;
+		log->next++;
+	}
+	log->head_off = off;
+	if (off + REC <= FLASH_LOG_SECTOR && r.len != ERASED)
+		/* A length cut short, the rest is not safe to program */
+		log->head_off = FLASH_LOG_SECTOR;
+	if (last != 0) {
+		read_rec(log, log->head, last, &r);
+		if (!rec_ok(log, log->head * FLASH_LOG_SECTOR + last, &r))
+			/* The last append was cut short, start afresh */
+			log->head_off = FLASH_LOG_SECTOR;
+	}
+	return 0;
+}
+
+int
+flash_log_format(struct flash_log *log)
+{
+	int res;
+
+	LOG_LOCK(log);
+	res = flash_part_erase(log->part, 0, log->sectors * FLASH_LOG_SECTOR);
+	set_empty(log);
+	log->ahead = res < 0 ? 0 : log->sectors - 1;
+	LOG_UNLOCK(log);
+	return res;
+}
+
+/* Erases the sector after the erased ones, dropping the tail if it is that */
+static int
+erase_ahead(struct flash_log *log)
+{
+	uint32_t s = (log->head + 1 + log->ahead) % log->sectors;
+
+	if (log->ahead >= log->sectors - log->count) {
+		log->count--;
+		log->stats.dropped++;
+	}
+	if (flash_part_erase(log->part, s * FLASH_LOG_SECTOR,
+	    FLASH_LOG_SECTOR) < 0)
+		return -1;
+	log->ahead++;
+	return 1;
+}
+
+static int
+start_sector(struct flash_log *log)
+{
+	struct flash_log_sector h;
+
+	if (log->ahead == 0) {
+		log->stats.stalls++;
+		if (erase_ahead(log) < 0)
+			return -1;
+	}
+	log->head = (log->head + 1) % log->sectors;
+	log->head_seq++;
+	log->head_off = FLASH_LOG_SECTOR;
+	log->ahead--;
+	log->count++;
+	h.magic = FLASH_LOG_MAGIC;
+	h.seq = log->head_seq;
+	h.first = log->next;
+	h.crc = sector_crc(&h);
+	if (flash_part_write(log->part, log->head * FLASH_LOG_SECTOR, &h,
+	    HDR) < 0)
+		return -1;
+	log->head_off = HDR;
+	log->stats.sectors++;
+	return 0;
+}
+
+int
+flash_log_append(struct flash_log *log, uint16_t type, const void *buf,
+    uint32_t len)
+{
+	struct flash_log_rec r;
+	uint8_t tmp[64];
+	uint32_t addr;
+	int res = -1;
+
+	if (len == 0 || len > FLASH_LOG_MAX)
+		return -1;
+	LOG_LOCK(log);
+	if (log->head_off + REC + len > FLASH_LOG_SECTOR &&
+	    start_sector(log) < 0)
+		goto out;
+	r.len = len;
+	r.type = type;
+	r.seq = log->next;
+	r.crc = rec_crc(&r, buf);
+	addr = log->head * FLASH_LOG_SECTOR + log->head_off;
+	if (REC + len <= sizeof(tmp)) {
+		/* Small records in one write */
+		memcpy(tmp, &r, REC);
+		memcpy(tmp + REC, buf, len);
+		if (flash_part_write(log->part, addr, tmp, REC + len) < 0)
+			goto out;
+	} else if (flash_part_write(log->part, addr, &r, REC) < 0 ||
+	    flash_part_write(log->part, addr + REC, buf, len) < 0)
+		goto out;
+	log->head_off += PAD(REC + len);
+	log->next++;
+	log->stats.appends++;
+	log->stats.bytes += len;
+	res = 0;
+out:
+	if (log->ahead < FLASH_LOG_AHEAD)
+		LOG_KICK(log);
+	LOG_UNLOCK(log);
+	return res;
+}
+
+int
+flash_log_service(struct flash_log *log)
+{
+	int res = 0;
+
+	LOG_LOCK(log);
+	if (log->ahead < FLASH_LOG_AHEAD) {
+		res = erase_ahead(log);
+		if (res > 0)
+			log->stats.erases++;
+	}
+	LOG_UNLOCK(log);
+	return res;
+}
+
+/* Puts "c" at the start of the sector with sequence "seq" */
+static void
+cursor_to(struct flash_log *log, struct flash_log_cursor *c, uint32_t seq)
+{
+	struct flash_log_sector h;
+
+	c->sector = (log->head + log->sectors - (log->head_seq - seq)) %
+	    log->sectors;
+	c->sector_seq = seq;
+	c->off = HDR;
+	c->seq = log->next;
+	if (seq == log->head_seq + 1)
+		return;		/* Not started yet */
+	if (read_hdr(log, c->sector, &h) && h.seq == seq)
+		c->seq = h.first;
+	else
+		c->off = FLASH_LOG_SECTOR;	/* Unreadable, skip it */
+}
+
+static void
+rewind_locked(struct flash_log *log, struct flash_log_cursor *c)
+{
+	cursor_to(log, c, log->head_seq + 1 - log->count);
+}
+
+void
+flash_log_rewind(struct flash_log *log, struct flash_log_cursor *c)
+{
+	LOG_LOCK(log);
+	rewind_locked(log, c);
+	LOG_UNLOCK(log);
+}
+
+uint32_t
+flash_log_first(struct flash_log *log)
+{
+	struct flash_log_cursor c;
+
+	LOG_LOCK(log);
+	rewind_locked(log, &c);
+	LOG_UNLOCK(log);
+	return c.seq;
+}
+
+void
+flash_log_seek(struct flash_log *log, struct flash_log_cursor *c,
+    uint32_t seq)
+{
+	struct flash_log_sector h;
+	struct flash_log_rec r;
+	uint32_t first, lo, hi, mid;
+
+	LOG_LOCK(log);
+	rewind_locked(log, c);
+	first = c->seq;
+	if (seq - first > log->next - first)
+		/* Older than the tail, or not written yet */
+		seq = seq - log->next < 0x80000000 ? log->next : first;
+	/* The last sector whose first record is at most "seq" */
+	lo = 0;
+	hi = log->count;
+	while (hi - lo > 1) {
+		mid = lo + (hi - lo) / 2;
+		if (read_hdr(log, (log->head + log->sectors + 1 -
+		    log->count + mid) % log->sectors, &h) &&
+		    h.first - first <= seq - first)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	cursor_to(log, c, log->head_seq + 1 - log->count + lo);
+	while (c->seq != seq && read_rec(log, c->sector, c->off, &r)) {
+		c->off += PAD(REC + r.len);
+		c->seq++;
+	}
+	LOG_UNLOCK(log);
+}
+
+int
+flash_log_read(struct flash_log *log, struct flash_log_cursor *c,
+    uint16_t *type, void *buf, uint32_t max)
+{
+	struct flash_log_rec r;
+	uint32_t behind;
+	int res;
+
+	LOG_LOCK(log);
+	for (;;) {
+		behind = log->head_seq - c->sector_seq;
+		if (behind == 0xffffffff) {
+			/* Waiting at the start of the next sector */
+			res = 0;
+			break;
+		}
+		if (behind >= log->count) {
+			/* Recycled */
+			rewind_locked(log, c);
+			continue;
+		}
+		if (!read_rec(log, c->sector, c->off, &r)) {
+			if (behind == 0) {
+				res = 0;
+				break;
+			}
+			cursor_to(log, c, c->sector_seq + 1);
+			continue;
+		}
+		if (r.len > max) {
+			res = -1;
+			break;
+		}
+		if (flash_part_read(log->part, c->sector * FLASH_LOG_SECTOR +
+		    c->off + REC, buf, r.len) < 0) {
+			res = -1;
+			break;
+		}
+		c->off += PAD(REC + r.len);
+		c->seq++;
+		if (r.crc != rec_crc(&r, buf)) {
+			log->stats.bad++;
+			continue;
+		}
+		c->seq = r.seq + 1;
+		*type = r.type;
+		res = r.len;
+		break;
+	}
+	LOG_UNLOCK(log);
+	return res;
+}
+
+#ifndef SFLASH_EMU
+static void
+log_main(void *arg)
+{
+	struct flash_log *log = arg;
+
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		while (flash_log_service(log) > 0)
+			;
+	}
+}
+
+void
+flash_log_start(struct flash_log *log)
+{
+	if (log->task == NULL)
+		xTaskCreate(log_main, "log", LOG_STACK, log, tskIDLE_PRIORITY,
+		    (TaskHandle_t *)&log->task);
+	LOG_KICK(log);
+}
+#endif
+
+int
+flash_log_report(struct flash_log *log, char *buf, size_t len)
+{
+	struct flash_log_stats st;
+
+	LOG_LOCK(log);
+	st = log->stats;
+	LOG_UNLOCK(log);
+	return snprintf(buf, len, "log: %lu appends %lu bytes, %lu sectors, "
+	    "%lu erased ahead, %lu stalls, %lu dropped, %lu bad\n",
+	    (unsigned long)st.appends, (unsigned long)st.bytes,
+	    (unsigned long)st.sectors, (unsigned long)st.erases,
+	    (unsigned long)st.stalls, (unsigned long)st.dropped,
+	    (unsigned long)st.bad);
+}
@@ -0,0 +1,126 @@
+#ifndef _FLASH_LOG_H_
+#define _FLASH_LOG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "flash_part.h"
+
+/*
+ * Ring log on a partition of the external SPI flash, for call logs, GPS
+ * tracks and traces.  Records are appended to the current sector and
+ * never straddle two; each carries a sequence number and a CRC.  When
+ * the partition is full the oldest sector is erased to make room.
+ *
+ * A few sectors ahead of the writer are kept erased by
+ * flash_log_service(), from the flash_log_start() task on the radio, so
+ * an append only erases itself when it outruns the service.
+ *
+ * flash_log_open() finds the newest and the oldest sector with binary
+ * searches over the sector headers, then walks the records of the
+ * newest sector.  Readers keep a cursor each; a cursor whose sector was
+ * recycled under it moves on to the oldest record.
+ */
+
+#define FLASH_LOG_SECTOR	0x1000
+#define FLASH_LOG_AHEAD		2	/* Sectors kept erased */
+#define FLASH_LOG_MAGIC		0x474c4654	/* "TFLG" */
+
+/* On flash, little endian.  Every sector in use starts with this. */
+struct flash_log_sector {
+	uint32_t	magic;
+	uint32_t	seq;		/* One more than the previous sector's */
+	uint32_t	first;		/* Sequence of its first record */
+	uint32_t	crc;		/* Of the above */
+} __attribute__((packed));
+
+/* Each record is this, then the data, padded to 4 bytes */
+struct flash_log_rec {
+	uint16_t	len;		/* Of the data, 0xffff if erased */
+	uint16_t	type;		/* The caller's */
+	uint32_t	seq;
+	uint32_t	crc;		/* Of len, type, seq and the data */
+} __attribute__((packed));
+
+#define FLASH_LOG_MAX		(FLASH_LOG_SECTOR - \
+				    sizeof(struct flash_log_sector) - \
+				    sizeof(struct flash_log_rec))
+
+struct flash_log_stats {
+	uint32_t	appends;
+	uint32_t	bytes;		/* Of record data appended */
+	uint32_t	sectors;	/* Sectors started */
+	uint32_t	erases;		/* By flash_log_service() */
+	uint32_t	stalls;		/* Appends that had to erase */
+	uint32_t	dropped;	/* Sectors of records erased unread */
+	uint32_t	bad;		/* Records skipped for a bad CRC */
+};
+
+struct flash_log {
+	const struct flash_part *part;
+	uint32_t	sectors;
+	uint32_t	head;		/* Sector being written */
+	uint32_t	head_seq;	/* Its sector sequence */
+	uint32_t	head_off;	/* Where its next record goes */
+	uint32_t	count;		/* Sectors in use, head included */
+	uint32_t	ahead;		/* Erased sectors after the head */
+	uint32_t	next;		/* Sequence of the next record */
+	struct flash_log_stats stats;
+#ifndef SFLASH_EMU
+	void		*lock;
+	void		*task;
+#endif
+};
+
+struct flash_log_cursor {
+	uint32_t	sector;
+	uint32_t	sector_seq;	/* To notice the sector was recycled */
+	uint32_t	off;
+	uint32_t	seq;		/* Of the next record */
+};
+
+/*
+ * Finds the head and tail of the log on partition "id".  A partition
+ * without a log opens empty; its sectors are erased as they are needed.
+ */
+int flash_log_open(struct flash_log *, enum flash_part_id id);
+
+/* Erases the whole partition of an open log */
+int flash_log_format(struct flash_log *);
+
+/* Appends a record of 1 to FLASH_LOG_MAX bytes */
+int flash_log_append(struct flash_log *, uint16_t type, const void *buf,
+    uint32_t len);
+
+/*
+ * Erases the next sector ahead of the writer if fewer than
+ * FLASH_LOG_AHEAD are.  Returns 1 if it erased one, 0 if none was
+ * needed, -1 on error.
+ */
+int flash_log_service(struct flash_log *);
+
+/* Points "c" at the oldest record, or at the sequence "seq" */
+void flash_log_rewind(struct flash_log *, struct flash_log_cursor *c);
+void flash_log_seek(struct flash_log *, struct flash_log_cursor *c,
+    uint32_t seq);
+
+/*
+ * Reads the record at "c" and moves past it.  Returns the data length,
+ * 0 at the end of the log, or -1 if it is longer than "max", leaving
+ * "c" on it.  Records with a bad CRC are skipped.
+ */
+int flash_log_read(struct flash_log *, struct flash_log_cursor *c,
+    uint16_t *type, void *buf, uint32_t max);
+
+/* Sequence of the oldest record */
+uint32_t flash_log_first(struct flash_log *);
+
+#ifndef SFLASH_EMU
+/* Starts an idle priority task running flash_log_service() */
+void flash_log_start(struct flash_log *);
+#endif
+
+/* Formats the statistics as one line of text */
+int flash_log_report(struct flash_log *, char *buf, size_t len);
+
+#endif
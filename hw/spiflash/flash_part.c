@@ -0,0 +1,262 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "crc.h"
+#include "spi_flash.h"
+#include "sflash_cache.h"
+#include "flash_part.h"
+
+#define TABLE_BYTES(n)	(sizeof(struct flash_part_header) + \
+			    (n) * sizeof(struct flash_part_entry))
+
+/* Header, the largest possible entry list and the trailing CRC */
+union part_table {
+	uint32_t	w[(TABLE_BYTES(FLASH_PART_MAX) + 4) / 4];
+	struct {
+		struct flash_part_header	hdr;
+		struct flash_part_entry		ent[FLASH_PART_MAX];
+	} __attribute__((packed)) t;
+};
+
+#define PART(n, a, s, e, f)	[n] = {		\
+	.start = (a),				\
+	.size = (s),				\
+	.erase_size = (e),			\
+	.id = (n),				\
+	.flags = (f)				\
+}
+
+static const struct flash_part flash_part_defaults[FLASH_PART_COUNT] = {
+	PART(FLASH_PART_OEM, FLASH_PART_OEM_ADDR, FLASH_PART_OEM_SIZE,
+	    0x1000, FLASH_PART_RO),
+	PART(FLASH_PART_TABLE, FLASH_PART_TABLE_ADDR, FLASH_PART_TABLE_SIZE,
+	    0x1000, FLASH_PART_RO),
+	PART(FLASH_PART_CRASHLOG, FLASH_PART_CRASHLOG_ADDR,
+	    FLASH_PART_CRASHLOG_SIZE, 0x1000, 0),
+	PART(FLASH_PART_SPIFFS, FLASH_PART_SPIFFS_ADDR, FLASH_PART_SPIFFS_SIZE,
+	    0x10000, FLASH_PART_CACHED),
+	PART(FLASH_PART_ASSETS, FLASH_PART_ASSETS_ADDR, FLASH_PART_ASSETS_SIZE,
+	    0x10000, FLASH_PART_CACHED),
+	PART(FLASH_PART_CONTACTS, FLASH_PART_CONTACTS_ADDR,
+	    FLASH_PART_CONTACTS_SIZE, 0x1000, FLASH_PART_CACHED),
+	PART(FLASH_PART_STAGING, FLASH_PART_STAGING_ADDR,
+	    FLASH_PART_STAGING_SIZE, 0x10000, 0),
+	PART(FLASH_PART_SPIFFS_SNAP, FLASH_PART_SPIFFS_SNAP_ADDR,
+	    FLASH_PART_SPIFFS_SNAP_SIZE, 0x1000, 0),
+	PART(FLASH_PART_LOG, FLASH_PART_LOG_ADDR, FLASH_PART_LOG_SIZE,
+	    0x1000, 0),
+	PART(FLASH_PART_SETTINGS, FLASH_PART_SETTINGS_ADDR,
+	    FLASH_PART_SETTINGS_SIZE, 0x1000, 0),
+	PART(FLASH_PART_SPIFFS_WEAR, FLASH_PART_SPIFFS_WEAR_ADDR,
+	    FLASH_PART_SPIFFS_WEAR_SIZE, 0x1000, 0),
+};
+
+struct flash_part flash_parts[FLASH_PART_COUNT];
+static bool from_table;
+
+static inline bool
+in_part(const struct flash_part *p, uint32_t off, uint32_t len)
+{
+	return off <= p->size && len <= p->size - off;
+}
+
+static bool
+overlaps(const struct flash_part *a, const struct flash_part *b)
+{
+	return a->start < b->start + b->size && b->start < a->start + a->size;
+}
+
+/* Merges a table read from flash into "parts", which holds the defaults */
+static bool
+parse_table(const union part_table *tbl, struct flash_part *parts)
+{
+	static const uint8_t fixed[] = {
+		FLASH_PART_SPIFFS, FLASH_PART_SPIFFS_SNAP, FLASH_PART_SPIFFS_WEAR
+	};
+	const struct flash_part_entry *e;
+	const struct flash_part *d;
+	uint32_t crc;
+	int i, j;
+
+	if (tbl->t.hdr.magic != FLASH_PART_MAGIC ||
+	    tbl->t.hdr.version != FLASH_PART_VERSION ||
+	    tbl->t.hdr.count > FLASH_PART_MAX)
+		return false;
+	memcpy(&crc, (const uint8_t *)tbl->w + TABLE_BYTES(tbl->t.hdr.count),
+	    sizeof(crc));
+	if (crc_block(tbl->w, TABLE_BYTES(tbl->t.hdr.count)) != crc)
+		return false;
+	for (i = 0; i < tbl->t.hdr.count; i++) {
+		e = &tbl->t.ent[i];
+		if (e->id >= FLASH_PART_COUNT)
+			continue;	/* From a newer layout, ignore */
+		if (e->erase_shift != 12 && e->erase_shift != 15 &&
+		    e->erase_shift != 16)
+			return false;
+		if (e->size == 0 || e->start >= sFLASH_SIZE ||
+		    e->size > sFLASH_SIZE - e->start)
+			return false;
+		if ((e->start | e->size) & ((1 << e->erase_shift) - 1))
+			return false;
+		parts[e->id].start = e->start;
+		parts[e->id].size = e->size;
+		parts[e->id].erase_size = 1 << e->erase_shift;
+		parts[e->id].flags = e->flags;
+	}
+	/*
+	 * The SPIFFS geometry is compiled in (SPIFFS_CFG_PHYS_ADDR) and the
+	 * snapshot and wear records describe that layout, so a table may
+	 * not move or resize any of them.
+	 */
+	for (i = 0; i < (int)(sizeof(fixed) / sizeof(fixed[0])); i++) {
+		d = &flash_part_defaults[fixed[i]];
+		if (parts[fixed[i]].start != d->start ||
+		    parts[fixed[i]].size != d->size ||
+		    parts[fixed[i]].erase_size != d->erase_size)
+			return false;
+	}
+	for (i = 0; i < FLASH_PART_COUNT; i++)
+		for (j = i + 1; j < FLASH_PART_COUNT; j++)
+			if (overlaps(&parts[i], &parts[j]))
+				return false;
+	return true;
+}
+
+/*
+ * Reads the partition table.  Returns false, leaving the default
+ * layout in place, if there is no valid table on the flash.
+ */
+bool
+flash_part_init(void)
+{
+	struct flash_part parts[FLASH_PART_COUNT];
+	union part_table tbl;
+
+	memcpy(parts, flash_part_defaults, sizeof(parts));
+	sFLASH_ReadBuffer((uint8_t *)tbl.w, FLASH_PART_TABLE_ADDR, sizeof(tbl));
+	from_table = parse_table(&tbl, parts);
+	memcpy(flash_parts, from_table ? parts : flash_part_defaults,
+	    sizeof(flash_parts));
+	/* Whatever the table says, these are never written through here */
+	flash_parts[FLASH_PART_OEM].flags |= FLASH_PART_RO;
+	flash_parts[FLASH_PART_TABLE].flags |= FLASH_PART_RO;
+	return from_table;
+}
+
+bool
+flash_part_from_table(void)
+{
+	return from_table;
+}
+
+/* Writes the default layout to the table sector. */
+int
+flash_part_format(void)
+{
+	const struct flash_part *d;
+	union part_table tbl;
+	uint32_t crc;
+	int i;
+
+	memset(&tbl, 0xff, sizeof(tbl));
+	tbl.t.hdr.magic = FLASH_PART_MAGIC;
+	tbl.t.hdr.version = FLASH_PART_VERSION;
+	tbl.t.hdr.count = FLASH_PART_COUNT;
+	tbl.t.hdr.reserved = 0;
+	for (i = 0; i < FLASH_PART_COUNT; i++) {
+		d = &flash_part_defaults[i];
+		tbl.t.ent[i].id = d->id;
+		tbl.t.ent[i].flags = d->flags;
+		tbl.t.ent[i].erase_shift = __builtin_ctz(d->erase_size);
+		tbl.t.ent[i].reserved = 0;
+		tbl.t.ent[i].start = d->start;
+		tbl.t.ent[i].size = d->size;
+	}
+	crc = crc_block(tbl.w, TABLE_BYTES(FLASH_PART_COUNT));
+	memcpy((uint8_t *)tbl.w + TABLE_BYTES(FLASH_PART_COUNT), &crc,
+	    sizeof(crc));
+	sFLASH_EraseSector(FLASH_PART_TABLE_ADDR);
+	sFLASH_WriteBuffer((uint8_t *)tbl.w, FLASH_PART_TABLE_ADDR,
+	    TABLE_BYTES(FLASH_PART_COUNT) + 4);
+	return 0;
+}
+
+int
+flash_part_read(const struct flash_part *p, uint32_t off, void *buf, uint32_t len)
+{
+	uint8_t *dst = buf;
+	uint32_t n;
+
+	if (!in_part(p, off, len))
+		return -1;
+	if (p->flags & FLASH_PART_CACHED) {
+		sFLASH_CachedRead(dst, p->start + off, len);
+		return 0;
+	}
+	for (; len > 0; len -= n, off += n, dst += n) {
+		n = len > 0xffff ? 0xffff : len;
+		sFLASH_ReadBuffer(dst, p->start + off, n);
+	}
+	return 0;
+}
+
+int
+flash_part_write(const struct flash_part *p, uint32_t off, const void *buf, uint32_t len)
+{
+	const uint8_t *src = buf;
+	uint32_t n;
+
+	if (p->flags & FLASH_PART_RO)
+		return -1;
+	if (!in_part(p, off, len))
+		return -1;
+	for (; len > 0; len -= n, off += n, src += n) {
+		n = len > 0x8000 ? 0x8000 : len;
+		sFLASH_WriteBuffer((uint8_t *)src, p->start + off, n);
+	}
+	return 0;
+}
+
+/*
+ * Erases whole erase units of the partition, using the largest erase
+ * command the alignment allows.
+ */
+int
+flash_part_erase(const struct flash_part *p, uint32_t off, uint32_t len)
+{
+	uint32_t addr;
+
+	if (p->flags & FLASH_PART_RO)
+		return -1;
+	if ((off | len) & (p->erase_size - 1))
+		return -1;
+	if (!in_part(p, off, len))
+		return -1;
+	for (addr = p->start + off; len > 0;) {
+		if (len >= 0x10000 && (addr & 0xffff) == 0) {
+			sFLASH_Erase64KBlock(addr);
+			addr += 0x10000;
+			len -= 0x10000;
+		} else if (len >= 0x8000 && (addr & 0x7fff) == 0) {
+			sFLASH_Erase32KBlock(addr);
+			addr += 0x8000;
+			len -= 0x8000;
+		} else {
+			sFLASH_EraseSector(addr);
+			addr += 0x1000;
+			len -= 0x1000;
+		}
+	}
+	return 0;
+}
+
+/* CRC32 of part of a partition, see crc.h */
+int
+flash_part_crc(const struct flash_part *p, uint32_t off, uint32_t len,
+    uint32_t *crc)
+{
+	if (!in_part(p, off, len))
+		return -1;
+	*crc = crc_sflash(p->start + off, len);
+	return 0;
+}
@@ -0,0 +1,116 @@
+#ifndef _FLASH_PART_H_
+#define _FLASH_PART_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Partition table for the external SPI flash.
+ *
+ * The table lives in the first sector after the OEM area and is read
+ * once by flash_part_init().  Partitions missing from it (or the whole
+ * table, if it is absent or corrupt) fall back to the defaults below.
+ * Drivers keep the handle returned by flash_part() and do all their
+ * accesses relative to it.
+ */
+
+#define FLASH_PART_TABLE_ADDR		0x100000
+#define FLASH_PART_MAGIC		0x54504654	/* "TFPT" */
+#define FLASH_PART_VERSION		1
+#define FLASH_PART_MAX			16
+
+/* Default layout of a 16MiB W25Q128 */
+#define FLASH_PART_OEM_ADDR		0x000000
+#define FLASH_PART_OEM_SIZE		0x100000
+#define FLASH_PART_TABLE_SIZE		0x001000
+#define FLASH_PART_SETTINGS_ADDR	0x101000
+#define FLASH_PART_SETTINGS_SIZE	0x002000
+#define FLASH_PART_SPIFFS_WEAR_ADDR	0x103000
+#define FLASH_PART_SPIFFS_WEAR_SIZE	0x002000
+#define FLASH_PART_SPIFFS_SNAP_ADDR	0x106000
+#define FLASH_PART_SPIFFS_SNAP_SIZE	0x002000
+#define FLASH_PART_CRASHLOG_ADDR	0x108000
+#define FLASH_PART_CRASHLOG_SIZE	0x008000
+#define FLASH_PART_SPIFFS_ADDR		0x110000
+#define FLASH_PART_SPIFFS_SIZE		0x800000
+#define FLASH_PART_ASSETS_ADDR		0x910000
+#define FLASH_PART_ASSETS_SIZE		0x300000
+#define FLASH_PART_CONTACTS_ADDR	0xc10000
+#define FLASH_PART_CONTACTS_SIZE	0x200000
+#define FLASH_PART_STAGING_ADDR		0xe10000
+#define FLASH_PART_STAGING_SIZE		0x100000
+#define FLASH_PART_LOG_ADDR		0xf10000
+#define FLASH_PART_LOG_SIZE		0x0f0000
+
+enum flash_part_id {
+	FLASH_PART_OEM,		/* Vendor data, never written */
+	FLASH_PART_TABLE,	/* This table */
+	FLASH_PART_CRASHLOG,
+	FLASH_PART_SPIFFS,
+	FLASH_PART_ASSETS,
+	FLASH_PART_CONTACTS,
+	FLASH_PART_STAGING,	/* Firmware update image */
+	FLASH_PART_SPIFFS_SNAP,	/* SPIFFS mount snapshot, see spiffs_snap.c */
+	FLASH_PART_LOG,		/* Ring log, see flash_log.c */
+	FLASH_PART_SETTINGS,	/* Two sectors, see settings.c */
+	FLASH_PART_SPIFFS_WEAR,	/* SPIFFS erase counts, see spiffs_wear.c */
+	FLASH_PART_COUNT
+};
+
+/* Partition flags */
+#define FLASH_PART_RO			0x01	/* Refuse writes and erases */
+#define FLASH_PART_CACHED		0x02	/* Read through the sector cache */
+
+struct flash_part {
+	uint32_t	start;
+	uint32_t	size;
+	uint32_t	erase_size;	/* Smallest erase used, 4k/32k/64k */
+	uint8_t		id;
+	uint8_t		flags;
+};
+
+/* On-flash format, all fields little endian */
+struct flash_part_header {
+	uint32_t	magic;
+	uint16_t	version;
+	uint8_t		count;
+	uint8_t		reserved;
+} __attribute__((packed));
+
+struct flash_part_entry {
+	uint8_t		id;
+	uint8_t		flags;
+	uint8_t		erase_shift;	/* log2 of erase_size */
+	uint8_t		reserved;
+	uint32_t	start;
+	uint32_t	size;
+} __attribute__((packed));
+
+/* The header and entries are followed by a CRC32 of both */
+
+bool flash_part_init(void);
+bool flash_part_from_table(void);
+int flash_part_format(void);
+
+extern struct flash_part flash_parts[FLASH_PART_COUNT];
+
+static inline const struct flash_part *
+flash_part(enum flash_part_id id)
+{
+	return &flash_parts[id];
+}
+
+int flash_part_read(const struct flash_part *p, uint32_t off, void *buf, uint32_t len);
+int flash_part_write(const struct flash_part *p, uint32_t off, const void *buf, uint32_t len);
+int flash_part_erase(const struct flash_part *p, uint32_t off, uint32_t len);
+int flash_part_crc(const struct flash_part *p, uint32_t off, uint32_t len,
+    uint32_t *crc);
+
+static inline bool
+flash_part_contains(const struct flash_part *p, uint32_t addr, uint32_t len)
+{
+	return addr >= p->start && len <= p->size &&
+	    addr - p->start <= p->size - len;
+}
+
+#endif
@@ -0,0 +1,328 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "spi_flash.h"
+#include "sflash_cache.h"
+
+#ifdef SFLASH_EMU
+/* Host builds are single threaded */
+#define CACHE_LOCK()
+#define CACHE_UNLOCK()
+#define CACHE_LOCK_INIT()
+#else
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+static SemaphoreHandle_t cache_mutex;
+#define CACHE_LOCK()		xSemaphoreTake(cache_mutex, portMAX_DELAY)
+#define CACHE_UNLOCK()		xSemaphoreGive(cache_mutex)
+#define CACHE_LOCK_INIT()	do {				\
+	if (cache_mutex == NULL)			\
+		cache_mutex = xSemaphoreCreateMutex();		\
+} while (0)
+#endif
+
+#define CACHE_LINES	(SFLASH_CACHE_SETS * SFLASH_CACHE_WAYS)
+#define LINE_MASK	(SFLASH_CACHE_LINE_SIZE - 1)
+#define CHUNKS		(SFLASH_CACHE_LINE_SIZE >> SFLASH_CACHE_CHUNK_SHIFT)
+#define NO_SECTOR	0xffffffff
+#define NO_ADDR		0xffffffff
+
+#if CHUNKS > 64
+#error "More chunks to a line than a uint64_t has bits"
+#endif
+
+struct cache_line {
+	uint32_t	sector;		/* Cached sector number or NO_SECTOR */
+	uint32_t	age;		/* Value of cache_tick on last use */
+	uint64_t	valid;		/* Chunks read in */
+	uint64_t	ahead;		/* Chunks read ahead, not yet used */
+};
+
+/* The line data lives in CCM, which nothing else uses much. */
+static uint8_t cache_data[CACHE_LINES][SFLASH_CACHE_LINE_SIZE]
+    __attribute__((section(".ccmbss"), aligned(4)));
+static struct cache_line cache_lines[CACHE_LINES];
+static uint32_t cache_tick;
+static uint32_t seq_next = NO_ADDR;	/* Where the last read ended */
+static uint32_t seq_run;		/* Bytes read since its stream began */
+static struct sflash_cache_stats cache_stats;
+static bool cache_ready;
+
+static inline uint8_t *
+line_data(struct cache_line *l)
+{
+	return cache_data[l - cache_lines];
+}
+
+static inline struct cache_line *
+set_of(uint32_t sector)
+{
+	return &cache_lines[(sector % SFLASH_CACHE_SETS) * SFLASH_CACHE_WAYS];
+}
+
+/* Chunks "first" to "end" - 1 */
+static inline uint64_t
+chunks(uint32_t first, uint32_t end)
+{
+	uint64_t m = end - first == 64 ? ~(uint64_t)0 :
+	    ((uint64_t)1 << (end - first)) - 1;
+
+	return m << first;
+}
+
+static struct cache_line *
+lookup(uint32_t sector)
+{
+	struct cache_line *l = set_of(sector);
+	int i;
+
+	for (i = 0; i < SFLASH_CACHE_WAYS; i++)
+		if (l[i].sector == sector)
+			return &l[i];
+	return NULL;
+}
+
+/* Picks an empty way if there is one, else the least recently used. */
+static struct cache_line *
+victim(uint32_t sector)
+{
+	struct cache_line *l = set_of(sector);
+	struct cache_line *v = &l[0];
+	int i;
+
+	for (i = 0; i < SFLASH_CACHE_WAYS; i++) {
+		if (l[i].sector == NO_SECTOR)
+			return &l[i];
+		if (cache_tick - l[i].age > cache_tick - v->age)
+			v = &l[i];
+	}
+	return v;
+}
+
+/* Reads chunks "first" to "end" - 1 of a line with a single command */
+static void
+fill(struct cache_line *l, uint32_t first, uint32_t end)
+{
+	uint32_t off = first << SFLASH_CACHE_CHUNK_SHIFT;
+	uint32_t n = (end - first) << SFLASH_CACHE_CHUNK_SHIFT;
+	uint8_t *p = line_data(l) + off;
+
+	sFLASH_StartReadSequence((l->sector << SFLASH_CACHE_LINE_SHIFT) + off);
+	while (n-- > 0)
+		*p++ = sFLASH_ReadByte();
+	sFLASH_EndReadSequence();
+	l->valid |= chunks(first, end);
+	cache_stats.filled += (end - first) << SFLASH_CACHE_CHUNK_SHIFT;
+}
+
+/*
+ * Returns the line holding bytes "off" to "off" + "len" - 1 of "sector",
+ * reading in the chunks of them it lacks.  Up to "ahead" bytes of chunks
+ * after them are read as well, in the same command.
+ */
+static struct cache_line *
+get_line(uint32_t sector, uint32_t off, uint32_t len, uint32_t ahead)
+{
+	struct cache_line *l = lookup(sector);
+	uint32_t first = off >> SFLASH_CACHE_CHUNK_SHIFT;
+	uint32_t end = ((off + len - 1) >> SFLASH_CACHE_CHUNK_SHIFT) + 1;
+	uint32_t max, next;
+	uint64_t want = chunks(first, end), miss;
+
+	if (l == NULL) {
+		l = victim(sector);
+		l->sector = sector;
+		l->valid = 0;
+		l->ahead = 0;
+	}
+	l->age = ++cache_tick;
+	if (l->ahead & want) {
+		cache_stats.prefetch_hits += __builtin_popcountll(l->ahead &
+		    want);
+		l->ahead &= ~want;
+	}
+
+	/* Read ahead over the chunks not read yet, if the stream wants it */
+	max = end + (ahead >> SFLASH_CACHE_CHUNK_SHIFT);
+	if (max > CHUNKS)
+		max = CHUNKS;
+	for (next = end; next < max && (l->valid >> next & 1) == 0; next++)
+		;
+
+	miss = want & ~l->valid;
+	if (miss == 0) {
+		cache_stats.hits++;
+		/* The stream is running ahead of the cache, top it up */
+		first = end;
+	} else {
+		cache_stats.misses++;
+		while ((miss >> first & 1) == 0)
+			first++;
+		if (next == end)
+			while ((miss >> (next - 1) & 1) == 0)
+				next--;
+	}
+	if (first >= next)
+		return l;
+	fill(l, first, next);
+	if (next > end) {
+		l->ahead |= chunks(end, next);
+		cache_stats.prefetches += next - end;
+	}
+	return l;
+}
+
+void
+sFLASH_CacheInit(void)
+{
+	int i;
+
+	for (i = 0; i < CACHE_LINES; i++)
+		cache_lines[i].sector = NO_SECTOR;
+	CACHE_LOCK_INIT();
+	cache_ready = true;
+}
+
+void
+sFLASH_UncachedRead(uint8_t *buf, uint32_t addr, uint32_t len)
+{
+	uint32_t n;
+
+	if (cache_ready) {
+		CACHE_LOCK();
+		cache_stats.bypasses++;
+	}
+	for (; len > 0; len -= n, addr += n, buf += n) {
+		n = len > 0xffff ? 0xffff : len;
+		sFLASH_ReadBuffer(buf, addr, n);
+	}
+	if (cache_ready)
+		CACHE_UNLOCK();
+}
+
+void
+sFLASH_CachedRead(uint8_t *buf, uint32_t addr, uint32_t len)
+{
+	struct cache_line *l;
+	uint32_t off, n, ahead;
+
+	/* Before init, read through */
+	if (!cache_ready || len >= SFLASH_CACHE_BYPASS) {
+		sFLASH_UncachedRead(buf, addr, len);
+		return;
+	}
+	if (len == 0)
+		return;
+	CACHE_LOCK();
+	if (addr - seq_next <= SFLASH_CACHE_SEQ_GAP)
+		seq_run += len;
+	else
+		seq_run = 0;
+	seq_next = addr + len;
+	ahead = seq_run >= SFLASH_CACHE_SEQ_MIN ? SFLASH_CACHE_PREFETCH : 0;
+	for (; len > 0; len -= n, addr += n, buf += n) {
+		off = addr & LINE_MASK;
+		n = SFLASH_CACHE_LINE_SIZE - off;
+		if (n > len)
+			n = len;
+		l = get_line(addr >> SFLASH_CACHE_LINE_SHIFT, off, n,
+		    n == len ? ahead : 0);
+		memcpy(buf, line_data(l) + off, n);
+	}
+	CACHE_UNLOCK();
+}
+
+void
+sFLASH_CacheFlush(void)
+{
+	int i;
+
+	if (!cache_ready)
+		return;
+	CACHE_LOCK();
+	for (i = 0; i < CACHE_LINES; i++)
+		cache_lines[i].sector = NO_SECTOR;
+	seq_next = NO_ADDR;
+	CACHE_UNLOCK();
+}
+
+void
+sFLASH_CacheStats(struct sflash_cache_stats *st)
+{
+	if (!cache_ready) {
+		memset(st, 0, sizeof(*st));
+		return;
+	}
+	CACHE_LOCK();
+	*st = cache_stats;
+	CACHE_UNLOCK();
+}
+
+void
+sFLASH_CacheLock(void)
+{
+	if (cache_ready)
+		CACHE_LOCK();
+}
+
+void
+sFLASH_CacheUnlock(void)
+{
+	if (cache_ready)
+		CACHE_UNLOCK();
+}
+
+/*
+ * A page program can only clear bits, and wraps around within its
+ * 256 byte page, so apply it to a cached line the same way the flash
+ * does.  Chunks not read in take it too, harmlessly.
+ */
+void
+sFLASH_CacheProgram(const uint8_t *buf, uint32_t addr, uint32_t len)
+{
+	struct cache_line *l;
+	uint32_t page;
+	uint8_t *p;
+	uint32_t i;
+
+	if (!cache_ready || len == 0)
+		return;
+	if (len > sFLASH_SPI_PAGESIZE) {
+		/* Only the last page worth is latched by the chip */
+		buf += len - sFLASH_SPI_PAGESIZE;
+		addr += len - sFLASH_SPI_PAGESIZE;
+		len = sFLASH_SPI_PAGESIZE;
+	}
+	page = addr & ~(sFLASH_SPI_PAGESIZE - 1);
+	l = lookup(page >> SFLASH_CACHE_LINE_SHIFT);
+	if (l != NULL) {
+		p = line_data(l) + (page & LINE_MASK);
+		for (i = 0; i < len; i++)
+			p[(addr + i) & (sFLASH_SPI_PAGESIZE - 1)] &= buf[i];
+		cache_stats.updates++;
+	}
+}
+
+/* An erased line is known without reading it */
+void
+sFLASH_CacheErase(uint32_t addr, uint32_t size)
+{
+	struct cache_line *l;
+	uint32_t sector, end;
+
+	if (!cache_ready)
+		return;
+	/* The flash ignores the address bits below the erase size */
+	addr &= ~(size - 1);
+	end = (addr + size) >> SFLASH_CACHE_LINE_SHIFT;
+	for (sector = addr >> SFLASH_CACHE_LINE_SHIFT; sector < end; sector++) {
+		l = lookup(sector);
+		if (l != NULL) {
+			memset(line_data(l), 0xff, SFLASH_CACHE_LINE_SIZE);
+			l->valid = chunks(0, CHUNKS);
+			l->ahead = 0;
+			cache_stats.updates++;
+		}
+	}
+}
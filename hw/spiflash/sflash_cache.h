@@ -0,0 +1,90 @@
+#ifndef _SFLASH_CACHE_H_
+#define _SFLASH_CACHE_H_
+
+#include <stdint.h>
+
+/*
+ * Set-associative read cache for the external SPI flash, kept in CCM RAM.
+ *
+ * A line is one 4k erase sector, so a sector erase maps onto exactly one
+ * line, but it is filled in chunks: a miss reads only the chunks the
+ * caller asked for, so a scattered small read costs about what it would
+ * uncached.  Once reads have followed each other through the flash for
+ * a while, the chunks after them are read ahead in the same command.
+ *
+ * The cache is write-through: page programs and erases issued through
+ * spi_flash.c are applied to any cached copy under the cache lock, so
+ * lines never go stale.
+ */
+
+#define sFLASH_SIZE			0x1000000	/* W25Q128, 16MiB */
+
+#define SFLASH_CACHE_LINE_SHIFT		12
+#define SFLASH_CACHE_LINE_SIZE		(1 << SFLASH_CACHE_LINE_SHIFT)
+
+/* Unit of filling a line, 64 bytes; a line holds at most 64 of them */
+#ifndef SFLASH_CACHE_CHUNK_SHIFT
+#define SFLASH_CACHE_CHUNK_SHIFT	6
+#endif
+#define SFLASH_CACHE_CHUNK_SIZE		(1 << SFLASH_CACHE_CHUNK_SHIFT)
+
+/*
+ * A read starting at most SFLASH_CACHE_SEQ_GAP bytes after the last one
+ * ended continues its stream, which skips SPIFFS page headers.  Once a
+ * stream has read SFLASH_CACHE_SEQ_MIN bytes past its first read, each
+ * miss reads up to SFLASH_CACHE_PREFETCH more bytes of its line.
+ */
+#ifndef SFLASH_CACHE_SEQ_GAP
+#define SFLASH_CACHE_SEQ_GAP		16
+#endif
+#ifndef SFLASH_CACHE_SEQ_MIN
+#define SFLASH_CACHE_SEQ_MIN		1024
+#endif
+#ifndef SFLASH_CACHE_PREFETCH
+#define SFLASH_CACHE_PREFETCH		1024
+#endif
+
+/*
+ * Number of sets and ways.  The lines live in the 64k CCM, which also
+ * holds .data and the 1k main stack: the default of 4x2 takes 32k of it,
+ * so .data has to stay small (the boot logo is const, in flash).
+ */
+#ifndef SFLASH_CACHE_SETS
+#define SFLASH_CACHE_SETS		4
+#endif
+#ifndef SFLASH_CACHE_WAYS
+#define SFLASH_CACHE_WAYS		2
+#endif
+
+/* Reads at least this long go straight to the flash and are not cached. */
+#ifndef SFLASH_CACHE_BYPASS
+#define SFLASH_CACHE_BYPASS		SFLASH_CACHE_LINE_SIZE
+#endif
+
+struct sflash_cache_stats {
+	uint32_t	hits;		/* Line lookups served from RAM */
+	uint32_t	misses;		/* Line lookups that had to fill */
+	uint32_t	prefetches;	/* Chunks filled ahead of a stream */
+	uint32_t	prefetch_hits;	/* Prefetched chunks later read */
+	uint32_t	filled;		/* Bytes read into lines */
+	uint32_t	bypasses;	/* Large reads sent straight through */
+	uint32_t	updates;	/* Programs/erases applied to a line */
+};
+
+void sFLASH_CacheInit(void);
+void sFLASH_CachedRead(uint8_t *buf, uint32_t addr, uint32_t len);
+/* Reads around the cache, for data read once that would only evict lines */
+void sFLASH_UncachedRead(uint8_t *buf, uint32_t addr, uint32_t len);
+void sFLASH_CacheFlush(void);
+void sFLASH_CacheStats(struct sflash_cache_stats *st);
+
+/*
+ * Coherency hooks for spi_flash.c, which holds the lock from before a
+ * program or erase is sent until its cached copy is updated.
+ */
+void sFLASH_CacheLock(void);
+void sFLASH_CacheUnlock(void);
+void sFLASH_CacheProgram(const uint8_t *buf, uint32_t addr, uint32_t len);
+void sFLASH_CacheErase(uint32_t addr, uint32_t size);
+
+#endif
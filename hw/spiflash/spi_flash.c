@@ -58,6 +58,12 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "spi_flash.h"
+#include "sflash_cache.h"
+
+#ifndef SFLASH_EMU
+#include "FreeRTOS.h"
+#include "semphr.h"
+#endif
 
 /** @addtogroup STM32F4xx_StdPeriph_Examples
   * @{
@@ -70,13 +76,44 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
 /* Private macro -------------------------------------------------------------*/
+/*
+ * Every command and the sFLASH_Busy state it leaves are taken under the bus
+ * lock, so tasks using the flash directly and through the cache cannot
+ * interleave their bytes on SPI.  A task holding the cache lock may take
+ * the bus lock, never the other way around.  Before sFLASH_BusInit() only
+ * the one task runs.
+ */
+#ifdef SFLASH_EMU
+/* Host builds are single threaded */
+#define BUS_LOCK()
+#define BUS_UNLOCK()
+#else
+#define BUS_LOCK()	do {						\
+	if (bus_mutex != NULL)						\
+		xSemaphoreTake(bus_mutex, portMAX_DELAY);		\
+} while (0)
+#define BUS_UNLOCK()	do {						\
+	if (bus_mutex != NULL)						\
+		xSemaphoreGive(bus_mutex);				\
+} while (0)
+#endif
+
 /* Private variables ---------------------------------------------------------*/
+static uint8_t sFLASH_Busy;	/*!< A page program may still be running */
+#ifndef SFLASH_EMU
+static SemaphoreHandle_t bus_mutex;
+#endif
+
 /* Private function prototypes -----------------------------------------------*/
 void sFLASH_LowLevel_DeInit(void);
 void sFLASH_LowLevel_Init(void); 
+static void sFLASH_Sync(void);
+static void sFLASH_WREN(void);
+static void sFLASH_WaitIdle(void);
 
 /* Private functions ---------------------------------------------------------*/
 
+#ifndef SFLASH_EMU	/* The emulator provides the bus level functions */
 /**
   * @brief  DeInitializes the peripherals used by the SPI FLASH driver.
   * @param  None
@@ -117,16 +154,39 @@ void sFLASH_Init(void)
   /*!< Enable the sFLASH_SPI  */
   SPI_Cmd(sFLASH_SPI, ENABLE);
 }
+#endif /* SFLASH_EMU */
+
+/**
+  * @brief  Creates the bus lock, before tasks other than the caller use
+  *         the FLASH.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_BusInit(void)
+{
+#ifndef SFLASH_EMU
+  if (bus_mutex == NULL)
+  {
+    bus_mutex = xSemaphoreCreateMutex();
+  }
+#endif
+}
 
 /**
   * @brief  Erases the specified FLASH sector.
   * @param  SectorAddr: address of the sector to erase.
+  * @param  cmd: erase instruction to send.
+  * @param  size: number of bytes erased by cmd.
   * @retval None
   */
-static void sFLASH_EraseCMD(uint32_t SectorAddr, uint8_t cmd)
+static void sFLASH_EraseCMD(uint32_t SectorAddr, uint8_t cmd, uint32_t size)
 {
+  /*!< No other program or erase between this one and its line update */
+  sFLASH_CacheLock();
+  BUS_LOCK();
+
   /*!< Send write enable instruction */
-  sFLASH_WriteEnable();
+  sFLASH_WREN();
 
   /*!< Sector Erase */
   /*!< Select the FLASH: Chip Select low */
@@ -143,7 +203,12 @@ static void sFLASH_EraseCMD(uint32_t SectorAddr, uint8_t cmd)
   sFLASH_CS_HIGH();
 
   /*!< Wait the end of Flash writing */
-  sFLASH_WaitForWriteEnd();
+  sFLASH_WaitIdle();
+  BUS_UNLOCK();
+
+  /*!< Keep the read cache coherent */
+  sFLASH_CacheErase(SectorAddr, size);
+  sFLASH_CacheUnlock();
 }
 
 /**
@@ -153,7 +218,7 @@ static void sFLASH_EraseCMD(uint32_t SectorAddr, uint8_t cmd)
   */
 void sFLASH_EraseSector(uint32_t SectorAddr)
 {
-  sFLASH_EraseCMD(SectorAddr, sFLASH_CMD_SE);
+  sFLASH_EraseCMD(SectorAddr, sFLASH_CMD_SE, 0x1000);
 }
 
 /**
@@ -163,7 +228,7 @@ void sFLASH_EraseSector(uint32_t SectorAddr)
   */
 void sFLASH_Erase32KBlock(uint32_t SectorAddr)
 {
-  sFLASH_EraseCMD(SectorAddr, sFLASH_CMD_BE32);
+  sFLASH_EraseCMD(SectorAddr, sFLASH_CMD_BE32, 0x8000);
 }
 
 /**
@@ -173,7 +238,7 @@ void sFLASH_Erase32KBlock(uint32_t SectorAddr)
   */
 void sFLASH_Erase64KBlock(uint32_t SectorAddr)
 {
-  sFLASH_EraseCMD(SectorAddr, sFLASH_CMD_BE64);
+  sFLASH_EraseCMD(SectorAddr, sFLASH_CMD_BE64, 0x10000);
 }
 
 /**
@@ -204,6 +269,9 @@ void sFLASH_EraseBulk(void)
   * @brief  Writes more than one byte to the FLASH with a single WRITE cycle 
   *         (Page WRITE sequence).
   * @note   The number of byte can't exceed the FLASH page size.
+  * @note   This function returns while the page is being programmed. The
+  *         next access to the FLASH waits for it to finish, call
+  *         sFLASH_WaitForWriteEnd() to wait right away.
   * @param  pBuffer: pointer to the buffer  containing the data to be written
   *         to the FLASH.
   * @param  WriteAddr: FLASH's internal address to write to.
@@ -213,8 +281,15 @@ void sFLASH_EraseBulk(void)
   */
 void sFLASH_WritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
 {
+  uint8_t *pData = pBuffer;
+  uint16_t NumData = NumByteToWrite;
+
+  /*!< No other program or erase between this one and its line update */
+  sFLASH_CacheLock();
+  BUS_LOCK();
+
   /*!< Enable the write access to the FLASH */
-  sFLASH_WriteEnable();
+  sFLASH_WREN();
 
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
@@ -239,8 +314,13 @@ void sFLASH_WritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWr
   /*!< Deselect the FLASH: Chip Select high */
   sFLASH_CS_HIGH();
 
-  /*!< Wait the end of Flash writing */
-  sFLASH_WaitForWriteEnd();
+  /*!< The next command waits for the end of Flash writing */
+  sFLASH_Busy = 1;
+  BUS_UNLOCK();
+
+  /*!< Keep the read cache coherent */
+  sFLASH_CacheProgram(pData, WriteAddr, NumData);
+  sFLASH_CacheUnlock();
 }
 
 /**
@@ -254,72 +334,25 @@ void sFLASH_WritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWr
   */
 void sFLASH_WriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
 {
-  uint8_t NumOfPage = 0, NumOfSingle = 0, Addr = 0, count = 0, temp = 0;
-
-  Addr = WriteAddr % sFLASH_SPI_PAGESIZE;
-  count = sFLASH_SPI_PAGESIZE - Addr;
-  NumOfPage =  NumByteToWrite / sFLASH_SPI_PAGESIZE;
-  NumOfSingle = NumByteToWrite % sFLASH_SPI_PAGESIZE;
+  uint16_t count;
 
-  if (Addr == 0) /*!< WriteAddr is sFLASH_PAGESIZE aligned  */
+  while (NumByteToWrite > 0)
   {
-    if (NumOfPage == 0) /*!< NumByteToWrite < sFLASH_PAGESIZE */
+    /*!< Up to the end of the FLASH page WriteAddr is in */
+    count = sFLASH_SPI_PAGESIZE - WriteAddr % sFLASH_SPI_PAGESIZE;
+    if (count > NumByteToWrite)
     {
-      sFLASH_WritePage(pBuffer, WriteAddr, NumByteToWrite);
-    }
-    else /*!< NumByteToWrite > sFLASH_PAGESIZE */
-    {
-      while (NumOfPage--)
-      {
-        sFLASH_WritePage(pBuffer, WriteAddr, sFLASH_SPI_PAGESIZE);
-        WriteAddr +=  sFLASH_SPI_PAGESIZE;
-        pBuffer += sFLASH_SPI_PAGESIZE;
-      }
-
-      sFLASH_WritePage(pBuffer, WriteAddr, NumOfSingle);
-    }
-  }
-  else /*!< WriteAddr is not sFLASH_PAGESIZE aligned  */
-  {
-    if (NumOfPage == 0) /*!< NumByteToWrite < sFLASH_PAGESIZE */
-    {
-      if (NumOfSingle > count) /*!< (NumByteToWrite + WriteAddr) > sFLASH_PAGESIZE */
-      {
-        temp = NumOfSingle - count;
-
-        sFLASH_WritePage(pBuffer, WriteAddr, count);
-        WriteAddr +=  count;
-        pBuffer += count;
-
-        sFLASH_WritePage(pBuffer, WriteAddr, temp);
-      }
-      else
-      {
-        sFLASH_WritePage(pBuffer, WriteAddr, NumByteToWrite);
-      }
-    }
-    else /*!< NumByteToWrite > sFLASH_PAGESIZE */
-    {
-      NumByteToWrite -= count;
-      NumOfPage =  NumByteToWrite / sFLASH_SPI_PAGESIZE;
-      NumOfSingle = NumByteToWrite % sFLASH_SPI_PAGESIZE;
-
-      sFLASH_WritePage(pBuffer, WriteAddr, count);
-      WriteAddr +=  count;
-      pBuffer += count;
-
-      while (NumOfPage--)
-      {
-        sFLASH_WritePage(pBuffer, WriteAddr, sFLASH_SPI_PAGESIZE);
-        WriteAddr +=  sFLASH_SPI_PAGESIZE;
-        pBuffer += sFLASH_SPI_PAGESIZE;
-      }
-
-      if (NumOfSingle != 0)
-      {
-        sFLASH_WritePage(pBuffer, WriteAddr, NumOfSingle);
-      }
+      count = NumByteToWrite;
     }
+
+    /*!< The chip programs one page at a time, so this waits for the
+         previous page in its write enable.  Only the cache update of a
+         page, and whatever the caller does after the last one, run
+         while a page programs. */
+    sFLASH_WritePage(pBuffer, WriteAddr, count);
+    WriteAddr += count;
+    pBuffer += count;
+    NumByteToWrite -= count;
   }
 }
 
@@ -332,6 +365,11 @@ void sFLASH_WriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteTo
   */
 void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead)
 {
+  BUS_LOCK();
+
+  /*!< Let a page program finish first */
+  sFLASH_Sync();
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -357,6 +395,7 @@ void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRe
 
   /*!< Deselect the FLASH: Chip Select high */
   sFLASH_CS_HIGH();
+  BUS_UNLOCK();
 }
 
 /**
@@ -368,6 +407,11 @@ void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRe
   */
 void sFLASH_ReadSecurityBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead)
 {
+  BUS_LOCK();
+
+  /*!< Let a page program finish first */
+  sFLASH_Sync();
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -393,6 +437,7 @@ void sFLASH_ReadSecurityBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t Num
 
   /*!< Deselect the FLASH: Chip Select high */
   sFLASH_CS_HIGH();
+  BUS_UNLOCK();
 }
 
 /**
@@ -404,6 +449,11 @@ uint32_t sFLASH_ReadID(void)
 {
   uint32_t Temp = 0, Temp0 = 0, Temp1 = 0, Temp2 = 0;
 
+  BUS_LOCK();
+
+  /*!< Let a page program finish first */
+  sFLASH_Sync();
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -421,6 +471,7 @@ uint32_t sFLASH_ReadID(void)
 
   /*!< Deselect the FLASH: Chip Select high */
   sFLASH_CS_HIGH();
+  BUS_UNLOCK();
 
   Temp = (Temp0 << 16) | (Temp1 << 8) | Temp2;
 
@@ -433,11 +484,17 @@ uint32_t sFLASH_ReadID(void)
   *   instruction is transmitted followed by 3 bytes address. This function exit
   *   and keep the /CS line low, so the Flash still being selected. With this
   *   technique the whole content of the Flash is read with a single READ instruction.
+  * @note   The bus stays taken until sFLASH_EndReadSequence().
   * @param  ReadAddr: FLASH's internal address to read from.
   * @retval None
   */
 void sFLASH_StartReadSequence(uint32_t ReadAddr)
 {
+  BUS_LOCK();
+
+  /*!< Let a page program finish first */
+  sFLASH_Sync();
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -467,6 +524,19 @@ uint8_t sFLASH_ReadByte(void)
   return (sFLASH_SendByte(sFLASH_DUMMY_BYTE));
 }
 
+/**
+  * @brief  Ends the read sequence sFLASH_StartReadSequence() began.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_EndReadSequence(void)
+{
+  /*!< Deselect the FLASH: Chip Select high */
+  sFLASH_CS_HIGH();
+  BUS_UNLOCK();
+}
+
+#ifndef SFLASH_EMU
 /**
   * @brief  Sends a byte through the SPI interface and return the byte received
   *         from the SPI bus.
@@ -508,6 +578,7 @@ uint16_t sFLASH_SendHalfWord(uint16_t HalfWord)
   /*!< Return the Half Word read from the SPI bus */
   return SPI_I2S_ReceiveData(sFLASH_SPI);
 }
+#endif /* SFLASH_EMU */
 
 /**
   * @brief  Enables the write access to the FLASH.
@@ -516,6 +587,34 @@ uint16_t sFLASH_SendHalfWord(uint16_t HalfWord)
   */
 void sFLASH_WriteEnable(void)
 {
+  BUS_LOCK();
+  sFLASH_WREN();
+  BUS_UNLOCK();
+}
+
+/**
+  * @brief  Polls the status of the Write In Progress (WIP) flag in the FLASH's
+  *         status register and loop until write operation has completed.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_WaitForWriteEnd(void)
+{
+  BUS_LOCK();
+  sFLASH_WaitIdle();
+  BUS_UNLOCK();
+}
+
+/**
+  * @brief  Sends the write enable, with the bus taken.
+  * @param  None
+  * @retval None
+  */
+static void sFLASH_WREN(void)
+{
+  /*!< Let a page program finish first */
+  sFLASH_Sync();
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -527,12 +626,11 @@ void sFLASH_WriteEnable(void)
 }
 
 /**
-  * @brief  Polls the status of the Write In Progress (WIP) flag in the FLASH's
-  *         status register and loop until write operation has completed.
+  * @brief  Waits for the end of a program or erase, with the bus taken.
   * @param  None
   * @retval None
   */
-void sFLASH_WaitForWriteEnd(void)
+static void sFLASH_WaitIdle(void)
 {
   uint8_t flashstatus = 0;
 
@@ -554,8 +652,25 @@ void sFLASH_WaitForWriteEnd(void)
 
   /*!< Deselect the FLASH: Chip Select high */
   sFLASH_CS_HIGH();
+
+  sFLASH_Busy = 0;
+}
+
+/**
+  * @brief  Waits for a page program left running by sFLASH_WritePage(),
+  *         with the bus taken.
+  * @param  None
+  * @retval None
+  */
+static void sFLASH_Sync(void)
+{
+  if (sFLASH_Busy)
+  {
+    sFLASH_WaitIdle();
+  }
 }
 
+#ifndef SFLASH_EMU
 /**
   * @brief  Initializes the peripherals used by the SPI FLASH driver.
   * @param  None
@@ -639,6 +754,7 @@ void sFLASH_LowLevel_DeInit(void)
   GPIO_InitStructure.GPIO_Pin = sFLASH_CS_PIN;
   GPIO_Init(sFLASH_CS_GPIO_PORT, &GPIO_InitStructure);
 }
+#endif /* SFLASH_EMU */
 
 /**
   * @}
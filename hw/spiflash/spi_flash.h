@@ -35,10 +35,17 @@
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#ifdef SFLASH_EMU
+/* Host build against the W25Q emulator in host/ */
+#include <stdint.h>
+#include "w25q_emu.h"
+enum { RESET = 0, SET = !RESET };
+#else
 #include "stm32f4xx.h"
 #include "stm32f4xx_gpio.h"
 #include "stm32f4xx_rcc.h"
 #include "stm32f4xx_spi.h"
+#endif
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported constants --------------------------------------------------------*/
@@ -136,16 +143,22 @@
 #define sFLASH_CS_GPIO_CLK                   RCC_AHB1Periph_GPIOD
 
 /* Exported macro ------------------------------------------------------------*/
+#ifdef SFLASH_EMU
+#define sFLASH_CS_LOW()       w25q_select(w25q_dev)
+#define sFLASH_CS_HIGH()      w25q_deselect(w25q_dev)
+#else
 /* Select sFLASH: Chip Select pin low */
 #define sFLASH_CS_LOW()       GPIO_ResetBits(sFLASH_CS_GPIO_PORT, sFLASH_CS_PIN)
 /* Deselect sFLASH: Chip Select pin high */
 #define sFLASH_CS_HIGH()      GPIO_SetBits(sFLASH_CS_GPIO_PORT, sFLASH_CS_PIN)   
+#endif
 
 /* Exported functions ------------------------------------------------------- */
 
 /* High layer functions  */
 void sFLASH_DeInit(void);
 void sFLASH_Init(void);
+void sFLASH_BusInit(void);
 void sFLASH_EraseSector(uint32_t SectorAddr);
 void sFLASH_Erase32KBlock(uint32_t SectorAddr);
 void sFLASH_Erase64KBlock(uint32_t SectorAddr);
@@ -158,6 +171,7 @@ void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRe
 void sFLASH_ReadSecurityBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead);
 uint32_t sFLASH_ReadID(void);
 void sFLASH_StartReadSequence(uint32_t ReadAddr);
+void sFLASH_EndReadSequence(void);
 
 /* Low layer functions */
 uint8_t sFLASH_ReadByte(void);
@@ -91,9 +91,10 @@
   * @{
   */ 
 
-#define USB_CDC_IDLE         0
-#define USB_CDC_BUSY         1
-#define USB_CDC_ZLP          2
+#define USB_CDC_IDLE         0  /* Nothing in flight */
+#define USB_CDC_BUSY         1  /* A short packet or a ZLP in flight */
+#define USB_CDC_ZLP          2  /* A full packet in flight, a ZLP ends the
+                                   transfer if no data follows */
 
 /**
   * @}
@@ -186,13 +187,19 @@ __ALIGN_BEGIN uint8_t CmdBuff[CDC_CMD_PACKET_SZE] __ALIGN_END ;
 
 uint32_t APP_Rx_ptr_in  = 0;
 uint32_t APP_Rx_ptr_out = 0;
-uint32_t APP_Rx_length  = 0;
 
 uint8_t  USB_Tx_State = USB_CDC_IDLE;
 
 static uint32_t cdcCmd = 0xFF;
 static uint32_t cdcLen = 0;
 
+/* Device whose OUT endpoint was left unarmed because the interface had no
+   room, NULL if it is armed */
+static void *cdcRxPaused = NULL;
+
+/* Configured device, NULL if none */
+static void *cdcDev = NULL;
+
 /* CDC interface class callbacks structure */
 USBD_Class_cb_TypeDef  USBD_CDC_cb = 
 {
@@ -462,6 +469,9 @@ uint8_t  usbd_cdc_Init (void  *pdev,
   APP_FOPS.pIf_Init();
 
   /* Prepare Out endpoint to receive next packet */
+  cdcRxPaused = NULL;
+  USB_Tx_State = USB_CDC_IDLE;
+  cdcDev = pdev;
   DCD_EP_PrepareRx(pdev,
                    CDC_OUT_EP,
                    (uint8_t*)(USB_Rx_Buffer),
@@ -487,6 +497,8 @@ uint8_t  usbd_cdc_DeInit (void  *pdev,
   /* Open EP OUT */
   DCD_EP_Close(pdev,
               CDC_OUT_EP);
+  cdcRxPaused = NULL;
+  cdcDev = NULL;
   
   /* Open Command IN EP */
   DCD_EP_Close(pdev,
@@ -612,57 +624,12 @@ uint8_t  usbd_cdc_EP0_RxReady (void  *pdev __attribute__((unused)))
   */
 uint8_t  usbd_cdc_DataIn (void *pdev, uint8_t epnum __attribute__((unused)))
 {
-  uint16_t USB_Tx_ptr;
-  uint16_t USB_Tx_length;
-  
-  if (USB_Tx_State == USB_CDC_BUSY)
+  /* Chain the next packet, or the ZLP, straight away */
+  if (USB_Tx_State != USB_CDC_IDLE)
   {
-    if (APP_Rx_length == 0) 
-    {
-      USB_Tx_State = USB_CDC_IDLE;
-    }
-    else 
-    {
-      if (APP_Rx_length > CDC_DATA_IN_PACKET_SIZE){
-        USB_Tx_ptr = APP_Rx_ptr_out;
-        USB_Tx_length = CDC_DATA_IN_PACKET_SIZE;
-        
-        APP_Rx_ptr_out += CDC_DATA_IN_PACKET_SIZE;
-        APP_Rx_length -= CDC_DATA_IN_PACKET_SIZE;    
-      }
-      else 
-      {
-        USB_Tx_ptr = APP_Rx_ptr_out;
-        USB_Tx_length = APP_Rx_length;
-        
-        APP_Rx_ptr_out += APP_Rx_length;
-        APP_Rx_length = 0;
-        if(USB_Tx_length == CDC_DATA_IN_PACKET_SIZE)
-        {
-          USB_Tx_State = USB_CDC_ZLP;
-        }
-      }
-      
-      /* Prepare the available data buffer to be sent on IN endpoint */
-      DCD_EP_Tx (pdev,
-                 CDC_IN_EP,
-                 (uint8_t*)&APP_Rx_Buffer[USB_Tx_ptr],
-                 USB_Tx_length);
-      return USBD_OK;
-    }
-  }  
-  
-  /* Avoid any asynchronous transfer during ZLP */
-  if (USB_Tx_State == USB_CDC_ZLP)
-  {
-    /*Send ZLP to indicate the end of the current transfer */
-    DCD_EP_Tx (pdev,
-               CDC_IN_EP,
-               NULL,
-               0);
-    
-    USB_Tx_State = USB_CDC_IDLE;
+    Handle_USBAsynchXfer(pdev);
   }
+  APP_FOPS.pIf_DataTxDone();
   return USBD_OK;
 }
 
@@ -682,7 +649,12 @@ uint8_t  usbd_cdc_DataOut (void *pdev, uint8_t epnum)
   
   /* USB data will be immediately processed, this allow next USB traffic being 
   NAKed till the end of the application Xfer */
-  APP_FOPS.pIf_DataRx(USB_Rx_Buffer, USB_Rx_Cnt);
+  if (APP_FOPS.pIf_DataRx(USB_Rx_Buffer, USB_Rx_Cnt) != USBD_OK)
+  {
+    /* No room for another packet, NAK the host until usbd_cdc_ResumeRx */
+    cdcRxPaused = pdev;
+    return USBD_OK;
+  }
   
   /* Prepare Out endpoint to receive next packet */
   DCD_EP_PrepareRx(pdev,
@@ -693,9 +665,46 @@ uint8_t  usbd_cdc_DataOut (void *pdev, uint8_t epnum)
   return USBD_OK;
 }
 
+/**
+  * @brief  usbd_cdc_ResumeRx
+  *         Arms the Out endpoint again after the interface made room.  To be
+  *         called with the USB interrupt masked.
+  * @param  None
+  * @retval None
+  */
+void usbd_cdc_ResumeRx (void)
+{
+  void *pdev = cdcRxPaused;
+
+  if (pdev != NULL)
+  {
+    cdcRxPaused = NULL;
+    DCD_EP_PrepareRx(pdev,
+                     CDC_OUT_EP,
+                     (uint8_t*)(USB_Rx_Buffer),
+                     CDC_DATA_OUT_PACKET_SIZE);
+  }
+}
+
+/**
+  * @brief  usbd_cdc_StartTx
+  *         Starts sending queued data if the IN endpoint is idle.  To be
+  *         called with the USB interrupt masked.
+  * @param  None
+  * @retval None
+  */
+void usbd_cdc_StartTx (void)
+{
+  if (cdcDev != NULL && USB_Tx_State == USB_CDC_IDLE)
+  {
+    Handle_USBAsynchXfer(cdcDev);
+  }
+}
+
 /**
   * @brief  usbd_audio_SOF
-  *         Start Of Frame event management
+  *         Start Of Frame event management.  Writers start their own
+  *         transfers, so this only catches data they left behind.
   * @param  pdev: instance
   * @param  epnum: endpoint number
   * @retval status
@@ -710,7 +719,10 @@ uint8_t  usbd_cdc_SOF (void *pdev)
     FrameCount = 0;
     
     /* Check the data to be sent through IN pipe */
-    Handle_USBAsynchXfer(pdev);
+    if (USB_Tx_State == USB_CDC_IDLE)
+    {
+      Handle_USBAsynchXfer(pdev);
+    }
   }
   
   return USBD_OK;
@@ -718,73 +730,64 @@ uint8_t  usbd_cdc_SOF (void *pdev)
 
 /**
   * @brief  Handle_USBAsynchXfer
-  *         Send data to USB
+  *         Sends the next packet from APP_Rx_Buffer, or the ZLP that ends a
+  *         transfer of whole packets.  Only called with nothing in flight.
   * @param  pdev: instance
   * @retval None
   */
 static void Handle_USBAsynchXfer (void *pdev)
 {
-  uint16_t USB_Tx_ptr;
-  uint16_t USB_Tx_length;
+  uint32_t USB_Tx_ptr;
+  uint32_t USB_Tx_length;
   
-  if(USB_Tx_State == USB_CDC_IDLE)
+  if (APP_Rx_ptr_out == APP_RX_DATA_SIZE)
   {
-    if (APP_Rx_ptr_out == APP_RX_DATA_SIZE)
-    {
-      APP_Rx_ptr_out = 0;
-    }
-    
-    if(APP_Rx_ptr_out == APP_Rx_ptr_in) 
-    {
-      USB_Tx_State = USB_CDC_IDLE; 
-      return;
-    }
-    
-    if(APP_Rx_ptr_out > APP_Rx_ptr_in) /* rollback */
-    { 
-      APP_Rx_length = APP_RX_DATA_SIZE - APP_Rx_ptr_out;
-      
-    }
-    else 
-    {
-      APP_Rx_length = APP_Rx_ptr_in - APP_Rx_ptr_out;
-      
-    }
-#ifdef USB_OTG_HS_INTERNAL_DMA_ENABLED
-    APP_Rx_length &= ~0x03;
-#endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
-    
-    if (APP_Rx_length > CDC_DATA_IN_PACKET_SIZE)
+    APP_Rx_ptr_out = 0;
+  }
+  USB_Tx_ptr = APP_Rx_ptr_out;
+  
+  if (APP_Rx_ptr_out > APP_Rx_ptr_in) /* rollback */
+  { 
+    USB_Tx_length = APP_RX_DATA_SIZE - APP_Rx_ptr_out;
+  }
+  else 
+  {
+    USB_Tx_length = APP_Rx_ptr_in - APP_Rx_ptr_out;
+  }
+  
+  if (USB_Tx_length == 0)
+  {
+    if (USB_Tx_State == USB_CDC_ZLP)
     {
-      USB_Tx_ptr = APP_Rx_ptr_out;
-      USB_Tx_length = CDC_DATA_IN_PACKET_SIZE;
-      
-      APP_Rx_ptr_out += CDC_DATA_IN_PACKET_SIZE;	
-      APP_Rx_length -= CDC_DATA_IN_PACKET_SIZE;
+      /*Send ZLP to indicate the end of the current transfer */
+      DCD_EP_Tx (pdev,
+                 CDC_IN_EP,
+                 NULL,
+                 0);
       USB_Tx_State = USB_CDC_BUSY;
     }
     else
     {
-      USB_Tx_ptr = APP_Rx_ptr_out;
-      USB_Tx_length = APP_Rx_length;
-      
-      APP_Rx_ptr_out += APP_Rx_length;
-      APP_Rx_length = 0;
-      if(USB_Tx_length == CDC_DATA_IN_PACKET_SIZE)
-      {
-        USB_Tx_State = USB_CDC_ZLP;
-      }
-      else
-      {
-        USB_Tx_State = USB_CDC_BUSY;
-      }
+      USB_Tx_State = USB_CDC_IDLE;
     }
-    
-    DCD_EP_Tx (pdev,
-               CDC_IN_EP,
-               (uint8_t*)&APP_Rx_Buffer[USB_Tx_ptr],
-               USB_Tx_length);
-  }  
+    return;
+  }
+  
+  if (USB_Tx_length >= CDC_DATA_IN_PACKET_SIZE)
+  {
+    USB_Tx_length = CDC_DATA_IN_PACKET_SIZE;
+    USB_Tx_State = USB_CDC_ZLP;
+  }
+  else
+  {
+    USB_Tx_State = USB_CDC_BUSY;
+  }
+  APP_Rx_ptr_out += USB_Tx_length;
+  
+  DCD_EP_Tx (pdev,
+             CDC_IN_EP,
+             (uint8_t*)&APP_Rx_Buffer[USB_Tx_ptr],
+             USB_Tx_length);
 }
 
 /**
@@ -97,6 +97,7 @@ typedef struct _CDC_IF_PROP
   uint16_t (*pIf_Ctrl)     (uint32_t Cmd, uint8_t* Buf, uint32_t Len);
   uint16_t (*pIf_DataTx)   (uint8_t* Buf, uint32_t Len);
   uint16_t (*pIf_DataRx)   (uint8_t* Buf, uint32_t Len);
+  uint16_t (*pIf_DataTxDone) (void);
 }
 CDC_IF_Prop_TypeDef;
 /**
@@ -125,6 +126,8 @@ extern USBD_Class_cb_TypeDef  USBD_CDC_cb;
 /** @defgroup USB_CORE_Exported_Functions
   * @{
   */
+void usbd_cdc_ResumeRx (void);
+void usbd_cdc_StartTx (void);
 /**
   * @}
   */ 
@@ -30,14 +30,21 @@
 #endif /* USB_OTG_HS_INTERNAL_DMA_ENABLED */
 
 /* Includes ------------------------------------------------------------------*/
+#include <string.h>
+
 #include "FreeRTOS.h"
-#include "queue.h"
+#include "semphr.h"
+#include "task.h"
 #include "usbd_cdc_vcp.h"
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
-/** Size in bytes of the receive queue. */
-#define RX_QUEUE_LEN 128
+/** Size in bytes of the receive ring, a power of 2. */
+#define RX_RING_SIZE 1024
+/** Most bytes a reader waits for before it is woken. */
+#define RX_TRIGGER_MAX (RX_RING_SIZE / 2)
+/** Most room a writer waits for before it is woken. */
+#define TX_TRIGGER_MAX (APP_RX_DATA_SIZE / 2)
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 LINE_CODING linecoding =
@@ -57,9 +64,24 @@ extern uint8_t  APP_Rx_Buffer []; /* Write CDC received data in this buffer.
 extern uint32_t APP_Rx_ptr_in;    /* Increment this pointer or roll it back to
                                      start address when writing received data
                                      in the buffer APP_Rx_Buffer. */
-
-/** Receive buffer read by "VCP_Read". */
-QueueHandle_t g_rx_queue;
+extern uint32_t APP_Rx_ptr_out;   /* Start of the data not yet handed to the
+                                     IN endpoint, may equal APP_RX_DATA_SIZE. */
+
+/** Receive ring, filled by "VCP_DataRx" and emptied by "VCP_Read".
+    Each index is only written by one side and runs freely. */
+static uint8_t rx_ring[RX_RING_SIZE];
+static volatile uint32_t rx_head;
+static volatile uint32_t rx_tail;
+/** Bytes the waiting reader wants before it is notified, 0 if none. */
+static volatile uint32_t rx_want;
+static TaskHandle_t rx_reader;
+
+/** Room the waiting writer wants before it is notified, 0 if none. */
+static volatile uint32_t tx_want;
+static TaskHandle_t tx_writer;
+/** Held by the writer whose bytes are going in. */
+static SemaphoreHandle_t tx_lock;
+static VCP_TxStats_TypeDef tx_stats;
 
 /* Private function prototypes -----------------------------------------------*/
 static uint16_t VCP_Init     (void);
@@ -67,6 +89,7 @@ static uint16_t VCP_DeInit   (void);
 static uint16_t VCP_Ctrl     (uint32_t Cmd, uint8_t* Buf, uint32_t Len);
 static uint16_t VCP_DataTx   (uint8_t* buf, uint32_t len);
 static uint16_t VCP_DataRx   (uint8_t* Buf, uint32_t Len);
+static uint16_t VCP_DataTxDone (void);
 
 CDC_IF_Prop_TypeDef VCP_fops = 
 {
@@ -74,7 +97,8 @@ CDC_IF_Prop_TypeDef VCP_fops =
   VCP_DeInit,
   VCP_Ctrl,
   VCP_DataTx,
-  VCP_DataRx
+  VCP_DataRx,
+  VCP_DataTxDone
 };
 
 /* Private functions ---------------------------------------------------------*/
@@ -97,7 +121,6 @@ static uint16_t VCP_Init(void)
   */
 static uint16_t VCP_DeInit(void)
 {
-  /* TODO: Free the Queue? */
   return USBD_OK;
 }
 
@@ -168,70 +191,266 @@ static uint16_t VCP_Ctrl (uint32_t Cmd, uint8_t* Buf, uint32_t Len __attribute__
   return USBD_OK;
 }
 
+/**
+  * @brief  VCP_TxRoom
+  *         Room left in APP_Rx_Buffer.  Besides the byte that tells a full
+  *         buffer from an empty one, this keeps back the packet just before
+  *         APP_Rx_ptr_out, which the IN endpoint may still be sending.
+  * @param  None
+  * @retval Number of bytes that can be queued
+  */
+static uint32_t VCP_TxRoom(void)
+{
+  uint32_t used = (APP_Rx_ptr_in + APP_RX_DATA_SIZE - APP_Rx_ptr_out) % APP_RX_DATA_SIZE;
+
+  if (used >= APP_RX_DATA_SIZE - 1 - CDC_DATA_IN_PACKET_SIZE)
+    return 0;
+  return APP_RX_DATA_SIZE - 1 - CDC_DATA_IN_PACKET_SIZE - used;
+}
+
+/**
+  * @brief  VCP_TxPut
+  *         Queues as much of "buf" as fits for the IN endpoint.
+  * @retval Number of bytes queued
+  */
+static uint32_t VCP_TxPut(const uint8_t *buf, uint32_t len)
+{
+  uint32_t in, n;
+
+  taskENTER_CRITICAL();
+  in = APP_Rx_ptr_in;
+  if (len > VCP_TxRoom())
+    len = VCP_TxRoom();
+  n = len < APP_RX_DATA_SIZE - in ? len : APP_RX_DATA_SIZE - in;
+  memcpy(&APP_Rx_Buffer[in], buf, n);
+  memcpy(APP_Rx_Buffer, buf + n, len - n);
+  APP_Rx_ptr_in = (in + len) % APP_RX_DATA_SIZE;
+  tx_stats.bytes += len;
+  if (len != 0)
+    usbd_cdc_StartTx();
+  taskEXIT_CRITICAL();
+  return len;
+}
+
 /**
   * @brief  VCP_DataTx
   *         CDC received data to be send over USB IN endpoint are managed in 
-  *         this function.
+  *         this function.  What does not fit is dropped.
   * @param  Buf: Buffer of data to be sent
   * @param  Len: Number of data to be sent (in bytes)
-  * @retval Result of the operation: USBD_OK if all operations are OK else VCP_FAIL
+  * @retval Result of the operation: USBD_OK if all data was queued else USBD_BUSY
   */
 static uint16_t VCP_DataTx (uint8_t* buf, uint32_t len)
 {
-  /* XXX what happens if len > APP_RX_DATA_SIZE? */
-  for (uint32_t i = 0; i < len; ++i) {
-    APP_Rx_Buffer[APP_Rx_ptr_in++] = buf[i];
+  return VCP_Write(buf, len, 0) == len ? USBD_OK : USBD_BUSY;
+}
 
-    if (APP_Rx_ptr_in == APP_RX_DATA_SIZE)
-      APP_Rx_ptr_in = 0;
-  }
+/**
+  * @brief  VCP_DataTxDone
+  *         Called from the interrupt when the IN endpoint has sent a packet,
+  *         wakes the writer once the room it waits for is there.
+  * @param  None
+  * @retval USBD_OK
+  */
+static uint16_t VCP_DataTxDone (void)
+{
+  portBASE_TYPE should_yield = pdFALSE;
 
+  if (tx_want != 0 && VCP_TxRoom() >= tx_want) {
+    tx_want = 0;
+    vTaskNotifyGiveFromISR(tx_writer, &should_yield);
+  }
+  portEND_SWITCHING_ISR(should_yield);
   return USBD_OK;
 }
 
+void VCP_TxInit(void)
+{
+  if (tx_lock == NULL)
+    tx_lock = xSemaphoreCreateMutex();
+}
+
+/**
+  * @brief  VCP_Write
+  *         Queues "len" bytes for the IN endpoint.  With a timeout the writer
+  *         waits for room, giving up once none has come free for "timeout".
+  *         Writes do not interleave, so a frame another task writes comes
+  *         out whole: a writer waits as long for the one before it to
+  *         finish, and one without a timeout gives up if another write is
+  *         under way.  Bytes not queued are counted as dropped.
+  * @retval Number of bytes queued
+  */
+uint32_t VCP_Write(const uint8_t *buf, uint32_t len, TickType_t timeout)
+{
+  uint32_t done = 0;
+  uint32_t n;
+
+  if (tx_lock == NULL || xSemaphoreTake(tx_lock, timeout)) {
+    done = VCP_TxPut(buf, len);
+    while (done < len && timeout != 0) {
+      n = len - done < TX_TRIGGER_MAX ? len - done : TX_TRIGGER_MAX;
+      taskENTER_CRITICAL();
+      tx_writer = xTaskGetCurrentTaskHandle();
+      tx_want = VCP_TxRoom() >= n ? 0 : n;
+      taskEXIT_CRITICAL();
+      if (tx_want != 0)
+        tx_stats.waits++;
+      if (tx_want != 0 && ulTaskNotifyTake(pdTRUE, timeout) == 0 &&
+          VCP_TxRoom() == 0) {
+        tx_want = 0;
+        break;
+      }
+      tx_want = 0;
+      done += VCP_TxPut(buf + done, len - done);
+    }
+    if (tx_lock != NULL)
+      xSemaphoreGive(tx_lock);
+  }
+
+  if (done < len) {
+    taskENTER_CRITICAL();
+    tx_stats.dropped += len - done;
+    tx_stats.short_writes++;
+    taskEXIT_CRITICAL();
+  }
+  return done;
+}
+
+void VCP_GetTxStats(VCP_TxStats_TypeDef *stats)
+{
+  taskENTER_CRITICAL();
+  *stats = tx_stats;
+  taskEXIT_CRITICAL();
+}
+
 /**
   * @brief  VCP_DataRx
   *         Data received over USB OUT endpoint are sent over CDC interface 
   *         through this function.
   *           
   *         @note
-  *         This function will block any OUT packet reception on USB endpoint 
-  *         until exiting this function. If you exit this function before transfer
-  *         is complete on CDC interface (ie. using DMA controller) it will result 
-  *         in receiving more data while previous ones are still not sent.
+  *         The OUT endpoint is only armed again if the ring still has room
+  *         for a whole packet.  Otherwise the host is NAKed until "VCP_Read"
+  *         has made room.
   *                 
   * @param  Buf: Buffer of data received
   * @param  Len: Number of data received (in bytes)
-  * @retval Result of the operation: USBD_OK if all operations are OK else VCP_FAIL
+  * @retval USBD_OK if the next packet fits, else USBD_BUSY
   */
 static uint16_t VCP_DataRx (uint8_t* Buf, uint32_t Len)
 {
   portBASE_TYPE should_yield = pdFALSE;
-
-  for (uint32_t i = 0; i < Len; ++i) {
-    if (!xQueueSendFromISR(g_rx_queue, &Buf[i], &should_yield))
-      break;
+  uint32_t head = rx_head;
+  uint32_t off = head & (RX_RING_SIZE - 1);
+  uint32_t n;
+
+  /* Cannot overflow while the endpoint is only armed with room to spare */
+  if (Len > RX_RING_SIZE - (head - rx_tail))
+    Len = RX_RING_SIZE - (head - rx_tail);
+  n = Len < RX_RING_SIZE - off ? Len : RX_RING_SIZE - off;
+  memcpy(&rx_ring[off], Buf, n);
+  memcpy(rx_ring, Buf + n, Len - n);
+  __DMB();
+  rx_head = head += Len;
+
+  if (rx_want != 0 && head - rx_tail >= rx_want) {
+    rx_want = 0;
+    vTaskNotifyGiveFromISR(rx_reader, &should_yield);
   }
-
   portEND_SWITCHING_ISR(should_yield);
+
+  if (RX_RING_SIZE - (head - rx_tail) < CDC_DATA_OUT_PACKET_SIZE)
+    return USBD_BUSY;
   return USBD_OK;
 }
 
-void VCP_QInit(void)
+/**
+  * @brief  VCP_RxTake
+  *         Moves up to "len" bytes out of the receive ring, and lets the
+  *         host send again if that made room for a packet.
+  * @retval Number of bytes moved
+  */
+static uint32_t VCP_RxTake(uint8_t *buf, uint32_t len)
 {
-  g_rx_queue = xQueueCreate(RX_QUEUE_LEN, 1);
+  uint32_t tail = rx_tail;
+  uint32_t off = tail & (RX_RING_SIZE - 1);
+  uint32_t n;
+
+  if (len > rx_head - tail)
+    len = rx_head - tail;
+  if (len == 0)
+    return 0;
+  __DMB();
+  n = len < RX_RING_SIZE - off ? len : RX_RING_SIZE - off;
+  memcpy(buf, &rx_ring[off], n);
+  memcpy(buf + n, rx_ring, len - n);
+  __DMB();
+  rx_tail = tail + len;
+
+  taskENTER_CRITICAL();
+  if (RX_RING_SIZE - (rx_head - rx_tail) >= CDC_DATA_OUT_PACKET_SIZE)
+    usbd_cdc_ResumeRx();
+  taskEXIT_CRITICAL();
+  return len;
 }
 
-uint32_t VCP_Read(uint8_t *buf, uint32_t len, TickType_t timeout)
+void VCP_RxInit(void)
 {
-  uint32_t i;
+  rx_head = rx_tail = 0;
+  rx_want = 0;
+}
 
-  for (i = 0; i < len; ++i, ++buf) {
-    if (!xQueueReceive(g_rx_queue, buf, timeout))
+/**
+  * @brief  VCP_ReadMin
+  *         Reads at least "min" and at most "len" bytes, giving up once
+  *         "timeout" passes without any data arriving.  The reader sleeps
+  *         until the ring holds what it still needs, up to RX_TRIGGER_MAX
+  *         bytes.  Only one task may read.
+  * @retval Number of bytes read
+  */
+static uint32_t VCP_ReadMin(uint8_t *buf, uint32_t min, uint32_t len, TickType_t timeout)
+{
+  uint32_t got = 0;
+  uint32_t n;
+
+  while (got < min) {
+    n = VCP_RxTake(buf + got, len - got);
+    if (n != 0) {
+      got += n;
+      continue;
+    }
+
+    n = min - got < RX_TRIGGER_MAX ? min - got : RX_TRIGGER_MAX;
+    rx_reader = xTaskGetCurrentTaskHandle();
+    rx_want = n;
+    if (rx_head - rx_tail >= n) {
+      rx_want = 0;
+      continue;
+    }
+    if (ulTaskNotifyTake(pdTRUE, timeout) == 0 && rx_head == rx_tail) {
+      rx_want = 0;
       break;
+    }
+    rx_want = 0;
   }
 
-  return i;
+  return got;
+}
+
+uint32_t VCP_Read(uint8_t *buf, uint32_t len, TickType_t timeout)
+{
+  return VCP_ReadMin(buf, len, len, timeout);
+}
+
+/**
+  * @brief  VCP_ReadSome
+  *         Reads what has arrived, up to "len" bytes, waiting up to
+  *         "timeout" if nothing has.
+  * @retval Number of bytes read
+  */
+uint32_t VCP_ReadSome(uint8_t *buf, uint32_t len, TickType_t timeout)
+{
+  return VCP_ReadMin(buf, len != 0, len, timeout);
 }
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
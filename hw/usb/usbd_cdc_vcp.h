@@ -47,14 +47,27 @@ typedef struct
   uint8_t  datatype;
 }LINE_CODING;
 
+/* Counts of the IN path since boot */
+typedef struct
+{
+  uint32_t bytes;         /* Queued */
+  uint32_t dropped;       /* Not queued for lack of room */
+  uint32_t short_writes;  /* Writes that dropped bytes */
+  uint32_t waits;         /* Times a writer waited for room */
+}VCP_TxStats_TypeDef;
+
 #define DEFAULT_CONFIG                  0
 #define OTHER_CONFIG                    1
 
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 
-void VCP_QInit(void);
+void VCP_RxInit(void);
 uint32_t VCP_Read(uint8_t *buf, uint32_t len, TickType_t timeout);
+uint32_t VCP_ReadSome(uint8_t *buf, uint32_t len, TickType_t timeout);
+void VCP_TxInit(void);
+uint32_t VCP_Write(const uint8_t *buf, uint32_t len, TickType_t timeout);
+void VCP_GetTxStats(VCP_TxStats_TypeDef *stats);
 
 #endif /* __USBD_CDC_VCP_H */
 
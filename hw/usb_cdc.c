@@ -14,6 +14,7 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdio.h>
 
 #include <FreeRTOS.h>
 
@@ -43,17 +44,39 @@ void OTG_FS_IRQHandler(void)
 
 void usb_cdc_init(void)
 {
-  VCP_QInit();
+  VCP_RxInit();
+  VCP_TxInit();
   USBD_Init(&g_usb_dev, USB_OTG_FS_CORE_ID, &USR_desc,
             &USBD_CDC_cb, &USR_cb);
 }
 
 ssize_t usb_cdc_write(const void *buf, size_t len)
 {
-  return APP_FOPS.pIf_DataTx((uint8_t *)buf, len);
+  return VCP_Write((const uint8_t *)buf, len, 0);
+}
+
+ssize_t usb_cdc_write_timeout(const void *buf, size_t len, uint32_t timeout)
+{
+  return VCP_Write((const uint8_t *)buf, len, timeout);
 }
 
 ssize_t usb_cdc_read_timeout(void *buf, size_t len, uint32_t timeout)
 {
   return VCP_Read((uint8_t *)buf, len, timeout);
 }
+
+ssize_t usb_cdc_read_some(void *buf, size_t len, uint32_t timeout)
+{
+  return VCP_ReadSome((uint8_t *)buf, len, timeout);
+}
+
+int usb_cdc_report(char *buf, size_t len)
+{
+  VCP_TxStats_TypeDef st;
+
+  VCP_GetTxStats(&st);
+  return snprintf(buf, len, "usb tx: %lu bytes, %lu dropped in %lu writes, "
+                  "%lu waits\n", (unsigned long)st.bytes,
+                  (unsigned long)st.dropped, (unsigned long)st.short_writes,
+                  (unsigned long)st.waits);
+}
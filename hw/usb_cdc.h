@@ -29,20 +29,40 @@ extern "C" {
 void usb_cdc_init(void);
 
 /**
- * Write to the CDC port.  This function will never block, so there is
- * no version that accepts a timeout.
+ * Write to the CDC port.  This function will never block; what does
+ * not fit in the transmit buffer is dropped and counted, and so is all
+ * of it while another task's write is under way.  Writes never
+ * interleave, so what each one queues goes out in one piece.
  *
  * @returns the number of bytes written, or -1 on failure
  */
 ssize_t usb_cdc_write(const void *buf, size_t len);
 
 /**
- * Read from the CDC port, delaying for at most timeout*len ms.
+ * Write to the CDC port, waiting for room in the transmit buffer until
+ * none has come free for timeout ticks, and as long for another task's
+ * write to finish first.
+ *
+ * @returns the number of bytes written, or -1 on failure
+ */
+ssize_t usb_cdc_write_timeout(const void *buf, size_t len, uint32_t timeout);
+
+/**
+ * Read from the CDC port, giving up once no data has arrived for
+ * timeout ticks.  Only one task may read at a time.
  *
  * @returns the number of bytes read into "buf", or -1 on failure
  */
 ssize_t usb_cdc_read_timeout(void *buf, size_t len, uint32_t timeout);
 
+/**
+ * Read what has arrived on the CDC port, up to len bytes, waiting for
+ * at most timeout ticks if nothing has.
+ *
+ * @returns the number of bytes read into "buf", or -1 on failure
+ */
+ssize_t usb_cdc_read_some(void *buf, size_t len, uint32_t timeout);
+
 /**
  * Read from the CDC port, blocking until the entire buffer is read.
  *
@@ -53,6 +73,13 @@ static inline ssize_t usb_cdc_read(void *buf, size_t len)
   return usb_cdc_read_timeout(buf, len, portMAX_DELAY);
 }
 
+/**
+ * Format the transmit counters into "buf" for display.
+ *
+ * @returns the length snprintf returns
+ */
+int usb_cdc_report(char *buf, size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,6 +9,32 @@ import struct
 import sys
 
 
+def _crc32_table():
+    table = []
+    for n in range(256):
+        c = n << 24
+        for i in range(8):
+            c = ((c << 1) ^ 0x04c11db7 if c & 0x80000000 else c << 1) & 0xffffffff
+        table.append(c)
+    return table
+
+_CRC32_TABLE = _crc32_table()
+
+
+def crc32_stm32(data, crc=0xffffffff):
+    """CRC32 the way hw/crc.c computes it on the STM32 CRC unit.
+
+    Poly 0x04c11db7, no reflection, no final xor, fed little endian
+    32-bit words; the last len % 4 bytes are folded in one at a time.
+    """
+    data = bytearray(data)
+    words = len(data) & ~3
+    order = [j + 3 - k for j in range(0, words, 4) for k in range(4)]
+    for i in order + list(range(words, len(data))):
+        crc = ((crc << 8) & 0xffffffff) ^ _CRC32_TABLE[(crc >> 24) ^ data[i]]
+    return crc
+
+
 class MD380FW(object):
     # The stream cipher of MD-380 OEM firmware updates boils down
     # to a cyclic, static XOR key block, and here it is:
@@ -156,6 +182,10 @@ def main():
     parser.add_argument('--offset', '-o', dest='offset', type=hex_int,
                         default=0,
                         help='offset to skip in app binary')
+    parser.add_argument('--crc', '-c', dest='crc', action='store_true',
+                        default=False,
+                        help='append a CRC32 of the app for the firmware '
+                             'to check (with --wrap)')
     parser.add_argument('input', nargs=1, help='input file')
     parser.add_argument('output', nargs=1, help='output file')
     args = parser.parse_args()
@@ -176,6 +206,12 @@ def main():
         if len(md.app) == 0:
             sys.stderr.write('ERROR: seeking beyond end of input file\n')
             sys.exit(5)
+        if args.crc:
+            # The linker's _fw_end is word aligned, the CRC goes there
+            md.app += b'\xff' * (-len(md.app) % 4)
+            crc = crc32_stm32(md.app)
+            md.app += struct.pack('<L', crc)
+            print('INFO: crc 0x{0:08x}'.format(crc))
         output = md.wrap()
         print('INFO: base address 0x{0:x}'.format(md.start))
         print('INFO: length 0x{0:x}'.format(len(md.app)))
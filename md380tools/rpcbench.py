@@ -0,0 +1,79 @@
+#!/usr/bin/env python2
+# -*- coding: utf-8 -*-
+"""Measures the request round trip and the bulk throughput of the
+firmware's framed requests at a range of windows, see tytrpc.py.
+
+Reads come from a partition, writes go to a scratch file in SPIFFS that
+is removed afterwards.
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+import sys
+import time
+
+from tytrpc import TytRPC, RPCError
+
+SCRATCH = 'rpcbench.tmp'
+
+
+def median(v):
+    v = sorted(v)
+    return v[len(v) // 2]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Benchmark the firmware\'s '
+                                                 'framed requests')
+    parser.add_argument('--port', '-p', default='/dev/ttyACM0',
+                        help='serial port of the radio')
+    parser.add_argument('--pings', '-n', type=int, default=200,
+                        help='round trips to time')
+    parser.add_argument('--size', '-s', type=int, default=256,
+                        help='KiB to read and write at each window')
+    parser.add_argument('--windows', '-w', default='1,2,4,8,16',
+                        help='comma separated list of windows')
+    parser.add_argument('--part', default='spiffs',
+                        help='partition to read from')
+    args = parser.parse_args()
+    windows = [int(w) for w in args.windows.split(',')]
+    size = args.size * 1024
+
+    try:
+        with TytRPC(args.port) as rpc:
+            for payload in (0, 64, rpc.max_data):
+                rtt = []
+                for i in range(args.pings):
+                    t = time.time()
+                    rpc.ping(os.urandom(payload))
+                    rtt.append(time.time() - t)
+                print('ping %4d bytes: median %.2f ms, max %.2f ms' % (
+                    payload, median(rtt) * 1e3, max(rtt) * 1e3))
+
+            part = rpc.part(args.part)
+            data = os.urandom(size)
+            print('window  read KiB/s  write KiB/s')
+            for w in windows:
+                t = time.time()
+                rpc.flash_read(part['id'], 0, size, window=w)
+                read = size / 1024.0 / (time.time() - t)
+                t = time.time()
+                rpc.put(SCRATCH, data, window=w)
+                write = size / 1024.0 / (time.time() - t)
+                print('%6d %11.1f %12.1f' % (w, read, write))
+            if rpc.get(SCRATCH) != data:
+                raise IOError('scratch file read back wrong')
+            rpc.remove(SCRATCH)
+            t = rpc.telemetry()
+            print('%d requests resent, %d responses lost; radio saw %d bad '
+                  'and %d lost requests' % (rpc.resent, rpc.lost,
+                                            t['rx_bad'], t['rx_lost']))
+    except (RPCError, IOError, OSError, ValueError) as e:
+        sys.stderr.write('ERROR: %s\n' % e)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
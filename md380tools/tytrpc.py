@@ -0,0 +1,451 @@
+#!/usr/bin/env python2
+# -*- coding: utf-8 -*-
+"""Host side of the framed requests the firmware serves over USB, see
+hw/rpc.h for the protocol.
+
+Frames are COBS encoded and end with a zero byte.  Requests are sent
+ahead of their responses, up to a window of them, and the responses come
+back in order.  A request whose response is late is sent again; when
+that happens in a window, the rest of it is redone one at a time.
+"""
+
+from __future__ import print_function
+
+import argparse
+import collections
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+from md380_fw import crc32_stm32
+
+RPC_VERSION = 1
+RPC_RESPONSE = 0x80
+
+PING = 0x01
+INFO = 0x02
+TELEMETRY = 0x03
+FLASH_READ = 0x10
+FLASH_WRITE = 0x11
+FLASH_ERASE = 0x12
+FLASH_CRC = 0x13
+FILE_OPEN = 0x20
+FILE_READ = 0x21
+FILE_WRITE = 0x22
+FILE_CLOSE = 0x23
+FILE_STAT = 0x24
+FILE_REMOVE = 0x25
+FILE_LIST = 0x26
+SCREEN_READ = 0x30
+
+O_READ = 0x01
+O_WRITE = 0x02
+O_CREAT = 0x04
+O_TRUNC = 0x08
+
+PART_WRITE = 0x80
+
+# enum flash_part_id in hw/spiflash/flash_part.h
+PART_NAMES = ['oem', 'table', 'crashlog', 'spiffs', 'assets', 'contacts',
+              'staging', 'spiffs_snap', 'log', 'settings', 'spiffs_wear']
+
+ERRORS = {
+    -1: 'unknown command',
+    -2: 'bad argument',
+    -3: 'flash error',
+    -4: 'too many files open',
+    -10002: 'not found',
+    -10030: 'file exists',
+}
+
+_HDR = struct.Struct('<BBH')
+_INFO = struct.Struct('<HHLBBBB')
+_PART = struct.Struct('<LLLBBH')
+_FLASH_REQ = struct.Struct('<B3xLL')
+_FILE_REQ = struct.Struct('<LLL')
+_FILE_STAT = struct.Struct('<LB3x32s')
+_TELEMETRY = struct.Struct('<LHHHHBBHLLLLLLLL')
+_TELEMETRY_FIELDS = ('uptime_ms', 'vol', 'batt', 'batt2', 'temp', 'encoder',
+                     'ptt', 'reserved', 'heap_free', 'cache_hits',
+                     'cache_misses', 'rx_frames', 'rx_bad', 'rx_lost',
+                     'tx_frames', 'tx_short')
+
+
+class RPCError(Exception):
+    def __init__(self, cmd, status):
+        Exception.__init__(self, 'command 0x%02x: %s (%d)' % (
+            cmd, ERRORS.get(status, 'error'), status))
+        self.cmd = cmd
+        self.status = status
+
+
+def cobs_encode(data):
+    out = bytearray()
+    for block in bytearray(data).split(b'\x00'):
+        while len(block) >= 254:
+            out += b'\xff' + block[:254]
+            block = block[254:]
+        out.append(len(block) + 1)
+        out += block
+    return bytes(out)
+
+
+def cobs_decode(data):
+    data = bytearray(data)
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        if code == 0 or i + code > len(data):
+            return None
+        out += data[i + 1:i + code]
+        i += code
+        if code != 0xff and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+class TytRPC(object):
+    def __init__(self, port, timeout=1.0, window=8):
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        self.saved = termios.tcgetattr(self.fd)
+        tty.setraw(self.fd)
+        termios.tcflush(self.fd, termios.TCIOFLUSH)
+        self.timeout = timeout
+        self.window = window
+        self.seq = 0
+        self.rx_seq = None
+        self.lost = 0
+        self.resent = 0
+        self.next_id = 0
+        self.rx = bytearray()
+        self.frames = collections.deque()
+        # Starts a session and learns the limits
+        self.info, self.parts = self.get_info()
+        if self.info['version'] != RPC_VERSION:
+            raise IOError('protocol version %d' % self.info['version'])
+        self.max_data = self.info['max_data']
+
+    def close(self):
+        termios.tcsetattr(self.fd, termios.TCSANOW, self.saved)
+        os.close(self.fd)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    # Frames
+
+    def _send(self, cmd, payload=b''):
+        rid = self.next_id
+        self.next_id = (self.next_id + 1) & 0xffff
+        frame = _HDR.pack(self.seq, cmd, rid) + payload
+        frame += struct.pack('<L', crc32_stm32(frame))
+        self.seq = (self.seq + 1) & 0xff
+        wire = cobs_encode(frame) + b'\x00'
+        while wire:
+            wire = wire[os.write(self.fd, wire):]
+        return rid
+
+    def _frame(self, deadline):
+        """The next good frame as (cmd, id, status, data), or None."""
+        while True:
+            if not self.frames:
+                left = deadline - time.time()
+                if left <= 0 or \
+                        not select.select([self.fd], [], [], left)[0]:
+                    return None
+                self.rx += os.read(self.fd, 4096)
+                parts = self.rx.split(b'\x00')
+                self.rx = parts.pop()
+                self.frames.extend(parts)
+                continue
+            frame = cobs_decode(self.frames.popleft())
+            # Text the firmware logs between frames ends up here too
+            if frame is None or len(frame) < _HDR.size + 8:
+                continue
+            crc, = struct.unpack('<L', frame[-4:])
+            if crc32_stm32(frame[:-4]) != crc:
+                continue
+            seq, cmd, rid = _HDR.unpack(frame[:_HDR.size])
+            if self.rx_seq is not None:
+                self.lost += (seq - self.rx_seq - 1) & 0xff
+            self.rx_seq = seq
+            status, = struct.unpack('<l', frame[_HDR.size:_HDR.size + 4])
+            return cmd, rid, status, frame[_HDR.size + 4:-4]
+
+    def _wait(self, cmd, rid, timeout=None):
+        """Data of the response to request "rid", None if it is late."""
+        deadline = time.time() + (timeout or self.timeout)
+        while True:
+            resp = self._frame(deadline)
+            if resp is None:
+                return None
+            # Responses to requests given up on are dropped
+            if resp[1] == rid and resp[0] == cmd | RPC_RESPONSE:
+                if resp[2] < 0:
+                    raise RPCError(cmd, resp[2])
+                return resp[3]
+
+    def call(self, cmd, payload=b'', timeout=None):
+        for attempt in range(2):
+            data = self._wait(cmd, self._send(cmd, payload), timeout)
+            if data is not None:
+                return data
+            self.resent += 1
+        raise IOError('no response to command 0x%02x' % cmd)
+
+    def pipeline(self, requests, window=None):
+        """Data of the responses to a list of (cmd, payload), in order."""
+        window = window or self.window
+        results = [None] * len(requests)
+        pending = collections.deque()
+        n = 0
+        while n < len(requests) or pending:
+            while n < len(requests) and len(pending) < window:
+                pending.append((n, self._send(*requests[n])))
+                n += 1
+            i, rid = pending[0]
+            data = self._wait(requests[i][0], rid)
+            if data is None:
+                for i, rid in pending:
+                    results[i] = self.call(*requests[i])
+                pending.clear()
+                continue
+            pending.popleft()
+            results[i] = data
+        return results
+
+    # Requests
+
+    def ping(self, data=b''):
+        return self.call(PING, data)
+
+    def get_info(self):
+        data = self.call(INFO)
+        v = _INFO.unpack(data[:_INFO.size])
+        info = dict(zip(('version', 'max_data', 'flash_id', 'parts', 'files',
+                         'screen_w', 'screen_h'), v))
+        parts = []
+        for i in range(info['parts']):
+            off = _INFO.size + i * _PART.size
+            p = dict(zip(('start', 'size', 'erase_size', 'id', 'flags',
+                          'reserved'), _PART.unpack(data[off:off + _PART.size])))
+            p['name'] = PART_NAMES[p['id']] if p['id'] < len(PART_NAMES) \
+                else str(p['id'])
+            parts.append(p)
+        return info, parts
+
+    def telemetry(self):
+        return dict(zip(_TELEMETRY_FIELDS,
+                        _TELEMETRY.unpack(self.call(TELEMETRY))))
+
+    def part(self, name):
+        for p in self.parts:
+            if name in (p['name'], str(p['id'])):
+                return p
+        raise ValueError('no partition %s' % name)
+
+    def flash_read(self, part, off, length, window=None):
+        reqs = [(FLASH_READ, _FLASH_REQ.pack(part, o, min(self.max_data,
+                                                         off + length - o)))
+                for o in range(off, off + length, self.max_data)]
+        return b''.join(self.pipeline(reqs, window))
+
+    def flash_write(self, part, off, data, window=None):
+        reqs = [(FLASH_WRITE, _FLASH_REQ.pack(part, off + o, len(chunk)) +
+                 chunk)
+                for o, chunk in _chunks(data, self.max_data)]
+        self.pipeline(reqs, window)
+
+    def flash_erase(self, part, off, length):
+        # A 64 KiB block takes up to 2 s to erase
+        self.call(FLASH_ERASE, _FLASH_REQ.pack(part, off, length),
+                  self.timeout + 2.0 * -(-length // 0x10000))
+
+    def flash_crc(self, part, off, length):
+        return struct.unpack('<L', self.call(FLASH_CRC, _FLASH_REQ.pack(
+            part, off, length)))[0]
+
+    def open(self, name, flags):
+        return struct.unpack('<L', self.call(FILE_OPEN, struct.pack(
+            '<H', flags) + name))[0]
+
+    def close_file(self, fd):
+        self.call(FILE_CLOSE, struct.pack('<L', fd))
+
+    def stat(self, name):
+        return _stat(self.call(FILE_STAT, name))
+
+    def remove(self, name):
+        self.call(FILE_REMOVE, name)
+
+    def ls(self):
+        files = []
+        while True:
+            data = self.call(FILE_LIST, struct.pack('<L', len(files)))
+            if not data:
+                return files
+            files += [_stat(data[o:o + _FILE_STAT.size])
+                      for o in range(0, len(data), _FILE_STAT.size)]
+
+    def get(self, name, window=None):
+        size = self.stat(name)['size']
+        fd = self.open(name, O_READ)
+        try:
+            reqs = [(FILE_READ, _FILE_REQ.pack(fd, o, min(self.max_data,
+                                                         size - o)))
+                    for o in range(0, size, self.max_data)]
+            return b''.join(self.pipeline(reqs, window))
+        finally:
+            self.close_file(fd)
+
+    def put(self, name, data, window=None):
+        fd = self.open(name, O_WRITE | O_CREAT | O_TRUNC)
+        try:
+            reqs = [(FILE_WRITE, _FILE_REQ.pack(fd, o, len(chunk)) + chunk)
+                    for o, chunk in _chunks(data, self.max_data)]
+            self.pipeline(reqs, window)
+        finally:
+            self.close_file(fd)
+
+    def screen(self, window=None):
+        """The screen as width, height and RGB888 rows."""
+        w, h = self.info['screen_w'], self.info['screen_h']
+        rows = max(1, self.max_data // (w * 2))
+        reqs = [(SCREEN_READ, struct.pack('<BB', y, min(rows, h - y)))
+                for y in range(0, h, rows)]
+        rgb = bytearray()
+        px = bytearray(b''.join(self.pipeline(reqs, window)))
+        for i in range(0, len(px), 2):
+            c = px[i] << 8 | px[i + 1]
+            rgb += bytearray(((c >> 8) & 0xf8 | c >> 13,
+                              (c >> 3) & 0xfc | (c >> 9) & 0x03,
+                              (c << 3) & 0xf8 | (c >> 2) & 0x07))
+        return w, h, bytes(rgb)
+
+
+def _chunks(data, size):
+    return [(o, data[o:o + size]) for o in range(0, len(data), size)] or \
+        [(0, b'')]
+
+
+def _stat(data):
+    size, ftype, name = _FILE_STAT.unpack(data)
+    return {'size': size, 'type': ftype, 'name': name.rstrip(b'\x00')}
+
+
+def main():
+    def hex_int(x):
+        return int(x, 0)
+
+    parser = argparse.ArgumentParser(description='Talk to the firmware over '
+                                                 'its USB serial port')
+    parser.add_argument('--port', '-p', default='/dev/ttyACM0',
+                        help='serial port of the radio')
+    parser.add_argument('--window', '-w', type=int, default=8,
+                        help='requests sent ahead of their responses')
+    parser.add_argument('--timeout', '-t', type=float, default=1.0,
+                        help='seconds to wait for a response')
+    sub = parser.add_subparsers(dest='cmd')
+    sub.add_parser('info', help='show the flash partitions')
+    sub.add_parser('telemetry', help='show readings and statistics')
+    p = sub.add_parser('read', help='read from a partition into a file')
+    p.add_argument('part')
+    p.add_argument('offset', type=hex_int)
+    p.add_argument('length', type=hex_int)
+    p.add_argument('file')
+    p = sub.add_parser('write', help='erase and write a partition from a '
+                                     'file, then check its CRC')
+    p.add_argument('part')
+    p.add_argument('offset', type=hex_int)
+    p.add_argument('file')
+    p = sub.add_parser('crc', help='CRC32 of part of a partition')
+    p.add_argument('part')
+    p.add_argument('offset', type=hex_int)
+    p.add_argument('length', type=hex_int)
+    sub.add_parser('ls', help='list the files')
+    p = sub.add_parser('get', help='copy a file from the radio')
+    p.add_argument('name')
+    p.add_argument('file', nargs='?')
+    p = sub.add_parser('put', help='copy a file to the radio')
+    p.add_argument('file')
+    p.add_argument('name', nargs='?')
+    p = sub.add_parser('rm', help='remove a file')
+    p.add_argument('name')
+    p = sub.add_parser('screenshot', help='save the screen as a PPM')
+    p.add_argument('file')
+    args = parser.parse_args()
+
+    try:
+        with TytRPC(args.port, args.timeout, args.window) as rpc:
+            run(rpc, args)
+            if rpc.resent or rpc.lost:
+                sys.stderr.write('WARNING: %d requests resent, %d responses '
+                                 'lost\n' % (rpc.resent, rpc.lost))
+    except (RPCError, IOError, OSError, ValueError) as e:
+        sys.stderr.write('ERROR: %s\n' % e)
+        sys.exit(1)
+
+
+def run(rpc, args):
+    if args.cmd == 'info':
+        print('flash id 0x%06x, %d bytes a frame, %d files, screen %dx%d' % (
+            rpc.info['flash_id'], rpc.max_data, rpc.info['files'],
+            rpc.info['screen_w'], rpc.info['screen_h']))
+        for p in rpc.parts:
+            print('%-12s 0x%06x 0x%06x erase 0x%05x%s' % (
+                p['name'], p['start'], p['size'], p['erase_size'],
+                ' writable' if p['flags'] & PART_WRITE else ''))
+    elif args.cmd == 'telemetry':
+        t = rpc.telemetry()
+        for k in _TELEMETRY_FIELDS:
+            if k != 'reserved':
+                print('%-13s %d' % (k, t[k]))
+    elif args.cmd == 'read':
+        data = rpc.flash_read(rpc.part(args.part)['id'], args.offset,
+                              args.length)
+        with open(args.file, 'wb') as f:
+            f.write(data)
+    elif args.cmd == 'write':
+        p = rpc.part(args.part)
+        with open(args.file, 'rb') as f:
+            data = f.read()
+        if args.offset % p['erase_size']:
+            raise ValueError('offset is not on an erase boundary')
+        erase = -len(data) % p['erase_size'] + len(data)
+        rpc.flash_erase(p['id'], args.offset, erase)
+        rpc.flash_write(p['id'], args.offset, data)
+        if rpc.flash_crc(p['id'], args.offset, len(data)) != \
+                crc32_stm32(data):
+            raise IOError('CRC mismatch after writing')
+        print('INFO: wrote 0x%x bytes' % len(data))
+    elif args.cmd == 'crc':
+        print('0x%08x' % rpc.flash_crc(rpc.part(args.part)['id'],
+                                       args.offset, args.length))
+    elif args.cmd == 'ls':
+        for f in rpc.ls():
+            print('%8d %s' % (f['size'], f['name']))
+    elif args.cmd == 'get':
+        data = rpc.get(args.name)
+        with open(args.file or os.path.basename(args.name), 'wb') as f:
+            f.write(data)
+    elif args.cmd == 'put':
+        with open(args.file, 'rb') as f:
+            rpc.put(args.name or os.path.basename(args.file), f.read())
+    elif args.cmd == 'rm':
+        rpc.remove(args.name)
+    elif args.cmd == 'screenshot':
+        w, h, rgb = rpc.screen()
+        with open(args.file, 'wb') as f:
+            f.write(b'P6\n%d %d\n255\n' % (w, h) + rgb)
+
+
+if __name__ == "__main__":
+    main()